@@ -35,6 +35,7 @@ clang++ \
   -I "${MSFS_SDK}/WASM/include" \
   -I "${MSFS_SDK}/SimConnect SDK/include" \
   -I "${DIR}/src" \
+  -I "${DIR}/../wasm-common/src" \
   "${DIR}/src/FadecGauge.cpp" \
   -o fadec.o
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Logger.h"
 #include "RegPolynomials.h"
 #include "SimVars.h"
 #include "Tables.h"
@@ -905,7 +906,7 @@ class EngineControl {
     double fuelLeftAuxInit = 228;
     double fuelRightAuxInit = fuelLeftAuxInit;
 
-    std::cout << "FADEC: Initializing EngineControl" << std::endl;
+    LOG_INFO("FADEC: Initializing EngineControl");
 
     simVars = new SimVars();
     engTime = 0;
@@ -21,6 +21,7 @@
 #include <string>
 
 #include "EngineControl.h"
+#include "Logger.h"
 #include "RegPolynomials.h"
 #include "SimVars.h"
 #include "Tables.h"
@@ -39,9 +40,9 @@ class FadecGauge {
   /// </summary>
   /// <returns>True if successful, false otherwise.</returns>
   bool initializeSimConnect() {
-    std::cout << "FADEC: Connecting to SimConnect..." << std::endl;
+    LOG_INFO("FADEC: Connecting to SimConnect...");
     if (SUCCEEDED(SimConnect_Open(&hSimConnect, "FadecGauge", nullptr, 0, 0, 0))) {
-      std::cout << "FADEC: SimConnect connected." << std::endl;
+      LOG_INFO("FADEC: SimConnect connected.");
 
       // SimConnect Payload Definitions
       SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStation1, "PAYLOAD STATION WEIGHT:1", "Pounds");
@@ -75,11 +76,11 @@ class FadecGauge {
       // Simulation Data
       SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::SimulationDataTypeId, "SIMULATION TIME", "NUMBER");
       SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::SimulationDataTypeId, "SIMULATION RATE", "NUMBER");
-      std::cout << "FADEC: SimConnect registrations complete." << std::endl;
+      LOG_INFO("FADEC: SimConnect registrations complete.");
       return true;
     }
 
-    std::cout << "FADEC: SimConnect failed." << std::endl;
+    LOG_ERROR("FADEC: SimConnect failed.");
 
     return false;
   }
@@ -91,13 +92,17 @@ class FadecGauge {
   /// <returns>True if successful, false otherwise.</returns>
   bool initializeFADEC() {
     if (!this->initializeSimConnect()) {
-      std::cout << "FADEC: Init SimConnect failed." << std::endl;
+      LOG_ERROR("FADEC: Init SimConnect failed.");
+      Logger::flush();
       return false;
     }
 
     EngineControlInstance.initialize();
     isConnected = true;
 
+    // write buffered log messages
+    Logger::flush();
+
     return true;
   }
 
@@ -113,6 +118,7 @@ class FadecGauge {
       // detect pause
       if ((simulationData.simulationTime == previousSimulationTime) || (simulationData.simulationTime < 0.2)) {
         // pause detected -> return
+        Logger::flush();
         return true;
       }
       // calculate delta time
@@ -123,6 +129,9 @@ class FadecGauge {
       EngineControlInstance.update(calculatedSampleTime);
     }
 
+    // write buffered log messages
+    Logger::flush();
+
     return true;
   }
 
@@ -167,12 +176,12 @@ class FadecGauge {
     switch (pData->dwID) {
       case SIMCONNECT_RECV_ID_OPEN:
         // connection established
-        cout << "FADEC: SimConnect connection established" << endl;
+        LOG_INFO("FADEC: SimConnect connection established");
         break;
 
       case SIMCONNECT_RECV_ID_QUIT:
         // connection lost
-        cout << "FADEC: Received SimConnect connection quit message" << endl;
+        LOG_INFO("FADEC: Received SimConnect connection quit message");
         break;
 
       case SIMCONNECT_RECV_ID_SIMOBJECT_DATA:
@@ -182,10 +191,10 @@ class FadecGauge {
 
       case SIMCONNECT_RECV_ID_EXCEPTION:
         // exception
-        cout << "FADEC: Exception in SimConnect connection: ";
-        cout << getSimConnectExceptionString(
-            static_cast<SIMCONNECT_EXCEPTION>(static_cast<SIMCONNECT_RECV_EXCEPTION*>(pData)->dwException));
-        cout << endl;
+        LOG_ERROR("FADEC: Exception in SimConnect connection: %s",
+                  getSimConnectExceptionString(
+                      static_cast<SIMCONNECT_EXCEPTION>(static_cast<SIMCONNECT_RECV_EXCEPTION*>(pData)->dwException))
+                      .c_str());
         break;
 
       default:
@@ -203,8 +212,7 @@ class FadecGauge {
 
       default:
         // print unknown request id
-        cout << "FADEC: Unknown request id in SimConnect connection: ";
-        cout << data->dwRequestID << endl;
+        LOG_ERROR("FADEC: Unknown request id in SimConnect connection: %lu", static_cast<unsigned long>(data->dwRequestID));
         return;
     }
   }
@@ -214,12 +222,13 @@ class FadecGauge {
   /// </summary>
   /// <returns>True if successful, false otherwise.</returns>
   bool killFADEC() {
-    std::cout << "FADEC: Disconnecting ..." << std::endl;
+    LOG_INFO("FADEC: Disconnecting ...");
     EngineControlInstance.terminate();
     isConnected = false;
     unregister_all_named_vars();
 
-    std::cout << "FADEC: Disconnected." << std::endl;
+    LOG_INFO("FADEC: Disconnected.");
+    Logger::flush();
     return SUCCEEDED(SimConnect_Close(hSimConnect));
   }
 
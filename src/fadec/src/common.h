@@ -7,8 +7,9 @@ HANDLE hSimConnect;
 /// <summary>
 /// Custom POW function
 /// </summary>
-double powFBW(double base, size_t exponent) {
-  double power = 1.0;
+template <typename T>
+T powFBW(T base, size_t exponent) {
+  T power = 1;
 
   while (exponent > 0) {
     power *= base;
@@ -21,9 +22,10 @@ double powFBW(double base, size_t exponent) {
 /// <summary>
 /// Custom EXP function
 /// </summary>
-double expFBW(double x) {
+template <typename T>
+T expFBW(T x) {
   int n = 8;
-  x = 1.0 + x / 256.0;
+  x = 1 + x / 256;
 
   while (n > 0) {
     x *= x;
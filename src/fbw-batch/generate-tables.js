@@ -0,0 +1,87 @@
+// Generates the name tables used by fbw-batch to address model parameters and
+// model outputs by name. Run this script whenever the generated model code in
+// src/fbw/src/model changes:
+//
+//   node generate-tables.js
+//
+const fs = require('fs');
+const path = require('path');
+
+const MODEL_DIR = path.join(__dirname, '..', 'fbw', 'src', 'model');
+const OUTPUT_FILE = path.join(__dirname, 'src', 'ModelTables.cpp');
+
+const MODELS = [
+    { name: 'FlyByWire', output: 'fbw_output' },
+    { name: 'Autothrust', output: 'athr_out' },
+    { name: 'ThrustLimits', output: 'thrust_limits_out' },
+];
+
+const readStructs = (text) => {
+    const structs = {};
+    const structRegex = /struct (\w+)\s*\{([^}]*)\}/g;
+    let match;
+    while ((match = structRegex.exec(text)) !== null) {
+        structs[match[1]] = [...match[2].matchAll(/^\s*(\w+) (\w+)(?:\[(\d+)\])?;/gm)]
+            .map((m) => ({ type: m[1], name: m[2], count: m[3] ? parseInt(m[3], 10) : 1 }));
+    }
+    const enums = [...text.matchAll(/typedef enum \{[^}]*\} (\w+);/g)].map((m) => m[1]);
+    return { structs, enums };
+};
+
+const valueType = (type, enums) => {
+    if (type === 'real_T') {
+        return 'ValueType::REAL';
+    }
+    if (type === 'boolean_T') {
+        return 'ValueType::BOOLEAN';
+    }
+    if (enums.includes(type)) {
+        return 'ValueType::ENUM';
+    }
+    return undefined;
+};
+
+const flatten = (structs, enums, type, prefix) => {
+    const entries = [];
+    for (const field of structs[type]) {
+        const name = prefix ? `${prefix}.${field.name}` : field.name;
+        if (structs[field.type]) {
+            entries.push(...flatten(structs, enums, field.type, name));
+        } else if (valueType(field.type, enums) && field.count === 1) {
+            entries.push({ name, type: valueType(field.type, enums) });
+        }
+    }
+    return entries;
+};
+
+let result = '// This file is generated by generate-tables.js, do not edit it manually!\n\n';
+result += '#include "ModelTables.h"\n\n';
+result += '#include <cstddef>\n\n';
+MODELS.forEach((model) => result += `#include "${model.name}.h"\n`);
+
+for (const model of MODELS) {
+    const header = fs.readFileSync(path.join(MODEL_DIR, `${model.name}.h`), 'utf8');
+    const types = readStructs(fs.readFileSync(path.join(MODEL_DIR, `${model.name}_types.h`), 'utf8'));
+    const parameterType = `${model.name}ModelClass::Parameters_${model.name}_T`;
+
+    // parameters: only real values are tunable
+    const parameters = readStructs(header).structs[`Parameters_${model.name}_T`].filter((p) => p.type === 'real_T');
+    result += `\nconst ParameterEntry ${model.name}ParameterTable[] = {\n`;
+    for (const p of parameters) {
+        result += `    {"${p.name}", offsetof(${parameterType}, ${p.name}), ${p.count}},\n`;
+    }
+    result += '};\n';
+    result += `const size_t ${model.name}ParameterTableSize = sizeof(${model.name}ParameterTable) / sizeof(ParameterEntry);\n`;
+
+    // outputs: flattened to dotted names
+    const outputs = flatten(types.structs, types.enums, model.output, '');
+    result += `\nconst OutputEntry ${model.name}OutputTable[] = {\n`;
+    for (const o of outputs) {
+        result += `    {"${o.name}", offsetof(${model.output}, ${o.name}), ${o.type}},\n`;
+    }
+    result += '};\n';
+    result += `const size_t ${model.name}OutputTableSize = sizeof(${model.name}OutputTable) / sizeof(OutputEntry);\n`;
+}
+
+fs.writeFileSync(OUTPUT_FILE, result);
+console.log(`Written ${OUTPUT_FILE}`);
@@ -0,0 +1,14 @@
+// The generated code of the autopilot state machine checks for the 32-bit long of the simulator target. The code itself
+// only uses fixed width types, so the check is satisfied here to be able to build it for 64-bit hosts.
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#undef ULONG_MAX
+#undef LONG_MAX
+#define ULONG_MAX (0xFFFFFFFFU)
+#define LONG_MAX (0x7FFFFFFF)
+
+#include "AutopilotStateMachine.cpp"
+#include "AutopilotStateMachine_data.cpp"
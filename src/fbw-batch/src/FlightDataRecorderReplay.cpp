@@ -0,0 +1,293 @@
+#include "FlightDataRecorderReplay.h"
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+#include "AdditionalData.h"
+#include "PerformanceData.h"
+#include "AutopilotLaws_types.h"
+#include "AutopilotStateMachine_types.h"
+#include "EngineData.h"
+#include "zfstream.h"
+
+using namespace std;
+
+namespace {
+
+void reconstructFlyByWireInput(const FlyByWireModelClass::Parameters_FlyByWire_T& p,
+                               const fbw_output& out,
+                               const ReplayFrame* previous,
+                               fbw_input& in) {
+  in.time.dt = out.sim.time.dt;
+  in.time.simulation_time = out.sim.time.simulation_time;
+
+  // copy everything with identical meaning
+  in.data.nz_g = out.sim.data.nz_g;
+  in.data.psi_magnetic_deg = out.sim.data.psi_magnetic_deg;
+  in.data.psi_true_deg = out.sim.data.psi_true_deg;
+  in.data.alpha_deg = out.sim.data.alpha_deg;
+  in.data.beta_deg = out.sim.data.beta_deg;
+  in.data.beta_dot_deg_s = out.sim.data.beta_dot_deg_s;
+  in.data.V_ias_kn = out.sim.data.V_ias_kn;
+  in.data.V_tas_kn = out.sim.data.V_tas_kn;
+  in.data.V_mach = out.sim.data.V_mach;
+  in.data.H_ft = out.sim.data.H_ft;
+  in.data.H_ind_ft = out.sim.data.H_ind_ft;
+  in.data.H_radio_ft = out.sim.data.H_radio_ft;
+  in.data.CG_percent_MAC = out.sim.data.CG_percent_MAC;
+  in.data.total_weight_kg = out.sim.data.total_weight_kg;
+  in.data.flaps_handle_index = out.sim.data.flaps_handle_index;
+  in.data.spoilers_left_pos = out.sim.data.spoilers_left_pos;
+  in.data.spoilers_right_pos = out.sim.data.spoilers_right_pos;
+  in.data.autopilot_master_on = out.sim.data.autopilot_master_on;
+  in.data.slew_on = out.sim.data.slew_on;
+  in.data.pause_on = out.sim.data.pause_on;
+  in.data.tracking_mode_on_override = out.sim.data.tracking_mode_on_override;
+  in.data.autopilot_custom_on = out.sim.data.autopilot_custom_on;
+  in.data.autopilot_custom_Theta_c_deg = out.sim.data.autopilot_custom_Theta_c_deg;
+  in.data.autopilot_custom_Phi_c_deg = out.sim.data.autopilot_custom_Phi_c_deg;
+  in.data.autopilot_custom_Beta_c_deg = out.sim.data.autopilot_custom_Beta_c_deg;
+  in.data.simulation_rate = out.sim.data.simulation_rate;
+  in.data.ice_structure_percent = out.sim.data.ice_structure_percent;
+  in.data.linear_cl_alpha_per_deg = out.sim.data.linear_cl_alpha_per_deg;
+  in.data.alpha_stall_deg = out.sim.data.alpha_stall_deg;
+  in.data.alpha_zero_lift_deg = out.sim.data.alpha_zero_lift_deg;
+  in.data.ambient_density_kg_per_m3 = out.sim.data.ambient_density_kg_per_m3;
+  in.data.ambient_pressure_mbar = out.sim.data.ambient_pressure_mbar;
+  in.data.ambient_temperature_celsius = out.sim.data.ambient_temperature_celsius;
+  in.data.ambient_wind_x_kn = out.sim.data.ambient_wind_x_kn;
+  in.data.ambient_wind_y_kn = out.sim.data.ambient_wind_y_kn;
+  in.data.ambient_wind_z_kn = out.sim.data.ambient_wind_z_kn;
+  in.data.ambient_wind_velocity_kn = out.sim.data.ambient_wind_velocity_kn;
+  in.data.ambient_wind_direction_deg = out.sim.data.ambient_wind_direction_deg;
+  in.data.total_air_temperature_celsius = out.sim.data.total_air_temperature_celsius;
+  in.data.latitude_deg = out.sim.data.latitude_deg;
+  in.data.longitude_deg = out.sim.data.longitude_deg;
+  in.data.engine_1_thrust_lbf = out.sim.data.engine_1_thrust_lbf;
+  in.data.engine_2_thrust_lbf = out.sim.data.engine_2_thrust_lbf;
+  in.data.thrust_lever_1_pos = out.sim.data.thrust_lever_1_pos;
+  in.data.thrust_lever_2_pos = out.sim.data.thrust_lever_2_pos;
+  in.data.tailstrike_protection_on = out.sim.data.tailstrike_protection_on;
+  in.data.VLS_kn = out.sim.data.VLS_kn;
+
+  // invert the input conversions of the model
+  in.data.Theta_deg = out.sim.data.Theta_deg / p.GainTheta_Gain;
+  in.data.Phi_deg = out.sim.data.Phi_deg / p.GainPhi_Gain;
+  in.data.q_rad_s = out.sim.data.q_deg_s / (p.Gain_Gain_n * p.Gainqk_Gain);
+  in.data.r_rad_s = out.sim.data.r_deg_s / p.Gain_Gain_l;
+  in.data.p_rad_s = out.sim.data.p_deg_s / (p.Gain_Gain_a * p.Gainpk_Gain);
+  in.data.eta_pos = out.sim.data.eta_deg / p.Gainpk4_Gain;
+  in.data.eta_trim_deg = out.sim.data.eta_trim_deg / p.Gainpk2_Gain;
+  in.data.xi_pos = out.sim.data.xi_deg / p.Gainpk5_Gain;
+  in.data.zeta_pos = out.sim.data.zeta_deg / p.Gainpk6_Gain;
+  in.data.zeta_trim_pos = out.sim.data.zeta_trim_deg / p.Gainpk3_Gain;
+  in.data.gear_animation_pos_0 = (out.sim.data.gear_strut_compression_0 + p.Constant_Value_g) / p.Gain_Gain_i;
+  in.data.gear_animation_pos_1 = (out.sim.data.gear_strut_compression_1 + p.Constant_Value_g) / p.Gain1_Gain_h;
+  in.data.gear_animation_pos_2 = (out.sim.data.gear_strut_compression_2 + p.Constant_Value_g) / p.Gain2_Gain_a;
+
+  // body accelerations are not recorded
+  if (previous != nullptr && in.time.dt > 0) {
+    in.data.q_dot_rad_s2 = (in.data.q_rad_s - previous->flyByWireInput.data.q_rad_s) / in.time.dt;
+    in.data.r_dot_rad_s2 = (in.data.r_rad_s - previous->flyByWireInput.data.r_rad_s) / in.time.dt;
+    in.data.p_dot_rad_s2 = (in.data.p_rad_s - previous->flyByWireInput.data.p_rad_s) / in.time.dt;
+  }
+
+  in.input.delta_eta_pos = out.sim.input.delta_eta_pos / p.Gaineta_Gain;
+  in.input.delta_xi_pos = out.sim.input.delta_xi_pos / p.Gainxi_Gain;
+  in.input.delta_zeta_pos = out.sim.input.delta_zeta_pos / p.Gainxi1_Gain;
+}
+
+void reconstructAutothrustInput(const AutothrustModelClass::Parameters_Autothrust_T& p, const athr_out& out, athr_in& in) {
+  in.time = out.time;
+  in.input = out.input;
+
+  in.data.nz_g = out.data.nz_g;
+  in.data.Theta_deg = out.data.Theta_deg / p.Gain2_Gain;
+  in.data.Phi_deg = out.data.Phi_deg / p.Gain3_Gain_c;
+  in.data.V_ias_kn = out.data.V_ias_kn;
+  in.data.V_tas_kn = out.data.V_tas_kn;
+  in.data.V_mach = out.data.V_mach;
+  in.data.V_gnd_kn = out.data.V_gnd_kn;
+  in.data.alpha_deg = out.data.alpha_deg;
+  in.data.H_ft = out.data.H_ft;
+  in.data.H_ind_ft = out.data.H_ind_ft;
+  in.data.H_radio_ft = out.data.H_radio_ft;
+  in.data.H_dot_fpm = out.data.H_dot_fpm;
+  in.data.bx_m_s2 = out.data.bx_m_s2;
+  in.data.by_m_s2 = out.data.by_m_s2;
+  in.data.bz_m_s2 = out.data.bz_m_s2;
+  in.data.Psi_magnetic_deg = out.data.Psi_magnetic_deg;
+  in.data.Psi_magnetic_track_deg = out.data.Psi_magnetic_track_deg;
+  in.data.flap_handle_index = out.data.flap_handle_index;
+  in.data.is_engine_operative_1 = out.data.is_engine_operative_1;
+  in.data.is_engine_operative_2 = out.data.is_engine_operative_2;
+  in.data.engine_N1_1_percent = out.data.engine_N1_1_percent;
+  in.data.engine_N1_2_percent = out.data.engine_N1_2_percent;
+  in.data.TAT_degC = out.data.TAT_degC;
+  in.data.OAT_degC = out.data.OAT_degC;
+  in.data.ambient_density_kg_per_m3 = out.data.ambient_density_kg_per_m3;
+
+  // not recorded -> approximate
+  double strutCompression = out.data.on_ground ? p.Saturation_UpperSat_p : p.Saturation_LowerSat_h;
+  in.data.gear_strut_compression_1 = (strutCompression + p.Constant1_Value_l) / p.Gain_Gain_d;
+  in.data.gear_strut_compression_2 = (strutCompression + p.Constant1_Value_l) / p.Gain1_Gain_n;
+  in.data.corrected_engine_N1_1_percent = out.data.engine_N1_1_percent;
+  in.data.corrected_engine_N1_2_percent = out.data.engine_N1_2_percent;
+  in.data.commanded_engine_N1_1_percent = out.data.commanded_engine_N1_1_percent;
+  in.data.commanded_engine_N1_2_percent = out.data.commanded_engine_N1_2_percent;
+}
+
+void reconstructAutopilotStateMachineInput(const AutopilotStateMachineModelClass::Parameters_AutopilotStateMachine_T& p,
+                                           const ap_sm_output& out,
+                                           const ReplayFrame* previous,
+                                           ap_sm_input& in) {
+  in.time = out.time;
+  in.input = out.input;
+
+  // copy everything with identical meaning
+  in.data.aircraft_position = out.data.aircraft_position;
+  in.data.V_ias_kn = out.data.V_ias_kn;
+  in.data.V_tas_kn = out.data.V_tas_kn;
+  in.data.V_mach = out.data.V_mach;
+  in.data.V_gnd_kn = out.data.V_gnd_kn;
+  in.data.alpha_deg = out.data.alpha_deg;
+  in.data.beta_deg = out.data.beta_deg;
+  in.data.H_ft = out.data.H_ft;
+  in.data.H_ind_ft = out.data.H_ind_ft;
+  in.data.H_radio_ft = out.data.H_radio_ft;
+  in.data.H_dot_ft_min = out.data.H_dot_ft_min;
+  in.data.Psi_magnetic_deg = out.data.Psi_magnetic_deg;
+  in.data.Psi_magnetic_track_deg = out.data.Psi_magnetic_track_deg;
+  in.data.Psi_true_deg = out.data.Psi_true_deg;
+  in.data.bx_m_s2 = out.data.bx_m_s2;
+  in.data.by_m_s2 = out.data.by_m_s2;
+  in.data.bz_m_s2 = out.data.bz_m_s2;
+  in.data.nav_valid = out.data.nav_valid;
+  in.data.nav_loc_deg = out.data.nav_loc_deg;
+  in.data.nav_gs_deg = out.data.nav_gs_deg;
+  in.data.nav_dme_valid = out.data.nav_dme_valid;
+  in.data.nav_dme_nmi = out.data.nav_dme_nmi;
+  in.data.nav_loc_valid = out.data.nav_loc_valid;
+  in.data.nav_loc_magvar_deg = out.data.nav_loc_magvar_deg;
+  in.data.nav_loc_error_deg = out.data.nav_loc_error_deg;
+  in.data.nav_loc_position = out.data.nav_loc_position;
+  in.data.nav_gs_valid = out.data.nav_gs_valid;
+  in.data.nav_gs_error_deg = out.data.nav_gs_error_deg;
+  in.data.nav_gs_position = out.data.nav_gs_position;
+  in.data.flight_guidance_xtk_nmi = out.data.flight_guidance_xtk_nmi;
+  in.data.flight_guidance_tae_deg = out.data.flight_guidance_tae_deg;
+  in.data.flight_guidance_phi_deg = out.data.flight_guidance_phi_deg;
+  in.data.flight_guidance_phi_limit_deg = out.data.flight_guidance_phi_limit_deg;
+  in.data.flight_phase = out.data.flight_phase;
+  in.data.V2_kn = out.data.V2_kn;
+  in.data.VAPP_kn = out.data.VAPP_kn;
+  in.data.VLS_kn = out.data.VLS_kn;
+  in.data.VMAX_kn = out.data.VMAX_kn;
+  in.data.is_flight_plan_available = out.data.is_flight_plan_available;
+  in.data.altitude_constraint_ft = out.data.altitude_constraint_ft;
+  in.data.thrust_reduction_altitude = out.data.thrust_reduction_altitude;
+  in.data.thrust_reduction_altitude_go_around = out.data.thrust_reduction_altitude_go_around;
+  in.data.acceleration_altitude = out.data.acceleration_altitude;
+  in.data.acceleration_altitude_engine_out = out.data.acceleration_altitude_engine_out;
+  in.data.acceleration_altitude_go_around = out.data.acceleration_altitude_go_around;
+  in.data.acceleration_altitude_go_around_engine_out = out.data.acceleration_altitude_go_around_engine_out;
+  in.data.cruise_altitude = out.data.cruise_altitude;
+  in.data.throttle_lever_1_pos = out.data.throttle_lever_1_pos;
+  in.data.throttle_lever_2_pos = out.data.throttle_lever_2_pos;
+  in.data.flaps_handle_index = out.data.flaps_handle_index;
+  in.data.is_engine_operative_1 = out.data.is_engine_operative_1;
+  in.data.is_engine_operative_2 = out.data.is_engine_operative_2;
+
+  // invert the input conversions of the model, the body rates are transformed into euler angle rates
+  in.data.Theta_deg = out.data.Theta_deg / p.GainTheta_Gain;
+  in.data.Phi_deg = out.data.Phi_deg / p.GainTheta1_Gain;
+  in.data.zeta_pos = out.data.zeta_deg / p.Gain2_Gain;
+  double theta = 0.017453292519943295 * out.data.Theta_deg;
+  double phi = 0.017453292519943295 * out.data.Phi_deg;
+  double pk = out.data.pk_deg_s - sin(theta) * out.data.rk_deg_s;
+  double qk = cos(phi) * out.data.qk_deg_s + sin(phi) * cos(theta) * out.data.rk_deg_s;
+  double rk = -sin(phi) * out.data.qk_deg_s + cos(phi) * cos(theta) * out.data.rk_deg_s;
+  in.data.p_rad_s = pk / (p.Gain_Gain_k * p.Gainpk_Gain);
+  in.data.q_rad_s = qk / (p.Gain_Gain * p.Gainqk_Gain);
+  in.data.r_rad_s = rk / p.Gain_Gain_a;
+
+  // not recorded -> approximate
+  double strutCompression = out.data.on_ground != 0.0 ? p.Saturation_UpperSat : p.Saturation_LowerSat;
+  in.data.gear_strut_compression_1 = (strutCompression + p.Constant1_Value) / p.Gain_Gain_af;
+  in.data.gear_strut_compression_2 = (strutCompression + p.Constant1_Value) / p.Gain1_Gain;
+  double altimeterSetting = previous != nullptr ? previous->autopilotStateMachineInput.data.altimeter_setting_left_mbar : 1013.0;
+  if (out.data.altimeter_setting_changed) {
+    altimeterSetting += 1.0;
+  }
+  in.data.altimeter_setting_left_mbar = altimeterSetting;
+  in.data.altimeter_setting_right_mbar = altimeterSetting;
+}
+
+}  // namespace
+
+bool FlightDataRecorderReplay::load(const string& filePath,
+                                    bool isCompressed,
+                                    vector<ReplayFrame>& frames,
+                                    const AutopilotStateMachineModelClass::Parameters_AutopilotStateMachine_T* stateMachineParameters) {
+  // create input stream
+  unique_ptr<istream> in;
+  if (isCompressed) {
+    in = make_unique<gzifstream>(filePath.c_str());
+  } else {
+    in = make_unique<ifstream>(filePath.c_str(), ios::in | ios::binary);
+  }
+
+  // check if stream is ok
+  if (!in->good()) {
+    cout << "Failed to open input file '" << filePath << "'!" << endl;
+    return false;
+  }
+
+  // read and check file version
+  uint64_t fileFormatVersion = {};
+  in->read(reinterpret_cast<char*>(&fileFormatVersion), sizeof(fileFormatVersion));
+  if (INTERFACE_VERSION != fileFormatVersion) {
+    cout << "ERROR: mismatch between replay and file version ( ";
+    cout << INTERFACE_VERSION;
+    cout << " <> " << fileFormatVersion << " ) in '" << filePath << "'" << endl;
+    return false;
+  }
+
+  // default parameters are used to invert the input conversions
+  auto flyByWire = make_unique<FlyByWireModelClass>();
+  auto autothrust = make_unique<AutothrustModelClass>();
+
+  // struct for reading
+  ap_sm_output data_ap_sm = {};
+  ap_raw_output data_ap_laws = {};
+  EngineData data_engine = {};
+  AdditionalData data_additional = {};
+  PerformanceData data_performance = {};
+
+  while (true) {
+    ReplayFrame frame = {};
+    in->read(reinterpret_cast<char*>(&data_ap_sm), sizeof(ap_sm_output));
+    in->read(reinterpret_cast<char*>(&data_ap_laws), sizeof(ap_raw_output));
+    in->read(reinterpret_cast<char*>(&frame.autothrustOutput), sizeof(athr_out));
+    in->read(reinterpret_cast<char*>(&frame.flyByWireOutput), sizeof(fbw_output));
+    in->read(reinterpret_cast<char*>(&data_engine), sizeof(EngineData));
+    in->read(reinterpret_cast<char*>(&data_additional), sizeof(AdditionalData));
+    in->read(reinterpret_cast<char*>(&data_performance), sizeof(PerformanceData));
+    if (!in->good()) {
+      break;
+    }
+
+    reconstructFlyByWireInput(flyByWire->getParameters(), frame.flyByWireOutput, frames.empty() ? nullptr : &frames.back(),
+                              frame.flyByWireInput);
+    reconstructAutothrustInput(autothrust->getParameters(), frame.autothrustOutput, frame.autothrustInput);
+    if (stateMachineParameters != nullptr) {
+      reconstructAutopilotStateMachineInput(*stateMachineParameters, data_ap_sm, frames.empty() ? nullptr : &frames.back(),
+                                            frame.autopilotStateMachineInput);
+    }
+    frames.push_back(frame);
+  }
+
+  return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "AutopilotStateMachine.h"
+#include "Autothrust.h"
+#include "FlyByWire.h"
+
+// One recorded frame of a flight data recorder file together with the model
+// inputs reconstructed from it.
+struct ReplayFrame {
+  fbw_input flyByWireInput;
+  athr_in autothrustInput;
+  fbw_output flyByWireOutput;
+  athr_out autothrustOutput;
+  ap_sm_input autopilotStateMachineInput;
+};
+
+// Reads flight data recorder files and rebuilds the raw model inputs from the
+// recorded model outputs, so that the models can be stepped again on recorded
+// flights. The recorder only stores the model outputs, hence the inputs are
+// reconstructed by inverting the input conversions of the models (using their
+// default parameters). Values that are not recorded are approximated:
+//  - fly-by-wire body accelerations are differentiated from the body rates
+//  - autothrust gear strut compression is derived from the on ground state
+//  - autothrust corrected N1 equals N1 (commanded N1 is rebuilt accordingly)
+//  - autopilot state machine button pushes are the recorded rising edges
+//  - autopilot state machine altimeter settings only change with the recorded change flag
+class FlightDataRecorderReplay {
+ public:
+  FlightDataRecorderReplay() = delete;
+  ~FlightDataRecorderReplay() = delete;
+
+  // IMPORTANT: this constant needs to increased with every interface change
+  static const uint64_t INTERFACE_VERSION = 19;
+
+  // the autopilot state machine inputs are only reconstructed when its parameters are given
+  static bool load(const std::string& filePath,
+                   bool isCompressed,
+                   std::vector<ReplayFrame>& frames,
+                   const AutopilotStateMachineModelClass::Parameters_AutopilotStateMachine_T* stateMachineParameters = nullptr);
+};
@@ -0,0 +1,78 @@
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <MSFS/Legacy/gauges.h>
+
+#include "GaugesEmulation.h"
+
+using namespace std;
+
+static unordered_map<string, ID> namedVariableIds;
+static vector<FLOAT64> namedVariableValues;
+static uint32_t callCost = 0;
+static uint64_t numberOfReads = 0;
+static uint64_t numberOfWrites = 0;
+
+static void spendCallCost() {
+  if (callCost == 0) {
+    return;
+  }
+  auto start = chrono::steady_clock::now();
+  while (chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() < callCost) {
+  }
+}
+
+ID register_named_variable(PCSTRINGZ name) {
+  auto it = namedVariableIds.find(name);
+  if (it != namedVariableIds.end()) {
+    return it->second;
+  }
+  ID id = static_cast<ID>(namedVariableValues.size());
+  namedVariableIds.emplace(name, id);
+  namedVariableValues.push_back(0.0);
+  return id;
+}
+
+FLOAT64 get_named_variable_value(ID id) {
+  numberOfReads++;
+  spendCallCost();
+  return namedVariableValues[id];
+}
+
+void set_named_variable_value(ID id, FLOAT64 value) {
+  numberOfWrites++;
+  spendCallCost();
+  namedVariableValues[id] = value;
+}
+
+void unregister_all_named_vars() {
+  namedVariableIds.clear();
+  namedVariableValues.clear();
+}
+
+void GaugesEmulation::setCallCost(uint32_t nanoseconds) {
+  callCost = nanoseconds;
+}
+
+uint64_t GaugesEmulation::getNumberOfReads() {
+  return numberOfReads;
+}
+
+uint64_t GaugesEmulation::getNumberOfWrites() {
+  return numberOfWrites;
+}
+
+void GaugesEmulation::resetCounters() {
+  numberOfReads = 0;
+  numberOfWrites = 0;
+}
+
+BOOL execute_calculator_code(PCSTRINGZ, FLOAT64*, SINT32*, PCSTRINGZ*) {
+  return TRUE;
+}
+
+void register_key_event_handler(GAUGE_KEY_EVENT_HANDLER, PVOID) {}
+
+void unregister_key_event_handler(GAUGE_KEY_EVENT_HANDLER, PVOID) {}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+class GaugesEmulation {
+ public:
+  GaugesEmulation() = delete;
+  ~GaugesEmulation() = delete;
+
+  // artificial cost of every native call to emulate the boundary between module and simulator
+  static void setCallCost(uint32_t nanoseconds);
+
+  static uint64_t getNumberOfReads();
+  static uint64_t getNumberOfWrites();
+  static void resetCounters();
+};
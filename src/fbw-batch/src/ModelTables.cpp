@@ -0,0 +1,903 @@
+// This file is generated by generate-tables.js, do not edit it manually!
+
+#include "ModelTables.h"
+
+#include <cstddef>
+
+#include "FlyByWire.h"
+#include "Autothrust.h"
+#include "ThrustLimits.h"
+
+const ParameterEntry FlyByWireParameterTable[] = {
+    {"ScheduledGain_BreakpointsForDimension1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_BreakpointsForDimension1), 4},
+    {"ScheduledGain_BreakpointsForDimension1_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_BreakpointsForDimension1_c), 5},
+    {"ScheduledGain_BreakpointsForDimension1_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_BreakpointsForDimension1_j), 5},
+    {"ScheduledGain_BreakpointsForDimension1_a", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_BreakpointsForDimension1_a), 7},
+    {"ScheduledGain1_BreakpointsForDimension1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain1_BreakpointsForDimension1), 7},
+    {"ScheduledGain_BreakpointsForDimension1_jh", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_BreakpointsForDimension1_jh), 4},
+    {"ScheduledGain_BreakpointsForDimension1_cf", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_BreakpointsForDimension1_cf), 9},
+    {"ScheduledGain1_BreakpointsForDimension1_a", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain1_BreakpointsForDimension1_a), 5},
+    {"LagFilter_C1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LagFilter_C1), 1},
+    {"LagFilter_C1_a", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LagFilter_C1_a), 1},
+    {"LagFilter_C1_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LagFilter_C1_n), 1},
+    {"LagFilter_C1_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LagFilter_C1_i), 1},
+    {"Subsystem2_C1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Subsystem2_C1), 1},
+    {"Subsystem_C1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Subsystem_C1), 1},
+    {"LagFilter1_C1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LagFilter1_C1), 1},
+    {"WashoutFilter_C1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, WashoutFilter_C1), 1},
+    {"Subsystem1_C1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Subsystem1_C1), 1},
+    {"Subsystem3_C1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Subsystem3_C1), 1},
+    {"LagFilter_C1_h", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LagFilter_C1_h), 1},
+    {"WashoutFilter_C1_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, WashoutFilter_C1_e), 1},
+    {"LagFilter1_C1_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LagFilter1_C1_j), 1},
+    {"LagFilter2_C1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LagFilter2_C1), 1},
+    {"LagFilter3_C1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LagFilter3_C1), 1},
+    {"LagFilter_C1_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LagFilter_C1_e), 1},
+    {"DiscreteDerivativeVariableTs_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs_Gain), 1},
+    {"DiscreteDerivativeVariableTs_Gain_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs_Gain_c), 1},
+    {"DiscreteDerivativeVariableTs_Gain_b", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs_Gain_b), 1},
+    {"DiscreteTimeIntegratorVariableTs_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs_Gain), 1},
+    {"Subsystem2_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Subsystem2_Gain), 1},
+    {"Subsystem_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Subsystem_Gain), 1},
+    {"Subsystem1_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Subsystem1_Gain), 1},
+    {"Subsystem3_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Subsystem3_Gain), 1},
+    {"DiscreteDerivativeVariableTs1_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs1_Gain), 1},
+    {"DiscreteDerivativeVariableTs_Gain_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs_Gain_e), 1},
+    {"DiscreteDerivativeVariableTs2_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs2_Gain), 1},
+    {"DiscreteTimeIntegratorVariableTs_Gain_k", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs_Gain_k), 1},
+    {"DiscreteTimeIntegratorVariableTsLimit_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTsLimit_Gain), 1},
+    {"DiscreteTimeIntegratorVariableTs_Gain_m", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs_Gain_m), 1},
+    {"DiscreteTimeIntegratorVariableTs1_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs1_Gain), 1},
+    {"RateLimiterVariableTs2_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs2_InitialCondition), 1},
+    {"RateLimiterVariableTs3_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs3_InitialCondition), 1},
+    {"RateLimiterVariableTs_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_InitialCondition), 1},
+    {"RateLimiterVariableTs1_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_InitialCondition), 1},
+    {"DiscreteDerivativeVariableTs_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs_InitialCondition), 1},
+    {"RateLimiterVariableTs_InitialCondition_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_InitialCondition_d), 1},
+    {"RateLimiterVariableTs1_InitialCondition_h", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_InitialCondition_h), 1},
+    {"RateLimiterVariableTs2_InitialCondition_b", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs2_InitialCondition_b), 1},
+    {"RateLimiterVariableTs3_InitialCondition_b", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs3_InitialCondition_b), 1},
+    {"RateLimiterDynamicVariableTs_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterDynamicVariableTs_InitialCondition), 1},
+    {"RateLimiterVariableTs_InitialCondition_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_InitialCondition_n), 1},
+    {"DiscreteDerivativeVariableTs_InitialCondition_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs_InitialCondition_d), 1},
+    {"DiscreteDerivativeVariableTs_InitialCondition_k", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs_InitialCondition_k), 1},
+    {"RateLimiterVariableTs3_InitialCondition_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs3_InitialCondition_e), 1},
+    {"RateLimiterVariableTs1_InitialCondition_hb", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_InitialCondition_hb), 1},
+    {"RateLimiterVariableTs6_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs6_InitialCondition), 1},
+    {"RateLimiterVariableTs_InitialCondition_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_InitialCondition_c), 1},
+    {"DiscreteDerivativeVariableTs2_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs2_InitialCondition), 1},
+    {"DiscreteDerivativeVariableTs2_InitialCondition_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs2_InitialCondition_c), 1},
+    {"RateLimiterVariableTs4_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs4_InitialCondition), 1},
+    {"RateLimiterVariableTs2_InitialCondition_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs2_InitialCondition_j), 1},
+    {"DiscreteDerivativeVariableTs2_InitialCondition_cx", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs2_InitialCondition_cx), 1},
+    {"DiscreteDerivativeVariableTs2_InitialCondition_b", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs2_InitialCondition_b), 1},
+    {"RateLimiterVariableTs5_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs5_InitialCondition), 1},
+    {"DiscreteDerivativeVariableTs1_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs1_InitialCondition), 1},
+    {"DiscreteDerivativeVariableTs_InitialCondition_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs_InitialCondition_c), 1},
+    {"DiscreteDerivativeVariableTs2_InitialCondition_h", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteDerivativeVariableTs2_InitialCondition_h), 1},
+    {"RateLimiterDynamicVariableTs_InitialCondition_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterDynamicVariableTs_InitialCondition_i), 1},
+    {"RateLimiterVariableTs_InitialCondition_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_InitialCondition_f), 1},
+    {"RateLimiterVariableTs_InitialCondition_m", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_InitialCondition_m), 1},
+    {"RateLimiterVariableTs_InitialCondition_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_InitialCondition_j), 1},
+    {"RateLimiterVariableTs1_InitialCondition_m", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_InitialCondition_m), 1},
+    {"RateLimiterVariableTs_InitialCondition_fa", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_InitialCondition_fa), 1},
+    {"RateLimiterDynamicVariableTs_InitialCondition_b", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterDynamicVariableTs_InitialCondition_b), 1},
+    {"RateLimitereta_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimitereta_InitialCondition), 1},
+    {"RateLimiterxi_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterxi_InitialCondition), 1},
+    {"RateLimiterzeta_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterzeta_InitialCondition), 1},
+    {"RateLimiterVariableTs1_InitialCondition_o", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_InitialCondition_o), 1},
+    {"DiscreteTimeIntegratorVariableTs_LowerLimit", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs_LowerLimit), 1},
+    {"DiscreteTimeIntegratorVariableTs_LowerLimit_b", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs_LowerLimit_b), 1},
+    {"DiscreteTimeIntegratorVariableTs_LowerLimit_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs_LowerLimit_c), 1},
+    {"DiscreteTimeIntegratorVariableTs1_LowerLimit", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs1_LowerLimit), 1},
+    {"ScheduledGain_Table", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_Table), 4},
+    {"ScheduledGain_Table_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_Table_p), 5},
+    {"ScheduledGain_Table_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_Table_i), 5},
+    {"ScheduledGain_Table_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_Table_e), 7},
+    {"ScheduledGain1_Table", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain1_Table), 7},
+    {"ScheduledGain_Table_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_Table_c), 4},
+    {"ScheduledGain_Table_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain_Table_d), 9},
+    {"ScheduledGain1_Table_o", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, ScheduledGain1_Table_o), 5},
+    {"DiscreteTimeIntegratorVariableTs_UpperLimit", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs_UpperLimit), 1},
+    {"DiscreteTimeIntegratorVariableTs_UpperLimit_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs_UpperLimit_c), 1},
+    {"DiscreteTimeIntegratorVariableTs_UpperLimit_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs_UpperLimit_n), 1},
+    {"DiscreteTimeIntegratorVariableTs1_UpperLimit", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DiscreteTimeIntegratorVariableTs1_UpperLimit), 1},
+    {"CompareToConstant_const", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, CompareToConstant_const), 1},
+    {"CompareToConstant_const_o", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, CompareToConstant_const_o), 1},
+    {"RateLimiterVariableTs2_lo", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs2_lo), 1},
+    {"RateLimiterVariableTs3_lo", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs3_lo), 1},
+    {"RateLimiterVariableTs_lo", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_lo), 1},
+    {"RateLimiterVariableTs1_lo", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_lo), 1},
+    {"RateLimiterVariableTs_lo_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_lo_c), 1},
+    {"RateLimiterVariableTs1_lo_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_lo_c), 1},
+    {"RateLimiterVariableTs2_lo_m", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs2_lo_m), 1},
+    {"RateLimiterVariableTs3_lo_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs3_lo_l), 1},
+    {"RateLimiterVariableTs_lo_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_lo_d), 1},
+    {"RateLimiterVariableTs3_lo_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs3_lo_e), 1},
+    {"RateLimiterVariableTs1_lo_h", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_lo_h), 1},
+    {"RateLimiterVariableTs6_lo", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs6_lo), 1},
+    {"RateLimiterVariableTs_lo_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_lo_f), 1},
+    {"RateLimiterVariableTs4_lo", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs4_lo), 1},
+    {"RateLimiterVariableTs2_lo_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs2_lo_n), 1},
+    {"RateLimiterVariableTs5_lo", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs5_lo), 1},
+    {"RateLimiterVariableTs_lo_fs", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_lo_fs), 1},
+    {"RateLimiterVariableTs_lo_k", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_lo_k), 1},
+    {"RateLimiterVariableTs_lo_g", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_lo_g), 1},
+    {"RateLimiterVariableTs1_lo_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_lo_n), 1},
+    {"RateLimiterVariableTs_lo_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_lo_e), 1},
+    {"RateLimitereta_lo", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimitereta_lo), 1},
+    {"RateLimiterxi_lo", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterxi_lo), 1},
+    {"RateLimiterzeta_lo", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterzeta_lo), 1},
+    {"RateLimiterVariableTs1_lo_cu", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_lo_cu), 1},
+    {"RateLimiterVariableTs2_up", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs2_up), 1},
+    {"RateLimiterVariableTs3_up", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs3_up), 1},
+    {"RateLimiterVariableTs_up", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_up), 1},
+    {"RateLimiterVariableTs1_up", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_up), 1},
+    {"RateLimiterVariableTs_up_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_up_d), 1},
+    {"RateLimiterVariableTs1_up_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_up_n), 1},
+    {"RateLimiterVariableTs2_up_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs2_up_f), 1},
+    {"RateLimiterVariableTs3_up_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs3_up_c), 1},
+    {"RateLimiterVariableTs_up_dl", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_up_dl), 1},
+    {"RateLimiterVariableTs3_up_m", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs3_up_m), 1},
+    {"RateLimiterVariableTs1_up_k", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_up_k), 1},
+    {"RateLimiterVariableTs6_up", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs6_up), 1},
+    {"RateLimiterVariableTs_up_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_up_f), 1},
+    {"RateLimiterVariableTs4_up", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs4_up), 1},
+    {"RateLimiterVariableTs2_up_b", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs2_up_b), 1},
+    {"RateLimiterVariableTs5_up", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs5_up), 1},
+    {"RateLimiterVariableTs_up_k", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_up_k), 1},
+    {"RateLimiterVariableTs_up_m", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_up_m), 1},
+    {"RateLimiterVariableTs_up_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_up_i), 1},
+    {"RateLimiterVariableTs1_up_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_up_j), 1},
+    {"RateLimiterVariableTs_up_f1", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs_up_f1), 1},
+    {"RateLimitereta_up", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimitereta_up), 1},
+    {"RateLimiterxi_up", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterxi_up), 1},
+    {"RateLimiterzeta_up", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterzeta_up), 1},
+    {"RateLimiterVariableTs1_up_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, RateLimiterVariableTs1_up_p), 1},
+    {"Constant_Value", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value), 1},
+    {"Gain4_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain4_Gain), 1},
+    {"qk_dot_gain1_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, qk_dot_gain1_Gain), 1},
+    {"qk_gain_HSP_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, qk_gain_HSP_Gain), 1},
+    {"v_dot_gain_HSP_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, v_dot_gain_HSP_Gain), 1},
+    {"Gain6_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain6_Gain), 1},
+    {"precontrol_gain_HSP_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, precontrol_gain_HSP_Gain), 1},
+    {"HSP_gain_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, HSP_gain_Gain), 1},
+    {"Saturation4_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation4_UpperSat), 1},
+    {"Saturation4_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation4_LowerSat), 1},
+    {"Saturation8_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation8_UpperSat), 1},
+    {"Saturation8_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation8_LowerSat), 1},
+    {"Theta_max3_Value", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Theta_max3_Value), 1},
+    {"Gain3_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain3_Gain), 1},
+    {"Saturation2_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation2_UpperSat), 1},
+    {"Saturation2_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation2_LowerSat), 1},
+    {"Loaddemand2_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Loaddemand2_tableData), 3},
+    {"Loaddemand2_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Loaddemand2_bp01Data), 3},
+    {"Constant1_Value", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant1_Value), 1},
+    {"Gain_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain), 1},
+    {"Saturation_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat), 1},
+    {"Saturation_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat), 1},
+    {"Constant_Value_m", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_m), 1},
+    {"Gain1_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain), 1},
+    {"Loaddemand_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Loaddemand_tableData), 3},
+    {"Loaddemand_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Loaddemand_bp01Data), 3},
+    {"Constant_Value_k", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_k), 1},
+    {"Saturation_UpperSat_o", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_o), 1},
+    {"Saturation_LowerSat_k", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_k), 1},
+    {"Switch2_Threshold", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch2_Threshold), 1},
+    {"Switch_Threshold", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch_Threshold), 1},
+    {"Gain2_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain2_Gain), 1},
+    {"Saturation1_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_UpperSat), 1},
+    {"Saturation1_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_LowerSat), 1},
+    {"Loaddemand1_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Loaddemand1_tableData), 3},
+    {"Loaddemand1_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Loaddemand1_bp01Data), 3},
+    {"Saturation_UpperSat_g", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_g), 1},
+    {"Saturation_LowerSat_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_p), 1},
+    {"Constant1_Value_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant1_Value_i), 1},
+    {"Constant2_Value", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant2_Value), 1},
+    {"Constant3_Value", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant3_Value), 1},
+    {"Gain2_Gain_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain2_Gain_n), 1},
+    {"BankAngleProtection2_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, BankAngleProtection2_tableData), 5},
+    {"BankAngleProtection2_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, BankAngleProtection2_bp01Data), 5},
+    {"BankAngleProtection_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, BankAngleProtection_tableData), 9},
+    {"BankAngleProtection_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, BankAngleProtection_bp01Data), 9},
+    {"BankAngleProtection1_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, BankAngleProtection1_tableData), 9},
+    {"BankAngleProtection1_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, BankAngleProtection1_bp01Data), 9},
+    {"Switch2_Threshold_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch2_Threshold_i), 1},
+    {"Switch1_Threshold", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch1_Threshold), 1},
+    {"Constant2_Value_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant2_Value_d), 1},
+    {"Constant_Value_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_j), 1},
+    {"Delay_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Delay_InitialCondition), 1},
+    {"GainTheta_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, GainTheta_Gain), 1},
+    {"GainPhi_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, GainPhi_Gain), 1},
+    {"Gain_Gain_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_n), 1},
+    {"Gainqk_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainqk_Gain), 1},
+    {"Gain_Gain_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_l), 1},
+    {"Gain_Gain_a", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_a), 1},
+    {"Gainpk_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainpk_Gain), 1},
+    {"Gain_Gain_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_e), 1},
+    {"Gainqk1_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainqk1_Gain), 1},
+    {"Gain_Gain_aw", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_aw), 1},
+    {"Gain_Gain_nm", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_nm), 1},
+    {"Gainpk1_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainpk1_Gain), 1},
+    {"Gainpk4_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainpk4_Gain), 1},
+    {"Gainpk2_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainpk2_Gain), 1},
+    {"Gainpk5_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainpk5_Gain), 1},
+    {"Gainpk6_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainpk6_Gain), 1},
+    {"Gainpk3_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainpk3_Gain), 1},
+    {"Gain_Gain_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_i), 1},
+    {"Constant_Value_g", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_g), 1},
+    {"Saturation_UpperSat_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_e), 1},
+    {"Saturation_LowerSat_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_e), 1},
+    {"Gain1_Gain_h", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_h), 1},
+    {"Saturation1_UpperSat_g", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_UpperSat_g), 1},
+    {"Saturation1_LowerSat_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_LowerSat_j), 1},
+    {"Gain2_Gain_a", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain2_Gain_a), 1},
+    {"Saturation2_UpperSat_b", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation2_UpperSat_b), 1},
+    {"Saturation2_LowerSat_g", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation2_LowerSat_g), 1},
+    {"Gaineta_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gaineta_Gain), 1},
+    {"Gainxi_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainxi_Gain), 1},
+    {"Gainxi1_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainxi1_Gain), 1},
+    {"alphamax_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alphamax_tableData), 24},
+    {"alphamax_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alphamax_bp01Data), 4},
+    {"alphamax_bp02Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alphamax_bp02Data), 6},
+    {"alpha0_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alpha0_tableData), 6},
+    {"alpha0_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alpha0_bp01Data), 6},
+    {"alphaprotection_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alphaprotection_tableData), 24},
+    {"alphaprotection_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alphaprotection_bp01Data), 4},
+    {"alphaprotection_bp02Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alphaprotection_bp02Data), 6},
+    {"alphafloor_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alphafloor_tableData), 24},
+    {"alphafloor_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alphafloor_bp01Data), 4},
+    {"alphafloor_bp02Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alphafloor_bp02Data), 6},
+    {"Constant5_Value", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant5_Value), 1},
+    {"Constant6_Value", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant6_Value), 1},
+    {"Gain1_Gain_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_c), 1},
+    {"uDLookupTable1_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable1_tableData), 4},
+    {"uDLookupTable1_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable1_bp01Data), 4},
+    {"uDLookupTable2_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable2_tableData), 4},
+    {"uDLookupTable2_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable2_bp01Data), 4},
+    {"uDLookupTable_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable_tableData), 4},
+    {"uDLookupTable_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable_bp01Data), 4},
+    {"Constant7_Value", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant7_Value), 1},
+    {"Constant8_Value", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant8_Value), 1},
+    {"Switch_Threshold_h", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch_Threshold_h), 1},
+    {"Switch1_Threshold_k", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch1_Threshold_k), 1},
+    {"Gain_Gain_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_d), 1},
+    {"Saturation_UpperSat_er", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_er), 1},
+    {"Saturation_LowerSat_a", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_a), 1},
+    {"Constant1_Value_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant1_Value_f), 1},
+    {"Constant_Value_jz", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_jz), 1},
+    {"Saturation1_UpperSat_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_UpperSat_f), 1},
+    {"Saturation1_LowerSat_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_LowerSat_p), 1},
+    {"Constant2_Value_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant2_Value_l), 1},
+    {"uDLookupTable_tableData_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable_tableData_d), 25},
+    {"uDLookupTable_bp01Data_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable_bp01Data_l), 5},
+    {"uDLookupTable_bp02Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable_bp02Data), 5},
+    {"Saturation3_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation3_UpperSat), 1},
+    {"Saturation3_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation3_LowerSat), 1},
+    {"PitchRateDemand_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, PitchRateDemand_tableData), 3},
+    {"PitchRateDemand_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, PitchRateDemand_bp01Data), 3},
+    {"Gain3_Gain_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain3_Gain_p), 1},
+    {"Gain_Gain_h", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_h), 1},
+    {"Gain1_Gain_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_i), 1},
+    {"Gain1_Gain_a", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_a), 1},
+    {"Gain5_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain5_Gain), 1},
+    {"Gain4_Gain_g", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain4_Gain_g), 1},
+    {"Gain6_Gain_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain6_Gain_f), 1},
+    {"Constant_Value_h", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_h), 1},
+    {"Switch_Threshold_he", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch_Threshold_he), 1},
+    {"Gain1_Gain_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_p), 1},
+    {"Gain1_Gain_pa", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_pa), 1},
+    {"Gain1_Gain_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_j), 1},
+    {"Vm_currentms_Value", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Vm_currentms_Value), 1},
+    {"Gain_Gain_dc", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_dc), 1},
+    {"Saturation_UpperSat_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_d), 1},
+    {"Saturation_LowerSat_pr", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_pr), 1},
+    {"Gain1_Gain_b", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_b), 1},
+    {"Delay_InitialCondition_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Delay_InitialCondition_j), 1},
+    {"Constant_Value_m3", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_m3), 1},
+    {"Delay1_InitialCondition", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Delay1_InitialCondition), 1},
+    {"Delay_InitialCondition_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Delay_InitialCondition_l), 1},
+    {"Constant_Value_hz", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_hz), 1},
+    {"Delay1_InitialCondition_a", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Delay1_InitialCondition_a), 1},
+    {"Switch1_Threshold_ke", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch1_Threshold_ke), 1},
+    {"Delay_InitialCondition_k", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Delay_InitialCondition_k), 1},
+    {"Constant_Value_kr", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_kr), 1},
+    {"Delay1_InitialCondition_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Delay1_InitialCondition_i), 1},
+    {"precontrol_gain_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, precontrol_gain_Gain), 1},
+    {"alpha_err_gain_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, alpha_err_gain_Gain), 1},
+    {"Delay_InitialCondition_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Delay_InitialCondition_p), 1},
+    {"Constant_Value_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_c), 1},
+    {"Delay1_InitialCondition_k", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Delay1_InitialCondition_k), 1},
+    {"v_dot_gain_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, v_dot_gain_Gain), 1},
+    {"qk_gain_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, qk_gain_Gain), 1},
+    {"qk_dot_gain_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, qk_dot_gain_Gain), 1},
+    {"Saturation3_UpperSat_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation3_UpperSat_c), 1},
+    {"Saturation3_LowerSat_h", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation3_LowerSat_h), 1},
+    {"Saturation_UpperSat_a", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_a), 1},
+    {"Saturation_LowerSat_ps", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_ps), 1},
+    {"Constant_Value_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_p), 1},
+    {"Gain3_Gain_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain3_Gain_l), 1},
+    {"uDLookupTable_tableData_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable_tableData_l), 7},
+    {"uDLookupTable_bp01Data_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable_bp01Data_j), 7},
+    {"Saturation3_UpperSat_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation3_UpperSat_p), 1},
+    {"Saturation3_LowerSat_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation3_LowerSat_i), 1},
+    {"Gain5_Gain_g", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain5_Gain_g), 1},
+    {"Bias_Bias", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Bias_Bias), 1},
+    {"PLUT_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, PLUT_tableData), 2},
+    {"PLUT_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, PLUT_bp01Data), 2},
+    {"DLUT_tableData", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DLUT_tableData), 2},
+    {"DLUT_bp01Data", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, DLUT_bp01Data), 2},
+    {"SaturationV_dot_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, SaturationV_dot_UpperSat), 1},
+    {"SaturationV_dot_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, SaturationV_dot_LowerSat), 1},
+    {"Gain_Gain_o", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_o), 1},
+    {"SaturationSpoilers_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, SaturationSpoilers_UpperSat), 1},
+    {"SaturationSpoilers_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, SaturationSpoilers_LowerSat), 1},
+    {"Saturation_UpperSat_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_j), 1},
+    {"Saturation_LowerSat_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_c), 1},
+    {"Switch_Threshold_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch_Threshold_d), 1},
+    {"Saturation_UpperSat_g4", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_g4), 1},
+    {"Saturation_LowerSat_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_l), 1},
+    {"Constant_Value_o", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_o), 1},
+    {"Saturation_UpperSat_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_c), 1},
+    {"Saturation_LowerSat_m", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_m), 1},
+    {"Constant_Value_ju", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_ju), 1},
+    {"Gain_Gain_ip", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_ip), 1},
+    {"Gain_Gain_c", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_c), 1},
+    {"uDLookupTable_tableData_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable_tableData_f), 4},
+    {"uDLookupTable_bp01Data_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, uDLookupTable_bp01Data_f), 4},
+    {"Gain1_Gain_jh", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_jh), 1},
+    {"Saturation_UpperSat_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_p), 1},
+    {"Saturation_LowerSat_h", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_h), 1},
+    {"Gain4_Gain_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain4_Gain_f), 1},
+    {"Saturation_UpperSat_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_l), 1},
+    {"Saturation_LowerSat_cj", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_cj), 1},
+    {"Gain5_Gain_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain5_Gain_l), 1},
+    {"Saturation1_UpperSat_fa", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_UpperSat_fa), 1},
+    {"Saturation1_LowerSat_o", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_LowerSat_o), 1},
+    {"Gain_Gain_oq", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_oq), 1},
+    {"Gain1_Gain_bq", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_bq), 1},
+    {"Switch3_Threshold", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch3_Threshold), 1},
+    {"Saturation_UpperSat_as", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_as), 1},
+    {"Saturation_LowerSat_o", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_o), 1},
+    {"Delay_InitialCondition_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Delay_InitialCondition_d), 1},
+    {"Saturation_UpperSat_gn", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_gn), 1},
+    {"Saturation_LowerSat_en", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_en), 1},
+    {"Switch_Threshold_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch_Threshold_j), 1},
+    {"Gain1_Gain_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_n), 1},
+    {"Gain1_Gain_bqd", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_bqd), 1},
+    {"Gain1_Gain_cb", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_cb), 1},
+    {"Gain_Gain_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_p), 1},
+    {"Constant2_Value_p", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant2_Value_p), 1},
+    {"Gain1_Gain_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_f), 1},
+    {"Gain1_Gain_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain1_Gain_l), 1},
+    {"Saturation_UpperSat_ek", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_ek), 1},
+    {"Saturation_LowerSat_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_j), 1},
+    {"Gain6_Gain_k", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain6_Gain_k), 1},
+    {"Gain_Gain_i3", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain_Gain_i3), 1},
+    {"Saturation1_UpperSat_j", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_UpperSat_j), 1},
+    {"Saturation1_LowerSat_a", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_LowerSat_a), 1},
+    {"Saturation_UpperSat_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_n), 1},
+    {"Saturation_LowerSat_b", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_b), 1},
+    {"Constant_Value_ku", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_ku), 1},
+    {"Saturation2_UpperSat_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation2_UpperSat_n), 1},
+    {"Saturation2_LowerSat_a", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation2_LowerSat_a), 1},
+    {"Saturation_UpperSat_cr", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_cr), 1},
+    {"Saturation_LowerSat_o4", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_o4), 1},
+    {"Constant_Value_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_i), 1},
+    {"Switch2_Threshold_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Switch2_Threshold_n), 1},
+    {"Saturation_UpperSat_p4", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_p4), 1},
+    {"Saturation_LowerSat_he", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_he), 1},
+    {"Saturation1_UpperSat_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_UpperSat_e), 1},
+    {"Saturation1_LowerSat_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation1_LowerSat_l), 1},
+    {"Saturation_UpperSat_ll", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_ll), 1},
+    {"Saturation_LowerSat_og", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_og), 1},
+    {"Constant_Value_l", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_l), 1},
+    {"Saturation_UpperSat_eq", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_eq), 1},
+    {"Saturation_LowerSat_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_n), 1},
+    {"Saturation_UpperSat_i", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_UpperSat_i), 1},
+    {"Saturation_LowerSat_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Saturation_LowerSat_f), 1},
+    {"Constant_Value_f", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_f), 1},
+    {"Gain4_Gain_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gain4_Gain_e), 1},
+    {"Constant_Value_li", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant_Value_li), 1},
+    {"Constant1_Value_h", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Constant1_Value_h), 1},
+    {"Gaineta_Gain_d", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gaineta_Gain_d), 1},
+    {"Limitereta_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Limitereta_UpperSat), 1},
+    {"Limitereta_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Limitereta_LowerSat), 1},
+    {"GainiH_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, GainiH_Gain), 1},
+    {"LimiteriH_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LimiteriH_UpperSat), 1},
+    {"LimiteriH_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, LimiteriH_LowerSat), 1},
+    {"Gainxi_Gain_n", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainxi_Gain_n), 1},
+    {"Limiterxi_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Limiterxi_UpperSat), 1},
+    {"Limiterxi_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Limiterxi_LowerSat), 1},
+    {"Gainxi1_Gain_e", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainxi1_Gain_e), 1},
+    {"Limiterxi1_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Limiterxi1_UpperSat), 1},
+    {"Limiterxi1_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Limiterxi1_LowerSat), 1},
+    {"Gainxi2_Gain", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Gainxi2_Gain), 1},
+    {"Limiterxi2_UpperSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Limiterxi2_UpperSat), 1},
+    {"Limiterxi2_LowerSat", offsetof(FlyByWireModelClass::Parameters_FlyByWire_T, Limiterxi2_LowerSat), 1},
+};
+const size_t FlyByWireParameterTableSize = sizeof(FlyByWireParameterTable) / sizeof(ParameterEntry);
+
+const OutputEntry FlyByWireOutputTable[] = {
+    {"sim.time.dt", offsetof(fbw_output, sim.time.dt), ValueType::REAL},
+    {"sim.time.simulation_time", offsetof(fbw_output, sim.time.simulation_time), ValueType::REAL},
+    {"sim.time.monotonic_time", offsetof(fbw_output, sim.time.monotonic_time), ValueType::REAL},
+    {"sim.data.nz_g", offsetof(fbw_output, sim.data.nz_g), ValueType::REAL},
+    {"sim.data.Theta_deg", offsetof(fbw_output, sim.data.Theta_deg), ValueType::REAL},
+    {"sim.data.Phi_deg", offsetof(fbw_output, sim.data.Phi_deg), ValueType::REAL},
+    {"sim.data.q_deg_s", offsetof(fbw_output, sim.data.q_deg_s), ValueType::REAL},
+    {"sim.data.r_deg_s", offsetof(fbw_output, sim.data.r_deg_s), ValueType::REAL},
+    {"sim.data.p_deg_s", offsetof(fbw_output, sim.data.p_deg_s), ValueType::REAL},
+    {"sim.data.qk_deg_s", offsetof(fbw_output, sim.data.qk_deg_s), ValueType::REAL},
+    {"sim.data.rk_deg_s", offsetof(fbw_output, sim.data.rk_deg_s), ValueType::REAL},
+    {"sim.data.pk_deg_s", offsetof(fbw_output, sim.data.pk_deg_s), ValueType::REAL},
+    {"sim.data.qk_dot_deg_s2", offsetof(fbw_output, sim.data.qk_dot_deg_s2), ValueType::REAL},
+    {"sim.data.rk_dot_deg_s2", offsetof(fbw_output, sim.data.rk_dot_deg_s2), ValueType::REAL},
+    {"sim.data.pk_dot_deg_s2", offsetof(fbw_output, sim.data.pk_dot_deg_s2), ValueType::REAL},
+    {"sim.data.psi_magnetic_deg", offsetof(fbw_output, sim.data.psi_magnetic_deg), ValueType::REAL},
+    {"sim.data.psi_true_deg", offsetof(fbw_output, sim.data.psi_true_deg), ValueType::REAL},
+    {"sim.data.eta_deg", offsetof(fbw_output, sim.data.eta_deg), ValueType::REAL},
+    {"sim.data.eta_trim_deg", offsetof(fbw_output, sim.data.eta_trim_deg), ValueType::REAL},
+    {"sim.data.xi_deg", offsetof(fbw_output, sim.data.xi_deg), ValueType::REAL},
+    {"sim.data.zeta_deg", offsetof(fbw_output, sim.data.zeta_deg), ValueType::REAL},
+    {"sim.data.zeta_trim_deg", offsetof(fbw_output, sim.data.zeta_trim_deg), ValueType::REAL},
+    {"sim.data.alpha_deg", offsetof(fbw_output, sim.data.alpha_deg), ValueType::REAL},
+    {"sim.data.beta_deg", offsetof(fbw_output, sim.data.beta_deg), ValueType::REAL},
+    {"sim.data.beta_dot_deg_s", offsetof(fbw_output, sim.data.beta_dot_deg_s), ValueType::REAL},
+    {"sim.data.V_ias_kn", offsetof(fbw_output, sim.data.V_ias_kn), ValueType::REAL},
+    {"sim.data.V_tas_kn", offsetof(fbw_output, sim.data.V_tas_kn), ValueType::REAL},
+    {"sim.data.V_mach", offsetof(fbw_output, sim.data.V_mach), ValueType::REAL},
+    {"sim.data.H_ft", offsetof(fbw_output, sim.data.H_ft), ValueType::REAL},
+    {"sim.data.H_ind_ft", offsetof(fbw_output, sim.data.H_ind_ft), ValueType::REAL},
+    {"sim.data.H_radio_ft", offsetof(fbw_output, sim.data.H_radio_ft), ValueType::REAL},
+    {"sim.data.CG_percent_MAC", offsetof(fbw_output, sim.data.CG_percent_MAC), ValueType::REAL},
+    {"sim.data.total_weight_kg", offsetof(fbw_output, sim.data.total_weight_kg), ValueType::REAL},
+    {"sim.data.gear_strut_compression_0", offsetof(fbw_output, sim.data.gear_strut_compression_0), ValueType::REAL},
+    {"sim.data.gear_strut_compression_1", offsetof(fbw_output, sim.data.gear_strut_compression_1), ValueType::REAL},
+    {"sim.data.gear_strut_compression_2", offsetof(fbw_output, sim.data.gear_strut_compression_2), ValueType::REAL},
+    {"sim.data.flaps_handle_index", offsetof(fbw_output, sim.data.flaps_handle_index), ValueType::REAL},
+    {"sim.data.spoilers_left_pos", offsetof(fbw_output, sim.data.spoilers_left_pos), ValueType::REAL},
+    {"sim.data.spoilers_right_pos", offsetof(fbw_output, sim.data.spoilers_right_pos), ValueType::REAL},
+    {"sim.data.autopilot_master_on", offsetof(fbw_output, sim.data.autopilot_master_on), ValueType::REAL},
+    {"sim.data.slew_on", offsetof(fbw_output, sim.data.slew_on), ValueType::REAL},
+    {"sim.data.pause_on", offsetof(fbw_output, sim.data.pause_on), ValueType::REAL},
+    {"sim.data.tracking_mode_on_override", offsetof(fbw_output, sim.data.tracking_mode_on_override), ValueType::REAL},
+    {"sim.data.autopilot_custom_on", offsetof(fbw_output, sim.data.autopilot_custom_on), ValueType::REAL},
+    {"sim.data.autopilot_custom_Theta_c_deg", offsetof(fbw_output, sim.data.autopilot_custom_Theta_c_deg), ValueType::REAL},
+    {"sim.data.autopilot_custom_Phi_c_deg", offsetof(fbw_output, sim.data.autopilot_custom_Phi_c_deg), ValueType::REAL},
+    {"sim.data.autopilot_custom_Beta_c_deg", offsetof(fbw_output, sim.data.autopilot_custom_Beta_c_deg), ValueType::REAL},
+    {"sim.data.simulation_rate", offsetof(fbw_output, sim.data.simulation_rate), ValueType::REAL},
+    {"sim.data.ice_structure_percent", offsetof(fbw_output, sim.data.ice_structure_percent), ValueType::REAL},
+    {"sim.data.linear_cl_alpha_per_deg", offsetof(fbw_output, sim.data.linear_cl_alpha_per_deg), ValueType::REAL},
+    {"sim.data.alpha_stall_deg", offsetof(fbw_output, sim.data.alpha_stall_deg), ValueType::REAL},
+    {"sim.data.alpha_zero_lift_deg", offsetof(fbw_output, sim.data.alpha_zero_lift_deg), ValueType::REAL},
+    {"sim.data.ambient_density_kg_per_m3", offsetof(fbw_output, sim.data.ambient_density_kg_per_m3), ValueType::REAL},
+    {"sim.data.ambient_pressure_mbar", offsetof(fbw_output, sim.data.ambient_pressure_mbar), ValueType::REAL},
+    {"sim.data.ambient_temperature_celsius", offsetof(fbw_output, sim.data.ambient_temperature_celsius), ValueType::REAL},
+    {"sim.data.ambient_wind_x_kn", offsetof(fbw_output, sim.data.ambient_wind_x_kn), ValueType::REAL},
+    {"sim.data.ambient_wind_y_kn", offsetof(fbw_output, sim.data.ambient_wind_y_kn), ValueType::REAL},
+    {"sim.data.ambient_wind_z_kn", offsetof(fbw_output, sim.data.ambient_wind_z_kn), ValueType::REAL},
+    {"sim.data.ambient_wind_velocity_kn", offsetof(fbw_output, sim.data.ambient_wind_velocity_kn), ValueType::REAL},
+    {"sim.data.ambient_wind_direction_deg", offsetof(fbw_output, sim.data.ambient_wind_direction_deg), ValueType::REAL},
+    {"sim.data.total_air_temperature_celsius", offsetof(fbw_output, sim.data.total_air_temperature_celsius), ValueType::REAL},
+    {"sim.data.latitude_deg", offsetof(fbw_output, sim.data.latitude_deg), ValueType::REAL},
+    {"sim.data.longitude_deg", offsetof(fbw_output, sim.data.longitude_deg), ValueType::REAL},
+    {"sim.data.engine_1_thrust_lbf", offsetof(fbw_output, sim.data.engine_1_thrust_lbf), ValueType::REAL},
+    {"sim.data.engine_2_thrust_lbf", offsetof(fbw_output, sim.data.engine_2_thrust_lbf), ValueType::REAL},
+    {"sim.data.thrust_lever_1_pos", offsetof(fbw_output, sim.data.thrust_lever_1_pos), ValueType::REAL},
+    {"sim.data.thrust_lever_2_pos", offsetof(fbw_output, sim.data.thrust_lever_2_pos), ValueType::REAL},
+    {"sim.data.tailstrike_protection_on", offsetof(fbw_output, sim.data.tailstrike_protection_on), ValueType::BOOLEAN},
+    {"sim.data.VLS_kn", offsetof(fbw_output, sim.data.VLS_kn), ValueType::REAL},
+    {"sim.data_computed.on_ground", offsetof(fbw_output, sim.data_computed.on_ground), ValueType::REAL},
+    {"sim.data_computed.tracking_mode_on", offsetof(fbw_output, sim.data_computed.tracking_mode_on), ValueType::REAL},
+    {"sim.data_computed.high_aoa_prot_active", offsetof(fbw_output, sim.data_computed.high_aoa_prot_active), ValueType::REAL},
+    {"sim.data_computed.alpha_floor_command", offsetof(fbw_output, sim.data_computed.alpha_floor_command), ValueType::REAL},
+    {"sim.data_computed.protection_ap_disc", offsetof(fbw_output, sim.data_computed.protection_ap_disc), ValueType::REAL},
+    {"sim.data_computed.high_speed_prot_active", offsetof(fbw_output, sim.data_computed.high_speed_prot_active), ValueType::REAL},
+    {"sim.data_computed.high_speed_prot_low_kn", offsetof(fbw_output, sim.data_computed.high_speed_prot_low_kn), ValueType::REAL},
+    {"sim.data_computed.high_speed_prot_high_kn", offsetof(fbw_output, sim.data_computed.high_speed_prot_high_kn), ValueType::REAL},
+    {"sim.data_speeds_aoa.v_alpha_max_kn", offsetof(fbw_output, sim.data_speeds_aoa.v_alpha_max_kn), ValueType::REAL},
+    {"sim.data_speeds_aoa.alpha_max_deg", offsetof(fbw_output, sim.data_speeds_aoa.alpha_max_deg), ValueType::REAL},
+    {"sim.data_speeds_aoa.v_alpha_prot_kn", offsetof(fbw_output, sim.data_speeds_aoa.v_alpha_prot_kn), ValueType::REAL},
+    {"sim.data_speeds_aoa.alpha_prot_deg", offsetof(fbw_output, sim.data_speeds_aoa.alpha_prot_deg), ValueType::REAL},
+    {"sim.data_speeds_aoa.alpha_floor_deg", offsetof(fbw_output, sim.data_speeds_aoa.alpha_floor_deg), ValueType::REAL},
+    {"sim.data_speeds_aoa.alpha_filtered_deg", offsetof(fbw_output, sim.data_speeds_aoa.alpha_filtered_deg), ValueType::REAL},
+    {"sim.input.delta_eta_pos", offsetof(fbw_output, sim.input.delta_eta_pos), ValueType::REAL},
+    {"sim.input.delta_xi_pos", offsetof(fbw_output, sim.input.delta_xi_pos), ValueType::REAL},
+    {"sim.input.delta_zeta_pos", offsetof(fbw_output, sim.input.delta_zeta_pos), ValueType::REAL},
+    {"pitch.data_computed.eta_trim_deg_limit_lo", offsetof(fbw_output, pitch.data_computed.eta_trim_deg_limit_lo), ValueType::REAL},
+    {"pitch.data_computed.eta_trim_deg_limit_up", offsetof(fbw_output, pitch.data_computed.eta_trim_deg_limit_up), ValueType::REAL},
+    {"pitch.data_computed.delta_eta_deg", offsetof(fbw_output, pitch.data_computed.delta_eta_deg), ValueType::REAL},
+    {"pitch.data_computed.in_flight", offsetof(fbw_output, pitch.data_computed.in_flight), ValueType::REAL},
+    {"pitch.data_computed.in_rotation", offsetof(fbw_output, pitch.data_computed.in_rotation), ValueType::REAL},
+    {"pitch.data_computed.in_flare", offsetof(fbw_output, pitch.data_computed.in_flare), ValueType::REAL},
+    {"pitch.data_computed.in_flight_gain", offsetof(fbw_output, pitch.data_computed.in_flight_gain), ValueType::REAL},
+    {"pitch.data_computed.in_rotation_gain", offsetof(fbw_output, pitch.data_computed.in_rotation_gain), ValueType::REAL},
+    {"pitch.data_computed.nz_limit_up_g", offsetof(fbw_output, pitch.data_computed.nz_limit_up_g), ValueType::REAL},
+    {"pitch.data_computed.nz_limit_lo_g", offsetof(fbw_output, pitch.data_computed.nz_limit_lo_g), ValueType::REAL},
+    {"pitch.data_computed.eta_trim_deg_should_freeze", offsetof(fbw_output, pitch.data_computed.eta_trim_deg_should_freeze), ValueType::BOOLEAN},
+    {"pitch.data_computed.eta_trim_deg_reset", offsetof(fbw_output, pitch.data_computed.eta_trim_deg_reset), ValueType::BOOLEAN},
+    {"pitch.data_computed.eta_trim_deg_reset_deg", offsetof(fbw_output, pitch.data_computed.eta_trim_deg_reset_deg), ValueType::REAL},
+    {"pitch.data_computed.eta_trim_deg_should_write", offsetof(fbw_output, pitch.data_computed.eta_trim_deg_should_write), ValueType::BOOLEAN},
+    {"pitch.data_computed.eta_trim_deg_rate_limit_up_deg_s", offsetof(fbw_output, pitch.data_computed.eta_trim_deg_rate_limit_up_deg_s), ValueType::REAL},
+    {"pitch.data_computed.eta_trim_deg_rate_limit_lo_deg_s", offsetof(fbw_output, pitch.data_computed.eta_trim_deg_rate_limit_lo_deg_s), ValueType::REAL},
+    {"pitch.data_computed.flare_Theta_deg", offsetof(fbw_output, pitch.data_computed.flare_Theta_deg), ValueType::REAL},
+    {"pitch.data_computed.flare_Theta_c_deg", offsetof(fbw_output, pitch.data_computed.flare_Theta_c_deg), ValueType::REAL},
+    {"pitch.data_computed.flare_Theta_c_rate_deg_s", offsetof(fbw_output, pitch.data_computed.flare_Theta_c_rate_deg_s), ValueType::REAL},
+    {"pitch.law_rotation.qk_c_deg_s", offsetof(fbw_output, pitch.law_rotation.qk_c_deg_s), ValueType::REAL},
+    {"pitch.law_rotation.eta_deg", offsetof(fbw_output, pitch.law_rotation.eta_deg), ValueType::REAL},
+    {"pitch.law_normal.nz_c_g", offsetof(fbw_output, pitch.law_normal.nz_c_g), ValueType::REAL},
+    {"pitch.law_normal.Cstar_g", offsetof(fbw_output, pitch.law_normal.Cstar_g), ValueType::REAL},
+    {"pitch.law_normal.protection_alpha_c_deg", offsetof(fbw_output, pitch.law_normal.protection_alpha_c_deg), ValueType::REAL},
+    {"pitch.law_normal.protection_V_c_kn", offsetof(fbw_output, pitch.law_normal.protection_V_c_kn), ValueType::REAL},
+    {"pitch.law_normal.eta_dot_deg_s", offsetof(fbw_output, pitch.law_normal.eta_dot_deg_s), ValueType::REAL},
+    {"pitch.vote.eta_dot_deg_s", offsetof(fbw_output, pitch.vote.eta_dot_deg_s), ValueType::REAL},
+    {"pitch.integrated.eta_deg", offsetof(fbw_output, pitch.integrated.eta_deg), ValueType::REAL},
+    {"pitch.output.eta_deg", offsetof(fbw_output, pitch.output.eta_deg), ValueType::REAL},
+    {"pitch.output.eta_trim_deg", offsetof(fbw_output, pitch.output.eta_trim_deg), ValueType::REAL},
+    {"roll.data_computed.delta_xi_deg", offsetof(fbw_output, roll.data_computed.delta_xi_deg), ValueType::REAL},
+    {"roll.data_computed.delta_zeta_deg", offsetof(fbw_output, roll.data_computed.delta_zeta_deg), ValueType::REAL},
+    {"roll.data_computed.in_flight", offsetof(fbw_output, roll.data_computed.in_flight), ValueType::REAL},
+    {"roll.data_computed.in_flight_gain", offsetof(fbw_output, roll.data_computed.in_flight_gain), ValueType::REAL},
+    {"roll.data_computed.zeta_trim_deg_should_write", offsetof(fbw_output, roll.data_computed.zeta_trim_deg_should_write), ValueType::BOOLEAN},
+    {"roll.data_computed.beta_target_deg", offsetof(fbw_output, roll.data_computed.beta_target_deg), ValueType::REAL},
+    {"roll.law_normal.pk_c_deg_s", offsetof(fbw_output, roll.law_normal.pk_c_deg_s), ValueType::REAL},
+    {"roll.law_normal.Phi_c_deg", offsetof(fbw_output, roll.law_normal.Phi_c_deg), ValueType::REAL},
+    {"roll.law_normal.xi_deg", offsetof(fbw_output, roll.law_normal.xi_deg), ValueType::REAL},
+    {"roll.law_normal.zeta_deg", offsetof(fbw_output, roll.law_normal.zeta_deg), ValueType::REAL},
+    {"roll.law_normal.zeta_tc_yd_deg", offsetof(fbw_output, roll.law_normal.zeta_tc_yd_deg), ValueType::REAL},
+    {"roll.output.xi_deg", offsetof(fbw_output, roll.output.xi_deg), ValueType::REAL},
+    {"roll.output.zeta_deg", offsetof(fbw_output, roll.output.zeta_deg), ValueType::REAL},
+    {"roll.output.zeta_trim_deg", offsetof(fbw_output, roll.output.zeta_trim_deg), ValueType::REAL},
+    {"output.eta_pos", offsetof(fbw_output, output.eta_pos), ValueType::REAL},
+    {"output.eta_trim_deg", offsetof(fbw_output, output.eta_trim_deg), ValueType::REAL},
+    {"output.eta_trim_deg_should_write", offsetof(fbw_output, output.eta_trim_deg_should_write), ValueType::BOOLEAN},
+    {"output.xi_pos", offsetof(fbw_output, output.xi_pos), ValueType::REAL},
+    {"output.zeta_pos", offsetof(fbw_output, output.zeta_pos), ValueType::REAL},
+    {"output.zeta_trim_pos", offsetof(fbw_output, output.zeta_trim_pos), ValueType::REAL},
+    {"output.zeta_trim_pos_should_write", offsetof(fbw_output, output.zeta_trim_pos_should_write), ValueType::BOOLEAN},
+};
+const size_t FlyByWireOutputTableSize = sizeof(FlyByWireOutputTable) / sizeof(OutputEntry);
+
+const ParameterEntry AutothrustParameterTable[] = {
+    {"ScheduledGain1_BreakpointsForDimension1", offsetof(AutothrustModelClass::Parameters_Autothrust_T, ScheduledGain1_BreakpointsForDimension1), 5},
+    {"ScheduledGain2_BreakpointsForDimension1", offsetof(AutothrustModelClass::Parameters_Autothrust_T, ScheduledGain2_BreakpointsForDimension1), 4},
+    {"ScheduledGain5_BreakpointsForDimension1", offsetof(AutothrustModelClass::Parameters_Autothrust_T, ScheduledGain5_BreakpointsForDimension1), 2},
+    {"WashoutFilter_C1", offsetof(AutothrustModelClass::Parameters_Autothrust_T, WashoutFilter_C1), 1},
+    {"HighPassFilter_C1", offsetof(AutothrustModelClass::Parameters_Autothrust_T, HighPassFilter_C1), 1},
+    {"LowPassFilter_C1", offsetof(AutothrustModelClass::Parameters_Autothrust_T, LowPassFilter_C1), 1},
+    {"LagFilter_C1", offsetof(AutothrustModelClass::Parameters_Autothrust_T, LagFilter_C1), 1},
+    {"LagFilter1_C1", offsetof(AutothrustModelClass::Parameters_Autothrust_T, LagFilter1_C1), 1},
+    {"WashoutFilter_C1_c", offsetof(AutothrustModelClass::Parameters_Autothrust_T, WashoutFilter_C1_c), 1},
+    {"HighPassFilter_C2", offsetof(AutothrustModelClass::Parameters_Autothrust_T, HighPassFilter_C2), 1},
+    {"LowPassFilter_C2", offsetof(AutothrustModelClass::Parameters_Autothrust_T, LowPassFilter_C2), 1},
+    {"HighPassFilter_C3", offsetof(AutothrustModelClass::Parameters_Autothrust_T, HighPassFilter_C3), 1},
+    {"LowPassFilter_C3", offsetof(AutothrustModelClass::Parameters_Autothrust_T, LowPassFilter_C3), 1},
+    {"HighPassFilter_C4", offsetof(AutothrustModelClass::Parameters_Autothrust_T, HighPassFilter_C4), 1},
+    {"LowPassFilter_C4", offsetof(AutothrustModelClass::Parameters_Autothrust_T, LowPassFilter_C4), 1},
+    {"DiscreteDerivativeVariableTs_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteDerivativeVariableTs_Gain), 1},
+    {"DiscreteTimeIntegratorVariableTsLimit_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTsLimit_Gain), 1},
+    {"DiscreteTimeIntegratorVariableTs_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_Gain), 1},
+    {"DiscreteTimeIntegratorVariableTs_Gain_l", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_Gain_l), 1},
+    {"DiscreteTimeIntegratorVariableTs1_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs1_Gain), 1},
+    {"DiscreteTimeIntegratorVariableTs_Gain_b", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_Gain_b), 1},
+    {"DiscreteTimeIntegratorVariableTs_Gain_k", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_Gain_k), 1},
+    {"DiscreteTimeIntegratorVariableTs1_Gain_l", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs1_Gain_l), 1},
+    {"DiscreteDerivativeVariableTs_InitialCondition", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteDerivativeVariableTs_InitialCondition), 1},
+    {"DiscreteTimeIntegratorVariableTs_InitialCondition", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_InitialCondition), 1},
+    {"DiscreteTimeIntegratorVariableTs_InitialCondition_p", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_InitialCondition_p), 1},
+    {"DiscreteTimeIntegratorVariableTs1_InitialCondition", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs1_InitialCondition), 1},
+    {"DiscreteTimeIntegratorVariableTs_InitialCondition_f", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_InitialCondition_f), 1},
+    {"DiscreteTimeIntegratorVariableTs_InitialCondition_n", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_InitialCondition_n), 1},
+    {"DiscreteTimeIntegratorVariableTs1_InitialCondition_e", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs1_InitialCondition_e), 1},
+    {"DiscreteTimeIntegratorVariableTs_LowerLimit", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_LowerLimit), 1},
+    {"DiscreteTimeIntegratorVariableTs_LowerLimit_d", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_LowerLimit_d), 1},
+    {"DiscreteTimeIntegratorVariableTs1_LowerLimit", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs1_LowerLimit), 1},
+    {"DiscreteTimeIntegratorVariableTs_LowerLimit_i", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_LowerLimit_i), 1},
+    {"DiscreteTimeIntegratorVariableTs_LowerLimit_e", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_LowerLimit_e), 1},
+    {"DiscreteTimeIntegratorVariableTs1_LowerLimit_h", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs1_LowerLimit_h), 1},
+    {"ScheduledGain1_Table", offsetof(AutothrustModelClass::Parameters_Autothrust_T, ScheduledGain1_Table), 5},
+    {"ScheduledGain2_Table", offsetof(AutothrustModelClass::Parameters_Autothrust_T, ScheduledGain2_Table), 4},
+    {"ScheduledGain5_Table", offsetof(AutothrustModelClass::Parameters_Autothrust_T, ScheduledGain5_Table), 2},
+    {"DiscreteTimeIntegratorVariableTs_UpperLimit", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_UpperLimit), 1},
+    {"DiscreteTimeIntegratorVariableTs_UpperLimit_l", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_UpperLimit_l), 1},
+    {"DiscreteTimeIntegratorVariableTs1_UpperLimit", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs1_UpperLimit), 1},
+    {"DiscreteTimeIntegratorVariableTs_UpperLimit_m", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_UpperLimit_m), 1},
+    {"DiscreteTimeIntegratorVariableTs_UpperLimit_p", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs_UpperLimit_p), 1},
+    {"DiscreteTimeIntegratorVariableTs1_UpperLimit_o", offsetof(AutothrustModelClass::Parameters_Autothrust_T, DiscreteTimeIntegratorVariableTs1_UpperLimit_o), 1},
+    {"CompareToConstant_const", offsetof(AutothrustModelClass::Parameters_Autothrust_T, CompareToConstant_const), 1},
+    {"CompareToConstant2_const", offsetof(AutothrustModelClass::Parameters_Autothrust_T, CompareToConstant2_const), 1},
+    {"Constant1_Value", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Constant1_Value), 1},
+    {"Gain3_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain3_Gain), 1},
+    {"Gain1_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain), 1},
+    {"Gain_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain_Gain), 1},
+    {"Saturation_UpperSat", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_UpperSat), 1},
+    {"Saturation_LowerSat", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_LowerSat), 1},
+    {"uDLookupTable_tableData", offsetof(AutothrustModelClass::Parameters_Autothrust_T, uDLookupTable_tableData), 7},
+    {"uDLookupTable_bp01Data", offsetof(AutothrustModelClass::Parameters_Autothrust_T, uDLookupTable_bp01Data), 7},
+    {"Gain1_Gain_p", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_p), 1},
+    {"Saturation_UpperSat_n", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_UpperSat_n), 1},
+    {"Saturation_LowerSat_j", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_LowerSat_j), 1},
+    {"uDLookupTable_tableData_o", offsetof(AutothrustModelClass::Parameters_Autothrust_T, uDLookupTable_tableData_o), 7},
+    {"uDLookupTable_bp01Data_b", offsetof(AutothrustModelClass::Parameters_Autothrust_T, uDLookupTable_bp01Data_b), 7},
+    {"Gain1_Gain_o", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_o), 1},
+    {"Saturation_UpperSat_a", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_UpperSat_a), 1},
+    {"Saturation_LowerSat_a", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_LowerSat_a), 1},
+    {"RETARD_Value", offsetof(AutothrustModelClass::Parameters_Autothrust_T, RETARD_Value), 1},
+    {"Gain2_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain2_Gain), 1},
+    {"Gain3_Gain_c", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain3_Gain_c), 1},
+    {"Gain_Gain_d", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain_Gain_d), 1},
+    {"Constant1_Value_l", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Constant1_Value_l), 1},
+    {"Saturation_UpperSat_p", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_UpperSat_p), 1},
+    {"Saturation_LowerSat_h", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_LowerSat_h), 1},
+    {"Gain1_Gain_n", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_n), 1},
+    {"Saturation1_UpperSat", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation1_UpperSat), 1},
+    {"Saturation1_LowerSat", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation1_LowerSat), 1},
+    {"Saturation_UpperSat_l", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_UpperSat_l), 1},
+    {"Saturation_LowerSat_i", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_LowerSat_i), 1},
+    {"Gain1_Gain_n0", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_n0), 1},
+    {"fpmtoms_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, fpmtoms_Gain), 1},
+    {"kntoms_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, kntoms_Gain), 1},
+    {"Saturation_UpperSat_d", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_UpperSat_d), 1},
+    {"Saturation_LowerSat_e", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_LowerSat_e), 1},
+    {"Gain_Gain_c", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain_Gain_c), 1},
+    {"Gain1_Gain_j", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_j), 1},
+    {"Constant_Value", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Constant_Value), 1},
+    {"Gain1_Gain_ot", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_ot), 1},
+    {"Gain1_Gain_f", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_f), 1},
+    {"Gain1_Gain_d", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_d), 1},
+    {"Gain_Gain_j", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain_Gain_j), 1},
+    {"Gain1_Gain_c", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_c), 1},
+    {"g_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, g_Gain), 1},
+    {"Saturation2_UpperSat", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation2_UpperSat), 1},
+    {"Saturation2_LowerSat", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation2_LowerSat), 1},
+    {"Saturation_UpperSat_f", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_UpperSat_f), 1},
+    {"Saturation_LowerSat_ev", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation_LowerSat_ev), 1},
+    {"ktstomps_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, ktstomps_Gain), 1},
+    {"GStoGS_CAS_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, GStoGS_CAS_Gain), 1},
+    {"_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, _Gain), 1},
+    {"Saturation1_UpperSat_c", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation1_UpperSat_c), 1},
+    {"Saturation1_LowerSat_g", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Saturation1_LowerSat_g), 1},
+    {"ktstomps_Gain_h", offsetof(AutothrustModelClass::Parameters_Autothrust_T, ktstomps_Gain_h), 1},
+    {"ktstomps1_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, ktstomps1_Gain), 1},
+    {"Gain4_Gain", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain4_Gain), 1},
+    {"Gain1_Gain_p1", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_p1), 1},
+    {"Gain1_Gain_di", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_di), 1},
+    {"Gain2_Gain_c", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain2_Gain_c), 1},
+    {"Gain_Gain_l", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain_Gain_l), 1},
+    {"Gain_Gain_d3", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain_Gain_d3), 1},
+    {"Gain1_Gain_h", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_h), 1},
+    {"Gain_Gain_f", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain_Gain_f), 1},
+    {"Gain_Gain_b", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain_Gain_b), 1},
+    {"Gain1_Gain_g", offsetof(AutothrustModelClass::Parameters_Autothrust_T, Gain1_Gain_g), 1},
+};
+const size_t AutothrustParameterTableSize = sizeof(AutothrustParameterTable) / sizeof(ParameterEntry);
+
+const OutputEntry AutothrustOutputTable[] = {
+    {"time.dt", offsetof(athr_out, time.dt), ValueType::REAL},
+    {"time.simulation_time", offsetof(athr_out, time.simulation_time), ValueType::REAL},
+    {"data.nz_g", offsetof(athr_out, data.nz_g), ValueType::REAL},
+    {"data.Theta_deg", offsetof(athr_out, data.Theta_deg), ValueType::REAL},
+    {"data.Phi_deg", offsetof(athr_out, data.Phi_deg), ValueType::REAL},
+    {"data.V_ias_kn", offsetof(athr_out, data.V_ias_kn), ValueType::REAL},
+    {"data.V_tas_kn", offsetof(athr_out, data.V_tas_kn), ValueType::REAL},
+    {"data.V_mach", offsetof(athr_out, data.V_mach), ValueType::REAL},
+    {"data.V_gnd_kn", offsetof(athr_out, data.V_gnd_kn), ValueType::REAL},
+    {"data.alpha_deg", offsetof(athr_out, data.alpha_deg), ValueType::REAL},
+    {"data.H_ft", offsetof(athr_out, data.H_ft), ValueType::REAL},
+    {"data.H_ind_ft", offsetof(athr_out, data.H_ind_ft), ValueType::REAL},
+    {"data.H_radio_ft", offsetof(athr_out, data.H_radio_ft), ValueType::REAL},
+    {"data.H_dot_fpm", offsetof(athr_out, data.H_dot_fpm), ValueType::REAL},
+    {"data.ax_m_s2", offsetof(athr_out, data.ax_m_s2), ValueType::REAL},
+    {"data.ay_m_s2", offsetof(athr_out, data.ay_m_s2), ValueType::REAL},
+    {"data.az_m_s2", offsetof(athr_out, data.az_m_s2), ValueType::REAL},
+    {"data.bx_m_s2", offsetof(athr_out, data.bx_m_s2), ValueType::REAL},
+    {"data.by_m_s2", offsetof(athr_out, data.by_m_s2), ValueType::REAL},
+    {"data.bz_m_s2", offsetof(athr_out, data.bz_m_s2), ValueType::REAL},
+    {"data.Psi_magnetic_deg", offsetof(athr_out, data.Psi_magnetic_deg), ValueType::REAL},
+    {"data.Psi_magnetic_track_deg", offsetof(athr_out, data.Psi_magnetic_track_deg), ValueType::REAL},
+    {"data.on_ground", offsetof(athr_out, data.on_ground), ValueType::BOOLEAN},
+    {"data.flap_handle_index", offsetof(athr_out, data.flap_handle_index), ValueType::REAL},
+    {"data.is_engine_operative_1", offsetof(athr_out, data.is_engine_operative_1), ValueType::BOOLEAN},
+    {"data.is_engine_operative_2", offsetof(athr_out, data.is_engine_operative_2), ValueType::BOOLEAN},
+    {"data.commanded_engine_N1_1_percent", offsetof(athr_out, data.commanded_engine_N1_1_percent), ValueType::REAL},
+    {"data.commanded_engine_N1_2_percent", offsetof(athr_out, data.commanded_engine_N1_2_percent), ValueType::REAL},
+    {"data.engine_N1_1_percent", offsetof(athr_out, data.engine_N1_1_percent), ValueType::REAL},
+    {"data.engine_N1_2_percent", offsetof(athr_out, data.engine_N1_2_percent), ValueType::REAL},
+    {"data.TAT_degC", offsetof(athr_out, data.TAT_degC), ValueType::REAL},
+    {"data.OAT_degC", offsetof(athr_out, data.OAT_degC), ValueType::REAL},
+    {"data.ISA_degC", offsetof(athr_out, data.ISA_degC), ValueType::REAL},
+    {"data.ambient_density_kg_per_m3", offsetof(athr_out, data.ambient_density_kg_per_m3), ValueType::REAL},
+    {"data_computed.TLA_in_active_range", offsetof(athr_out, data_computed.TLA_in_active_range), ValueType::BOOLEAN},
+    {"data_computed.is_FLX_active", offsetof(athr_out, data_computed.is_FLX_active), ValueType::BOOLEAN},
+    {"data_computed.ATHR_push", offsetof(athr_out, data_computed.ATHR_push), ValueType::BOOLEAN},
+    {"data_computed.ATHR_disabled", offsetof(athr_out, data_computed.ATHR_disabled), ValueType::BOOLEAN},
+    {"data_computed.time_since_touchdown", offsetof(athr_out, data_computed.time_since_touchdown), ValueType::REAL},
+    {"data_computed.alpha_floor_inhibited", offsetof(athr_out, data_computed.alpha_floor_inhibited), ValueType::BOOLEAN},
+    {"input.ATHR_push", offsetof(athr_out, input.ATHR_push), ValueType::BOOLEAN},
+    {"input.ATHR_disconnect", offsetof(athr_out, input.ATHR_disconnect), ValueType::BOOLEAN},
+    {"input.TLA_1_deg", offsetof(athr_out, input.TLA_1_deg), ValueType::REAL},
+    {"input.TLA_2_deg", offsetof(athr_out, input.TLA_2_deg), ValueType::REAL},
+    {"input.V_c_kn", offsetof(athr_out, input.V_c_kn), ValueType::REAL},
+    {"input.V_LS_kn", offsetof(athr_out, input.V_LS_kn), ValueType::REAL},
+    {"input.V_MAX_kn", offsetof(athr_out, input.V_MAX_kn), ValueType::REAL},
+    {"input.thrust_limit_REV_percent", offsetof(athr_out, input.thrust_limit_REV_percent), ValueType::REAL},
+    {"input.thrust_limit_IDLE_percent", offsetof(athr_out, input.thrust_limit_IDLE_percent), ValueType::REAL},
+    {"input.thrust_limit_CLB_percent", offsetof(athr_out, input.thrust_limit_CLB_percent), ValueType::REAL},
+    {"input.thrust_limit_MCT_percent", offsetof(athr_out, input.thrust_limit_MCT_percent), ValueType::REAL},
+    {"input.thrust_limit_FLEX_percent", offsetof(athr_out, input.thrust_limit_FLEX_percent), ValueType::REAL},
+    {"input.thrust_limit_TOGA_percent", offsetof(athr_out, input.thrust_limit_TOGA_percent), ValueType::REAL},
+    {"input.flex_temperature_degC", offsetof(athr_out, input.flex_temperature_degC), ValueType::REAL},
+    {"input.mode_requested", offsetof(athr_out, input.mode_requested), ValueType::REAL},
+    {"input.is_mach_mode_active", offsetof(athr_out, input.is_mach_mode_active), ValueType::BOOLEAN},
+    {"input.alpha_floor_condition", offsetof(athr_out, input.alpha_floor_condition), ValueType::BOOLEAN},
+    {"input.is_approach_mode_active", offsetof(athr_out, input.is_approach_mode_active), ValueType::BOOLEAN},
+    {"input.is_SRS_TO_mode_active", offsetof(athr_out, input.is_SRS_TO_mode_active), ValueType::BOOLEAN},
+    {"input.is_SRS_GA_mode_active", offsetof(athr_out, input.is_SRS_GA_mode_active), ValueType::BOOLEAN},
+    {"input.is_LAND_mode_active", offsetof(athr_out, input.is_LAND_mode_active), ValueType::BOOLEAN},
+    {"input.thrust_reduction_altitude", offsetof(athr_out, input.thrust_reduction_altitude), ValueType::REAL},
+    {"input.thrust_reduction_altitude_go_around", offsetof(athr_out, input.thrust_reduction_altitude_go_around), ValueType::REAL},
+    {"input.flight_phase", offsetof(athr_out, input.flight_phase), ValueType::REAL},
+    {"input.is_alt_soft_mode_active", offsetof(athr_out, input.is_alt_soft_mode_active), ValueType::BOOLEAN},
+    {"input.is_anti_ice_wing_active", offsetof(athr_out, input.is_anti_ice_wing_active), ValueType::BOOLEAN},
+    {"input.is_anti_ice_engine_1_active", offsetof(athr_out, input.is_anti_ice_engine_1_active), ValueType::BOOLEAN},
+    {"input.is_anti_ice_engine_2_active", offsetof(athr_out, input.is_anti_ice_engine_2_active), ValueType::BOOLEAN},
+    {"input.is_air_conditioning_1_active", offsetof(athr_out, input.is_air_conditioning_1_active), ValueType::BOOLEAN},
+    {"input.is_air_conditioning_2_active", offsetof(athr_out, input.is_air_conditioning_2_active), ValueType::BOOLEAN},
+    {"input.FD_active", offsetof(athr_out, input.FD_active), ValueType::BOOLEAN},
+    {"input.ATHR_reset_disable", offsetof(athr_out, input.ATHR_reset_disable), ValueType::BOOLEAN},
+    {"input.is_TCAS_active", offsetof(athr_out, input.is_TCAS_active), ValueType::BOOLEAN},
+    {"input.target_TCAS_RA_rate_fpm", offsetof(athr_out, input.target_TCAS_RA_rate_fpm), ValueType::REAL},
+    {"output.sim_throttle_lever_1_pos", offsetof(athr_out, output.sim_throttle_lever_1_pos), ValueType::REAL},
+    {"output.sim_throttle_lever_2_pos", offsetof(athr_out, output.sim_throttle_lever_2_pos), ValueType::REAL},
+    {"output.sim_thrust_mode_1", offsetof(athr_out, output.sim_thrust_mode_1), ValueType::REAL},
+    {"output.sim_thrust_mode_2", offsetof(athr_out, output.sim_thrust_mode_2), ValueType::REAL},
+    {"output.N1_TLA_1_percent", offsetof(athr_out, output.N1_TLA_1_percent), ValueType::REAL},
+    {"output.N1_TLA_2_percent", offsetof(athr_out, output.N1_TLA_2_percent), ValueType::REAL},
+    {"output.is_in_reverse_1", offsetof(athr_out, output.is_in_reverse_1), ValueType::BOOLEAN},
+    {"output.is_in_reverse_2", offsetof(athr_out, output.is_in_reverse_2), ValueType::BOOLEAN},
+    {"output.thrust_limit_type", offsetof(athr_out, output.thrust_limit_type), ValueType::ENUM},
+    {"output.thrust_limit_percent", offsetof(athr_out, output.thrust_limit_percent), ValueType::REAL},
+    {"output.N1_c_1_percent", offsetof(athr_out, output.N1_c_1_percent), ValueType::REAL},
+    {"output.N1_c_2_percent", offsetof(athr_out, output.N1_c_2_percent), ValueType::REAL},
+    {"output.status", offsetof(athr_out, output.status), ValueType::ENUM},
+    {"output.mode", offsetof(athr_out, output.mode), ValueType::ENUM},
+    {"output.mode_message", offsetof(athr_out, output.mode_message), ValueType::ENUM},
+    {"output.thrust_lever_warning_flex", offsetof(athr_out, output.thrust_lever_warning_flex), ValueType::BOOLEAN},
+    {"output.thrust_lever_warning_toga", offsetof(athr_out, output.thrust_lever_warning_toga), ValueType::BOOLEAN},
+};
+const size_t AutothrustOutputTableSize = sizeof(AutothrustOutputTable) / sizeof(OutputEntry);
+
+const ParameterEntry ThrustLimitsParameterTable[] = {
+    {"RateLimiterThresholdVariableTs_InitialCondition", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_InitialCondition), 1},
+    {"RateLimiterThresholdVariableTs_InitialCondition_l", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_InitialCondition_l), 1},
+    {"RateLimiterThresholdVariableTs_InitialCondition_l0", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_InitialCondition_l0), 1},
+    {"RateLimiterThresholdVariableTs_InitialCondition_a", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_InitialCondition_a), 1},
+    {"RateLimiterThresholdVariableTs_InitialCondition_lb", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_InitialCondition_lb), 1},
+    {"RateLimiterThresholdVariableTs1_InitialCondition", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs1_InitialCondition), 1},
+    {"RateLimiterThresholdVariableTs_Threshold", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_Threshold), 1},
+    {"RateLimiterThresholdVariableTs_Threshold_e", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_Threshold_e), 1},
+    {"RateLimiterThresholdVariableTs_Threshold_o", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_Threshold_o), 1},
+    {"RateLimiterThresholdVariableTs_Threshold_c", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_Threshold_c), 1},
+    {"RateLimiterThresholdVariableTs_Threshold_g", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_Threshold_g), 1},
+    {"RateLimiterThresholdVariableTs1_Threshold", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs1_Threshold), 1},
+    {"CompareToConstant_const", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, CompareToConstant_const), 1},
+    {"CompareToConstant1_const", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, CompareToConstant1_const), 1},
+    {"RateLimiterThresholdVariableTs_lo", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_lo), 1},
+    {"RateLimiterThresholdVariableTs_lo_b", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_lo_b), 1},
+    {"RateLimiterThresholdVariableTs_lo_d", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_lo_d), 1},
+    {"RateLimiterThresholdVariableTs_lo_n", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_lo_n), 1},
+    {"RateLimiterThresholdVariableTs_lo_h", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_lo_h), 1},
+    {"RateLimiterThresholdVariableTs1_lo", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs1_lo), 1},
+    {"RateLimiterThresholdVariableTs_up", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_up), 1},
+    {"RateLimiterThresholdVariableTs_up_p", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_up_p), 1},
+    {"RateLimiterThresholdVariableTs_up_m", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_up_m), 1},
+    {"RateLimiterThresholdVariableTs_up_i", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_up_i), 1},
+    {"RateLimiterThresholdVariableTs_up_k", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs_up_k), 1},
+    {"RateLimiterThresholdVariableTs1_up", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, RateLimiterThresholdVariableTs1_up), 1},
+    {"AntiIceWing8000_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing8000_tableData), 4},
+    {"AntiIceWing8000_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing8000_bp01Data), 2},
+    {"AntiIceWing8000_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing8000_bp02Data), 2},
+    {"AntiIceWing8000_tableData_n", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing8000_tableData_n), 4},
+    {"AntiIceWing8000_bp01Data_p", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing8000_bp01Data_p), 2},
+    {"AntiIceWing8000_bp02Data_o", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing8000_bp02Data_o), 2},
+    {"AirConditioning8000_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning8000_tableData), 4},
+    {"AirConditioning8000_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning8000_bp01Data), 2},
+    {"AirConditioning8000_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning8000_bp02Data), 2},
+    {"AirConditioning8000_tableData_g", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning8000_tableData_g), 4},
+    {"AirConditioning8000_bp01Data_l", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning8000_bp01Data_l), 2},
+    {"AirConditioning8000_bp02Data_h", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning8000_bp02Data_h), 2},
+    {"AntiIceEngine8000_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine8000_tableData), 4},
+    {"AntiIceEngine8000_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine8000_bp01Data), 2},
+    {"AntiIceEngine8000_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine8000_bp02Data), 2},
+    {"AntiIceEngine8000_tableData_n", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine8000_tableData_n), 4},
+    {"AntiIceEngine8000_bp01Data_a", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine8000_bp01Data_a), 2},
+    {"AntiIceEngine8000_bp02Data_g", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine8000_bp02Data_g), 2},
+    {"GAAIE8000_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIE8000_tableData), 4},
+    {"GAAIE8000_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIE8000_bp01Data), 2},
+    {"GAAIE8000_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIE8000_bp02Data), 2},
+    {"GAAIE8000_tableData_n", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIE8000_tableData_n), 4},
+    {"GAAIE8000_bp01Data_i", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIE8000_bp01Data_i), 2},
+    {"GAAIE8000_bp02Data_b", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIE8000_bp02Data_b), 2},
+    {"GAAIW8000_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIW8000_tableData), 4},
+    {"GAAIW8000_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIW8000_bp01Data), 2},
+    {"GAAIW8000_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIW8000_bp02Data), 2},
+    {"GAAIW8000_tableData_e", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIW8000_tableData_e), 4},
+    {"GAAIW8000_bp01Data_i", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIW8000_bp01Data_i), 2},
+    {"GAAIW8000_bp02Data_p", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAIW8000_bp02Data_p), 2},
+    {"GAAC8000_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAC8000_tableData), 4},
+    {"GAAC8000_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAC8000_bp01Data), 2},
+    {"GAAC8000_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAC8000_bp02Data), 2},
+    {"GAAC8000_tableData_c", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAC8000_tableData_c), 4},
+    {"GAAC8000_bp01Data_p", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAC8000_bp01Data_p), 2},
+    {"GAAC8000_bp02Data_e", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GAAC8000_bp02Data_e), 2},
+    {"MaximumClimb_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, MaximumClimb_tableData), 390},
+    {"MaximumClimb_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, MaximumClimb_bp01Data), 30},
+    {"MaximumClimb_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, MaximumClimb_bp02Data), 13},
+    {"uDLookupTable_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, uDLookupTable_tableData), 4},
+    {"uDLookupTable_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, uDLookupTable_bp01Data), 2},
+    {"uDLookupTable_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, uDLookupTable_bp02Data), 2},
+    {"Right_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, Right_tableData), 70},
+    {"Right_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, Right_bp01Data), 10},
+    {"Right_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, Right_bp02Data), 7},
+    {"Left_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, Left_tableData), 4},
+    {"Left_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, Left_bp01Data), 2},
+    {"Left_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, Left_bp02Data), 2},
+    {"AntiIceEngine_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine_tableData), 2},
+    {"AntiIceEngine_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine_bp01Data), 2},
+    {"AntiIceWing_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing_tableData), 2},
+    {"AntiIceWing_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing_bp01Data), 2},
+    {"AirConditioning_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning_tableData), 2},
+    {"AirConditioning_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning_bp01Data), 2},
+    {"OATCornerPoint_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint_tableData), 390},
+    {"OATCornerPoint_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint_bp01Data), 30},
+    {"OATCornerPoint_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint_bp02Data), 13},
+    {"AntiIceEngine_tableData_o", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine_tableData_o), 4},
+    {"AntiIceEngine_bp01Data_i", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine_bp01Data_i), 2},
+    {"AntiIceEngine_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine_bp02Data), 2},
+    {"AntiIceWing_tableData_k", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing_tableData_k), 4},
+    {"AntiIceWing_bp01Data_o", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing_bp01Data_o), 2},
+    {"AntiIceWing_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing_bp02Data), 2},
+    {"AirConditioning_tableData_g", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning_tableData_g), 4},
+    {"AirConditioning_bp01Data_e", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning_bp01Data_e), 2},
+    {"AirConditioning_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning_bp02Data), 2},
+    {"MaximumContinuous_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, MaximumContinuous_tableData), 390},
+    {"MaximumContinuous_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, MaximumContinuous_bp01Data), 30},
+    {"MaximumContinuous_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, MaximumContinuous_bp02Data), 13},
+    {"OATCornerPoint_tableData_f", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint_tableData_f), 390},
+    {"OATCornerPoint_bp01Data_k", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint_bp01Data_k), 30},
+    {"OATCornerPoint_bp02Data_b", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint_bp02Data_b), 13},
+    {"AntiIceEngine_tableData_f", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine_tableData_f), 4},
+    {"AntiIceEngine_bp01Data_b", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine_bp01Data_b), 2},
+    {"AntiIceEngine_bp02Data_k", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceEngine_bp02Data_k), 2},
+    {"AntiIceWing_tableData_n", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing_tableData_n), 4},
+    {"AntiIceWing_bp01Data_c", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing_bp01Data_c), 2},
+    {"AntiIceWing_bp02Data_i", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AntiIceWing_bp02Data_i), 2},
+    {"AirConditioning_tableData_f", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning_tableData_f), 4},
+    {"AirConditioning_bp01Data_p", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning_bp01Data_p), 2},
+    {"AirConditioning_bp02Data_n", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, AirConditioning_bp02Data_n), 2},
+    {"Saturation_UpperSat", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, Saturation_UpperSat), 1},
+    {"Saturation_LowerSat", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, Saturation_LowerSat), 1},
+    {"MaximumTakeOff_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, MaximumTakeOff_tableData), 756},
+    {"MaximumTakeOff_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, MaximumTakeOff_bp01Data), 36},
+    {"MaximumTakeOff_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, MaximumTakeOff_bp02Data), 21},
+    {"OATCornerPoint_tableData_fa", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint_tableData_fa), 1044},
+    {"OATCornerPoint_bp01Data_j", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint_bp01Data_j), 36},
+    {"OATCornerPoint_bp02Data_d", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint_bp02Data_d), 29},
+    {"GoAround_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GoAround_tableData), 756},
+    {"GoAround_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GoAround_bp01Data), 36},
+    {"GoAround_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, GoAround_bp02Data), 21},
+    {"OATCornerPoint1_tableData", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint1_tableData), 756},
+    {"OATCornerPoint1_bp01Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint1_bp01Data), 36},
+    {"OATCornerPoint1_bp02Data", offsetof(ThrustLimitsModelClass::Parameters_ThrustLimits_T, OATCornerPoint1_bp02Data), 21},
+};
+const size_t ThrustLimitsParameterTableSize = sizeof(ThrustLimitsParameterTable) / sizeof(ParameterEntry);
+
+const OutputEntry ThrustLimitsOutputTable[] = {
+    {"thrust_limit_IDLE_percent", offsetof(thrust_limits_out, thrust_limit_IDLE_percent), ValueType::REAL},
+    {"thrust_limit_CLB_percent", offsetof(thrust_limits_out, thrust_limit_CLB_percent), ValueType::REAL},
+    {"thrust_limit_FLEX_percent", offsetof(thrust_limits_out, thrust_limit_FLEX_percent), ValueType::REAL},
+    {"thrust_limit_MCT_percent", offsetof(thrust_limits_out, thrust_limit_MCT_percent), ValueType::REAL},
+    {"thrust_limit_TOGA_percent", offsetof(thrust_limits_out, thrust_limit_TOGA_percent), ValueType::REAL},
+};
+const size_t ThrustLimitsOutputTableSize = sizeof(ThrustLimitsOutputTable) / sizeof(OutputEntry);
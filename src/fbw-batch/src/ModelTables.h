@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+enum class ValueType { REAL, BOOLEAN, ENUM };
+
+// tunable parameter of a generated model (always an array of real_T)
+struct ParameterEntry {
+  const char* name;
+  size_t offset;
+  size_t count;
+};
+
+// scalar output signal of a generated model
+struct OutputEntry {
+  const char* name;
+  size_t offset;
+  ValueType type;
+};
+
+// tables are generated by generate-tables.js
+extern const ParameterEntry FlyByWireParameterTable[];
+extern const size_t FlyByWireParameterTableSize;
+extern const OutputEntry FlyByWireOutputTable[];
+extern const size_t FlyByWireOutputTableSize;
+
+extern const ParameterEntry AutothrustParameterTable[];
+extern const size_t AutothrustParameterTableSize;
+extern const OutputEntry AutothrustOutputTable[];
+extern const size_t AutothrustOutputTableSize;
+
+extern const ParameterEntry ThrustLimitsParameterTable[];
+extern const size_t ThrustLimitsParameterTableSize;
+extern const OutputEntry ThrustLimitsOutputTable[];
+extern const size_t ThrustLimitsOutputTableSize;
@@ -0,0 +1,188 @@
+#include "MonteCarloScenario.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+#include "FlyByWire.h"
+
+using namespace std;
+
+namespace {
+
+const double PI = 3.14159265358979323846;
+const double DEG_TO_RAD = PI / 180.0;
+const double KNOTS_TO_METERS_PER_SECOND = 0.514444;
+const double G = 9.80665;
+
+struct Oscillation {
+  double amplitude;
+  double omega;
+  double phase;
+
+  double value(double t) const { return amplitude * sin(omega * t + phase); }
+  double rate(double t) const { return amplitude * omega * cos(omega * t + phase); }
+  double acceleration(double t) const { return -amplitude * omega * omega * sin(omega * t + phase); }
+};
+
+struct Doublet {
+  double start;
+  double width;
+  double amplitude;
+
+  double value(double t) const {
+    if (t < start || t >= start + 2 * width) {
+      return 0.0;
+    }
+    return t < start + width ? amplitude : -amplitude;
+  }
+};
+
+fbw_input createBaseInput(mt19937_64& generator, double sampleTime) {
+  uniform_real_distribution<double> weight(45000.0, 78000.0);
+  uniform_real_distribution<double> cg(20.0, 38.0);
+  uniform_real_distribution<double> ias(180.0, 320.0);
+  uniform_real_distribution<double> altitude(3000.0, 37000.0);
+  uniform_real_distribution<double> wind(-40.0, 40.0);
+
+  fbw_input input = {};
+  input.time.dt = sampleTime;
+  input.data.total_weight_kg = weight(generator);
+  input.data.CG_percent_MAC = cg(generator);
+  input.data.V_ias_kn = ias(generator);
+  input.data.H_ft = altitude(generator);
+  input.data.H_ind_ft = input.data.H_ft;
+  input.data.H_radio_ft = 2500.0 + input.data.H_ft;
+
+  // rough standard atmosphere to derive the remaining air data
+  double temperature = max(-56.5, 15.0 - 0.0019812 * input.data.H_ft);
+  double pressure = 1013.25 * pow(1.0 - 6.8755856e-6 * min(input.data.H_ft, 36089.0), 5.2558797);
+  double density = pressure * 100.0 / (287.05 * (temperature + 273.15));
+  input.data.V_tas_kn = input.data.V_ias_kn * sqrt(1.225 / density);
+  input.data.V_mach = input.data.V_tas_kn * KNOTS_TO_METERS_PER_SECOND / sqrt(1.4 * 287.05 * (temperature + 273.15));
+  input.data.ambient_density_kg_per_m3 = density;
+  input.data.ambient_pressure_mbar = pressure;
+  input.data.ambient_temperature_celsius = temperature;
+  input.data.total_air_temperature_celsius = temperature * (1.0 + 0.2 * input.data.V_mach * input.data.V_mach);
+  input.data.ambient_wind_x_kn = wind(generator);
+  input.data.ambient_wind_z_kn = wind(generator);
+  input.data.ambient_wind_velocity_kn = hypot(input.data.ambient_wind_x_kn, input.data.ambient_wind_z_kn);
+  input.data.ambient_wind_direction_deg = fmod(atan2(input.data.ambient_wind_x_kn, input.data.ambient_wind_z_kn) / DEG_TO_RAD + 360.0, 360.0);
+
+  input.data.alpha_deg = 2.5;
+  input.data.linear_cl_alpha_per_deg = 0.11;
+  input.data.alpha_stall_deg = 15.0;
+  input.data.alpha_zero_lift_deg = -2.0;
+  input.data.simulation_rate = 1.0;
+  input.data.latitude_deg = 47.0;
+  input.data.longitude_deg = 8.0;
+  input.data.engine_1_thrust_lbf = 6000.0;
+  input.data.engine_2_thrust_lbf = 6000.0;
+  input.data.thrust_lever_1_pos = 25.0;
+  input.data.thrust_lever_2_pos = 25.0;
+  input.data.tailstrike_protection_on = true;
+  input.data.VLS_kn = 140.0;
+
+  return input;
+}
+
+}  // namespace
+
+MonteCarloResult MonteCarloScenario::run(const MonteCarloConfiguration& configuration, uint64_t runIndex) {
+  // every run has its own deterministic random stream
+  mt19937_64 generator(configuration.seed * 1000003ULL + runIndex);
+  uniform_real_distribution<double> unit(0.0, 1.0);
+
+  auto model = make_unique<FlyByWireModelClass>();
+  model->initialize();
+
+  FlyByWireModelClass::ExternalInputs_FlyByWire_T modelInput = {};
+  modelInput.in = createBaseInput(generator, configuration.sampleTime);
+
+  double duration = configuration.duration * (0.5 + unit(generator));
+  double pitchTrim = 1.0 + 4.0 * unit(generator);
+  Oscillation pitch = {2.0 * unit(generator), 0.2 + 1.5 * unit(generator), 2 * PI * unit(generator)};
+  Oscillation roll = {25.0 * unit(generator), 0.1 + 0.8 * unit(generator), 2 * PI * unit(generator)};
+  Doublet stickPitch = {duration * unit(generator), 0.5 + 2.0 * unit(generator), 2.0 * unit(generator) - 1.0};
+  Doublet stickRoll = {duration * unit(generator), 0.5 + 2.0 * unit(generator), 2.0 * unit(generator) - 1.0};
+
+  MonteCarloResult result = {};
+  result.runIndex = runIndex;
+  result.total_weight_kg = modelInput.in.data.total_weight_kg;
+  result.CG_percent_MAC = modelInput.in.data.CG_percent_MAC;
+  result.V_ias_kn = modelInput.in.data.V_ias_kn;
+  result.H_ft = modelInput.in.data.H_ft;
+
+  double velocity = modelInput.in.data.V_tas_kn * KNOTS_TO_METERS_PER_SECOND;
+  for (double t = 0.0; t < duration; t += configuration.sampleTime) {
+    double theta = pitchTrim + pitch.value(t);
+    double phi = roll.value(t);
+    double q = pitch.rate(t) * DEG_TO_RAD;
+
+    // the simulator reports pitch and bank with inverted sign
+    modelInput.in.time.simulation_time = t;
+    modelInput.in.data.Theta_deg = -theta;
+    modelInput.in.data.Phi_deg = -phi;
+    modelInput.in.data.q_rad_s = -q;
+    modelInput.in.data.p_rad_s = -roll.rate(t) * DEG_TO_RAD;
+    modelInput.in.data.q_dot_rad_s2 = -pitch.acceleration(t) * DEG_TO_RAD;
+    modelInput.in.data.p_dot_rad_s2 = -roll.acceleration(t) * DEG_TO_RAD;
+    modelInput.in.data.nz_g = cos(theta * DEG_TO_RAD) * cos(phi * DEG_TO_RAD) + velocity * q / G;
+    modelInput.in.data.alpha_deg = 2.5 + 0.5 * pitch.value(t);
+    modelInput.in.input.delta_eta_pos = stickPitch.value(t);
+    modelInput.in.input.delta_xi_pos = stickRoll.value(t);
+
+    model->setExternalInputs(&modelInput);
+    model->step();
+    const fbw_output& output = model->getExternalOutputs().out;
+
+    // feed surface positions back like the simulator would
+    modelInput.in.data.eta_pos = output.output.eta_pos;
+    modelInput.in.data.xi_pos = output.output.xi_pos;
+    modelInput.in.data.zeta_pos = output.output.zeta_pos;
+    if (output.output.eta_trim_deg_should_write) {
+      modelInput.in.data.eta_trim_deg = output.output.eta_trim_deg;
+    }
+
+    result.steps++;
+    result.max_abs_eta_pos = max(result.max_abs_eta_pos, abs(output.output.eta_pos));
+    result.max_abs_xi_pos = max(result.max_abs_xi_pos, abs(output.output.xi_pos));
+    result.max_abs_zeta_pos = max(result.max_abs_zeta_pos, abs(output.output.zeta_pos));
+    result.max_alpha_filtered_deg = max(result.max_alpha_filtered_deg, output.sim.data_speeds_aoa.alpha_filtered_deg);
+    result.high_aoa_prot_active |= output.sim.data_computed.high_aoa_prot_active != 0;
+    result.high_speed_prot_active |= output.sim.data_computed.high_speed_prot_active != 0;
+  }
+
+  return result;
+}
+
+void MonteCarloScenario::writeHeader(ostream& out, const string& delimiter) {
+  out << "run" << delimiter;
+  out << "steps" << delimiter;
+  out << "total_weight_kg" << delimiter;
+  out << "CG_percent_MAC" << delimiter;
+  out << "V_ias_kn" << delimiter;
+  out << "H_ft" << delimiter;
+  out << "max_abs_eta_pos" << delimiter;
+  out << "max_abs_xi_pos" << delimiter;
+  out << "max_abs_zeta_pos" << delimiter;
+  out << "max_alpha_filtered_deg" << delimiter;
+  out << "high_aoa_prot_active" << delimiter;
+  out << "high_speed_prot_active" << endl;
+}
+
+void MonteCarloScenario::writeResult(ostream& out, const string& delimiter, const MonteCarloResult& result) {
+  out << result.runIndex << delimiter;
+  out << result.steps << delimiter;
+  out << result.total_weight_kg << delimiter;
+  out << result.CG_percent_MAC << delimiter;
+  out << result.V_ias_kn << delimiter;
+  out << result.H_ft << delimiter;
+  out << result.max_abs_eta_pos << delimiter;
+  out << result.max_abs_xi_pos << delimiter;
+  out << result.max_abs_zeta_pos << delimiter;
+  out << result.max_alpha_filtered_deg << delimiter;
+  out << result.high_aoa_prot_active << delimiter;
+  out << result.high_speed_prot_active << endl;
+}
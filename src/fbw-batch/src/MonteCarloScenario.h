@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "FlyByWire_types.h"
+
+struct MonteCarloConfiguration {
+  uint64_t seed = 0;
+  double duration = 60.0;
+  double sampleTime = 1.0 / 30.0;
+};
+
+struct MonteCarloResult {
+  uint64_t runIndex;
+  uint64_t steps;
+  double total_weight_kg;
+  double CG_percent_MAC;
+  double V_ias_kn;
+  double H_ft;
+  double max_abs_eta_pos;
+  double max_abs_xi_pos;
+  double max_abs_zeta_pos;
+  double max_alpha_filtered_deg;
+  bool high_aoa_prot_active;
+  bool high_speed_prot_active;
+};
+
+// A single Monte Carlo run of the fly-by-wire model. Every run creates its own
+// model instance, draws a random flight condition (weight, CG, speed, altitude,
+// wind) and drives the model open-loop with randomized attitude oscillations
+// and sidestick doublets. There is no flight dynamics model involved, the
+// sensor inputs follow the prescribed trajectories independent of the model
+// outputs.
+class MonteCarloScenario {
+ public:
+  MonteCarloScenario() = delete;
+  ~MonteCarloScenario() = delete;
+
+  static MonteCarloResult run(const MonteCarloConfiguration& configuration, uint64_t runIndex);
+
+  static void writeHeader(std::ostream& out, const std::string& delimiter);
+  static void writeResult(std::ostream& out, const std::string& delimiter, const MonteCarloResult& result);
+};
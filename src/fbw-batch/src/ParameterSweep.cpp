@@ -0,0 +1,168 @@
+#include "ParameterSweep.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+using namespace std;
+
+namespace {
+
+struct CostAccumulator {
+  double sumOfSquares = 0.0;
+  double maximumAbsolute = 0.0;
+  uint64_t count = 0;
+};
+
+double getValue(const void* data, size_t offset, ValueType type) {
+  const char* address = static_cast<const char*>(data) + offset;
+  switch (type) {
+    case ValueType::REAL:
+      return *reinterpret_cast<const real_T*>(address);
+    case ValueType::BOOLEAN:
+      return *reinterpret_cast<const boolean_T*>(address);
+    case ValueType::ENUM:
+      return *reinterpret_cast<const int*>(address);
+  }
+  return 0.0;
+}
+
+void setParameter(void* parameters, size_t offset, double value) {
+  *reinterpret_cast<real_T*>(static_cast<char*>(parameters) + offset) = value;
+}
+
+void accumulate(CostAccumulator& accumulator, const CostTerm& term, const void* output, const void* recorded) {
+  double value = getValue(output, term.offset, term.type);
+  if (term.metric == CostMetric::RMS_ERROR || term.metric == CostMetric::MAX_ABS_ERROR) {
+    value -= getValue(recorded, term.offset, term.type);
+  }
+  accumulator.sumOfSquares += value * value;
+  accumulator.maximumAbsolute = max(accumulator.maximumAbsolute, abs(value));
+  accumulator.count++;
+}
+
+}  // namespace
+
+ParameterSweep::ParameterSweep(const SweepConfiguration& configuration, const vector<vector<ReplayFrame>>& scenarios)
+    : configuration(configuration), scenarios(scenarios), needsFlyByWire(false), needsAutothrust(false) {
+  for (const auto& term : configuration.costTerms) {
+    needsFlyByWire |= term.model == ModelType::FLY_BY_WIRE;
+    needsAutothrust |= term.model == ModelType::AUTOTHRUST;
+  }
+
+  // defaults with fixed overrides applied, shared by all candidates
+  flyByWireParameters = make_unique<FlyByWireModelClass>()->getParameters();
+  autothrustParameters = make_unique<AutothrustModelClass>()->getParameters();
+  for (const auto& parameterOverride : configuration.overrides) {
+    if (parameterOverride.parameter.model == ModelType::FLY_BY_WIRE) {
+      setParameter(&flyByWireParameters, parameterOverride.parameter.offset, parameterOverride.value);
+    } else {
+      setParameter(&autothrustParameters, parameterOverride.parameter.offset, parameterOverride.value);
+    }
+  }
+}
+
+vector<vector<double>> ParameterSweep::createCandidates() const {
+  vector<vector<double>> candidates;
+  const auto& dimensions = configuration.dimensions;
+
+  if (configuration.mode == SweepMode::RANDOM) {
+    mt19937_64 generator(configuration.seed);
+    for (uint32_t i = 0; i < configuration.samples; i++) {
+      vector<double> candidate;
+      for (const auto& dimension : dimensions) {
+        candidate.push_back(uniform_real_distribution<double>(dimension.minimum, dimension.maximum)(generator));
+      }
+      candidates.push_back(candidate);
+    }
+    return candidates;
+  }
+
+  // grid: count through all combinations like an odometer
+  vector<uint32_t> index(dimensions.size(), 0);
+  while (true) {
+    vector<double> candidate;
+    for (size_t i = 0; i < dimensions.size(); i++) {
+      const auto& dimension = dimensions[i];
+      double fraction = dimension.steps > 1 ? static_cast<double>(index[i]) / (dimension.steps - 1) : 0.0;
+      candidate.push_back(dimension.minimum + fraction * (dimension.maximum - dimension.minimum));
+    }
+    candidates.push_back(candidate);
+
+    size_t i = 0;
+    for (; i < dimensions.size(); i++) {
+      if (++index[i] < dimensions[i].steps) {
+        break;
+      }
+      index[i] = 0;
+    }
+    if (i == dimensions.size()) {
+      return candidates;
+    }
+  }
+}
+
+double ParameterSweep::evaluate(const vector<double>& candidate) const {
+  // parameters of this candidate
+  auto flyByWireCandidate = make_unique<FlyByWireModelClass::Parameters_FlyByWire_T>(flyByWireParameters);
+  auto autothrustCandidate = make_unique<AutothrustModelClass::Parameters_Autothrust_T>(autothrustParameters);
+  for (size_t i = 0; i < candidate.size(); i++) {
+    const auto& parameter = configuration.dimensions[i].parameter;
+    if (parameter.model == ModelType::FLY_BY_WIRE) {
+      setParameter(flyByWireCandidate.get(), parameter.offset, candidate[i]);
+    } else {
+      setParameter(autothrustCandidate.get(), parameter.offset, candidate[i]);
+    }
+  }
+
+  vector<CostAccumulator> accumulators(configuration.costTerms.size());
+  for (const auto& scenario : scenarios) {
+    // fresh models for every scenario
+    auto flyByWire = make_unique<FlyByWireModelClass>();
+    auto autothrust = make_unique<AutothrustModelClass>();
+    flyByWire->setParameters(flyByWireCandidate.get());
+    autothrust->setParameters(autothrustCandidate.get());
+    flyByWire->initialize();
+    autothrust->initialize();
+
+    FlyByWireModelClass::ExternalInputs_FlyByWire_T flyByWireInput = {};
+    AutothrustModelClass::ExternalInputs_Autothrust_T autothrustInput = {};
+    for (const auto& frame : scenario) {
+      if (needsFlyByWire) {
+        flyByWireInput.in = frame.flyByWireInput;
+        flyByWire->setExternalInputs(&flyByWireInput);
+        flyByWire->step();
+      }
+      if (needsAutothrust) {
+        autothrustInput.in = frame.autothrustInput;
+        autothrust->setExternalInputs(&autothrustInput);
+        autothrust->step();
+      }
+
+      for (size_t i = 0; i < configuration.costTerms.size(); i++) {
+        const auto& term = configuration.costTerms[i];
+        if (term.model == ModelType::FLY_BY_WIRE) {
+          accumulate(accumulators[i], term, &flyByWire->getExternalOutputs().out, &frame.flyByWireOutput);
+        } else {
+          accumulate(accumulators[i], term, &autothrust->getExternalOutputs().out, &frame.autothrustOutput);
+        }
+      }
+    }
+  }
+
+  double cost = 0.0;
+  for (size_t i = 0; i < configuration.costTerms.size(); i++) {
+    const auto& term = configuration.costTerms[i];
+    const auto& accumulator = accumulators[i];
+    if (accumulator.count == 0) {
+      continue;
+    }
+    if (term.metric == CostMetric::RMS_ERROR || term.metric == CostMetric::RMS) {
+      cost += term.weight * sqrt(accumulator.sumOfSquares / accumulator.count);
+    } else {
+      cost += term.weight * accumulator.maximumAbsolute;
+    }
+  }
+  return cost;
+}
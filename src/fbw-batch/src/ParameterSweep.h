@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+
+#include "FlightDataRecorderReplay.h"
+#include "SweepConfiguration.h"
+
+// Evaluates candidate parameter sets of the fly-by-wire and autothrust models
+// against recorded scenarios. A candidate holds one value per sweep dimension.
+// Evaluation of a candidate is independent of all others, so candidates can be
+// evaluated concurrently.
+class ParameterSweep {
+ public:
+  ParameterSweep(const SweepConfiguration& configuration, const std::vector<std::vector<ReplayFrame>>& scenarios);
+
+  std::vector<std::vector<double>> createCandidates() const;
+
+  double evaluate(const std::vector<double>& candidate) const;
+
+ private:
+  const SweepConfiguration& configuration;
+  const std::vector<std::vector<ReplayFrame>>& scenarios;
+  bool needsFlyByWire;
+  bool needsAutothrust;
+  FlyByWireModelClass::Parameters_FlyByWire_T flyByWireParameters;
+  AutothrustModelClass::Parameters_Autothrust_T autothrustParameters;
+};
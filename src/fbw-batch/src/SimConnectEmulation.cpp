@@ -0,0 +1,151 @@
+#include <cstddef>
+#include <cstring>
+
+#include "SimConnectEmulation.h"
+
+// the emulation must not allocate memory, it runs within the measured frames of the allocation check
+static constexpr size_t MAXIMUM_DATA_SIZE = 8192;
+
+static SIMCONNECT_DATA_DEFINITION_ID simObjectDefinitionId = 0;
+static char simObjectData[MAXIMUM_DATA_SIZE] = {};
+static DWORD simObjectDataSize = 0;
+
+static bool hasPendingRequest = false;
+static SIMCONNECT_DATA_REQUEST_ID pendingRequestId = 0;
+
+alignas(8) static char dispatchBuffer[sizeof(SIMCONNECT_RECV_SIMOBJECT_DATA) + MAXIMUM_DATA_SIZE] = {};
+
+static uint64_t numberOfRequests = 0;
+static uint64_t numberOfEvents = 0;
+
+void SimConnectEmulation::setSimObjectData(SIMCONNECT_DATA_DEFINITION_ID definitionId, const void* data, DWORD size) {
+  simObjectDefinitionId = definitionId;
+  simObjectDataSize = size < MAXIMUM_DATA_SIZE ? size : MAXIMUM_DATA_SIZE;
+  memcpy(simObjectData, data, simObjectDataSize);
+}
+
+uint64_t SimConnectEmulation::getNumberOfRequests() {
+  return numberOfRequests;
+}
+
+uint64_t SimConnectEmulation::getNumberOfEvents() {
+  return numberOfEvents;
+}
+
+HRESULT SimConnect_Open(HANDLE* phSimConnect, const char*, void*, DWORD, HANDLE, DWORD) {
+  *phSimConnect = reinterpret_cast<HANDLE>(1);
+  return S_OK;
+}
+
+HRESULT SimConnect_Close(HANDLE) {
+  return S_OK;
+}
+
+HRESULT SimConnect_GetNextDispatch(HANDLE, SIMCONNECT_RECV** ppData, DWORD* pcbData) {
+  if (!hasPendingRequest) {
+    return E_FAIL;
+  }
+  hasPendingRequest = false;
+
+  // build reply with the current data of the user aircraft
+  auto* message = reinterpret_cast<SIMCONNECT_RECV_SIMOBJECT_DATA*>(dispatchBuffer);
+  memset(message, 0, sizeof(SIMCONNECT_RECV_SIMOBJECT_DATA));
+  // the message derives from SIMCONNECT_RECV and is not standard-layout, hence no offsetof
+  const size_t dataOffset = static_cast<size_t>(reinterpret_cast<char*>(&message->dwData) - dispatchBuffer);
+  message->dwSize = static_cast<DWORD>(dataOffset + simObjectDataSize);
+  message->dwID = SIMCONNECT_RECV_ID_SIMOBJECT_DATA;
+  message->dwRequestID = pendingRequestId;
+  message->dwDefineID = simObjectDefinitionId;
+  memcpy(&message->dwData, simObjectData, simObjectDataSize);
+
+  *ppData = message;
+  *pcbData = message->dwSize;
+  return S_OK;
+}
+
+HRESULT SimConnect_AddToDataDefinition(HANDLE, SIMCONNECT_DATA_DEFINITION_ID, const char*, const char*, SIMCONNECT_DATATYPE, float, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_RequestDataOnSimObject(HANDLE,
+                                          SIMCONNECT_DATA_REQUEST_ID RequestID,
+                                          SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                          SIMCONNECT_OBJECT_ID,
+                                          SIMCONNECT_PERIOD Period,
+                                          SIMCONNECT_DATA_REQUEST_FLAG,
+                                          DWORD,
+                                          DWORD,
+                                          DWORD) {
+  numberOfRequests++;
+  if (Period == SIMCONNECT_PERIOD_ONCE && DefineID == simObjectDefinitionId) {
+    hasPendingRequest = true;
+    pendingRequestId = RequestID;
+  }
+  return S_OK;
+}
+
+HRESULT SimConnect_SetDataOnSimObject(HANDLE,
+                                      SIMCONNECT_DATA_DEFINITION_ID,
+                                      SIMCONNECT_OBJECT_ID,
+                                      SIMCONNECT_DATA_SET_FLAG,
+                                      DWORD,
+                                      DWORD,
+                                      void*) {
+  return S_OK;
+}
+
+HRESULT SimConnect_MapClientEventToSimEvent(HANDLE, SIMCONNECT_CLIENT_EVENT_ID, const char*) {
+  return S_OK;
+}
+
+HRESULT SimConnect_AddClientEventToNotificationGroup(HANDLE, SIMCONNECT_NOTIFICATION_GROUP_ID, SIMCONNECT_CLIENT_EVENT_ID, int) {
+  return S_OK;
+}
+
+HRESULT SimConnect_SetNotificationGroupPriority(HANDLE, SIMCONNECT_NOTIFICATION_GROUP_ID, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_TransmitClientEvent(HANDLE,
+                                       SIMCONNECT_OBJECT_ID,
+                                       SIMCONNECT_CLIENT_EVENT_ID,
+                                       DWORD,
+                                       SIMCONNECT_NOTIFICATION_GROUP_ID,
+                                       SIMCONNECT_EVENT_FLAG) {
+  numberOfEvents++;
+  return S_OK;
+}
+
+HRESULT SimConnect_MapClientDataNameToID(HANDLE, const char*, SIMCONNECT_CLIENT_DATA_ID) {
+  return S_OK;
+}
+
+HRESULT SimConnect_CreateClientData(HANDLE, SIMCONNECT_CLIENT_DATA_ID, DWORD, SIMCONNECT_CREATE_CLIENT_DATA_FLAG) {
+  return S_OK;
+}
+
+HRESULT SimConnect_AddToClientDataDefinition(HANDLE, SIMCONNECT_CLIENT_DATA_DEFINITION_ID, DWORD, DWORD, float, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_RequestClientData(HANDLE,
+                                     SIMCONNECT_CLIENT_DATA_ID,
+                                     SIMCONNECT_DATA_REQUEST_ID,
+                                     SIMCONNECT_CLIENT_DATA_DEFINITION_ID,
+                                     SIMCONNECT_CLIENT_DATA_PERIOD,
+                                     SIMCONNECT_CLIENT_DATA_REQUEST_FLAG,
+                                     DWORD,
+                                     DWORD,
+                                     DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_SetClientData(HANDLE,
+                                 SIMCONNECT_CLIENT_DATA_ID,
+                                 SIMCONNECT_CLIENT_DATA_DEFINITION_ID,
+                                 SIMCONNECT_CLIENT_DATA_SET_FLAG,
+                                 DWORD,
+                                 DWORD,
+                                 void*) {
+  return S_OK;
+}
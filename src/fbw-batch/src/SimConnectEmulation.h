@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+#include <SimConnect.h>
+
+class SimConnectEmulation {
+ public:
+  SimConnectEmulation() = delete;
+  ~SimConnectEmulation() = delete;
+
+  // data of the user aircraft, it is returned for every request with period once on the given definition
+  static void setSimObjectData(SIMCONNECT_DATA_DEFINITION_ID definitionId, const void* data, DWORD size);
+
+  static uint64_t getNumberOfRequests();
+  static uint64_t getNumberOfEvents();
+};
@@ -0,0 +1,277 @@
+// The selected models are compiled a second time with real_T = float in the namespace SinglePrecision. The bus types
+// of the regular build are already expanded by SinglePrecisionModels.h, their include guards are reset so that the
+// models get their own float buses (the enumerations are shared). The buses are converted field by field.
+#include "SinglePrecisionModels.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "rtwtypes.h"
+
+#undef RTW_HEADER_Autothrust_types_h_
+#undef DEFINED_TYPEDEF_FOR_athr_time_
+#undef DEFINED_TYPEDEF_FOR_athr_raw_data_
+#undef DEFINED_TYPEDEF_FOR_athr_input_
+#undef DEFINED_TYPEDEF_FOR_athr_in_
+#undef DEFINED_TYPEDEF_FOR_athr_data_
+#undef DEFINED_TYPEDEF_FOR_athr_data_computed_
+#undef DEFINED_TYPEDEF_FOR_athr_output_
+#undef DEFINED_TYPEDEF_FOR_athr_out_
+#undef RTW_HEADER_ThrustLimits_types_h_
+#undef DEFINED_TYPEDEF_FOR_thrust_limits_in_
+#undef DEFINED_TYPEDEF_FOR_thrust_limits_out_
+
+#define real_T real32_T
+namespace SinglePrecision {
+#include "Autothrust.cpp"
+#include "Autothrust_data.cpp"
+#include "ThrustLimits.cpp"
+#include "ThrustLimits_data.cpp"
+#include "look1_binlxpw.cpp"
+#include "look2_binlcpw.cpp"
+#include "look2_binlxpw.cpp"
+}  // namespace SinglePrecision
+#undef real_T
+
+template <typename From, typename To>
+static void convertAthrTime(const From& from, To& to) {
+  to.dt = from.dt;
+  to.simulation_time = from.simulation_time;
+}
+
+template <typename From, typename To>
+static void convertAthrRawData(const From& from, To& to) {
+  to.nz_g = from.nz_g;
+  to.Theta_deg = from.Theta_deg;
+  to.Phi_deg = from.Phi_deg;
+  to.V_ias_kn = from.V_ias_kn;
+  to.V_tas_kn = from.V_tas_kn;
+  to.V_mach = from.V_mach;
+  to.V_gnd_kn = from.V_gnd_kn;
+  to.alpha_deg = from.alpha_deg;
+  to.H_ft = from.H_ft;
+  to.H_ind_ft = from.H_ind_ft;
+  to.H_radio_ft = from.H_radio_ft;
+  to.H_dot_fpm = from.H_dot_fpm;
+  to.bx_m_s2 = from.bx_m_s2;
+  to.by_m_s2 = from.by_m_s2;
+  to.bz_m_s2 = from.bz_m_s2;
+  to.Psi_magnetic_deg = from.Psi_magnetic_deg;
+  to.Psi_magnetic_track_deg = from.Psi_magnetic_track_deg;
+  to.gear_strut_compression_1 = from.gear_strut_compression_1;
+  to.gear_strut_compression_2 = from.gear_strut_compression_2;
+  to.flap_handle_index = from.flap_handle_index;
+  to.is_engine_operative_1 = from.is_engine_operative_1;
+  to.is_engine_operative_2 = from.is_engine_operative_2;
+  to.commanded_engine_N1_1_percent = from.commanded_engine_N1_1_percent;
+  to.commanded_engine_N1_2_percent = from.commanded_engine_N1_2_percent;
+  to.engine_N1_1_percent = from.engine_N1_1_percent;
+  to.engine_N1_2_percent = from.engine_N1_2_percent;
+  to.corrected_engine_N1_1_percent = from.corrected_engine_N1_1_percent;
+  to.corrected_engine_N1_2_percent = from.corrected_engine_N1_2_percent;
+  to.TAT_degC = from.TAT_degC;
+  to.OAT_degC = from.OAT_degC;
+  to.ambient_density_kg_per_m3 = from.ambient_density_kg_per_m3;
+}
+
+template <typename From, typename To>
+static void convertAthrInput(const From& from, To& to) {
+  to.ATHR_push = from.ATHR_push;
+  to.ATHR_disconnect = from.ATHR_disconnect;
+  to.TLA_1_deg = from.TLA_1_deg;
+  to.TLA_2_deg = from.TLA_2_deg;
+  to.V_c_kn = from.V_c_kn;
+  to.V_LS_kn = from.V_LS_kn;
+  to.V_MAX_kn = from.V_MAX_kn;
+  to.thrust_limit_REV_percent = from.thrust_limit_REV_percent;
+  to.thrust_limit_IDLE_percent = from.thrust_limit_IDLE_percent;
+  to.thrust_limit_CLB_percent = from.thrust_limit_CLB_percent;
+  to.thrust_limit_MCT_percent = from.thrust_limit_MCT_percent;
+  to.thrust_limit_FLEX_percent = from.thrust_limit_FLEX_percent;
+  to.thrust_limit_TOGA_percent = from.thrust_limit_TOGA_percent;
+  to.flex_temperature_degC = from.flex_temperature_degC;
+  to.mode_requested = from.mode_requested;
+  to.is_mach_mode_active = from.is_mach_mode_active;
+  to.alpha_floor_condition = from.alpha_floor_condition;
+  to.is_approach_mode_active = from.is_approach_mode_active;
+  to.is_SRS_TO_mode_active = from.is_SRS_TO_mode_active;
+  to.is_SRS_GA_mode_active = from.is_SRS_GA_mode_active;
+  to.is_LAND_mode_active = from.is_LAND_mode_active;
+  to.thrust_reduction_altitude = from.thrust_reduction_altitude;
+  to.thrust_reduction_altitude_go_around = from.thrust_reduction_altitude_go_around;
+  to.flight_phase = from.flight_phase;
+  to.is_alt_soft_mode_active = from.is_alt_soft_mode_active;
+  to.is_anti_ice_wing_active = from.is_anti_ice_wing_active;
+  to.is_anti_ice_engine_1_active = from.is_anti_ice_engine_1_active;
+  to.is_anti_ice_engine_2_active = from.is_anti_ice_engine_2_active;
+  to.is_air_conditioning_1_active = from.is_air_conditioning_1_active;
+  to.is_air_conditioning_2_active = from.is_air_conditioning_2_active;
+  to.FD_active = from.FD_active;
+  to.ATHR_reset_disable = from.ATHR_reset_disable;
+  to.is_TCAS_active = from.is_TCAS_active;
+  to.target_TCAS_RA_rate_fpm = from.target_TCAS_RA_rate_fpm;
+}
+
+template <typename From, typename To>
+static void convertAthrIn(const From& from, To& to) {
+  convertAthrTime(from.time, to.time);
+  convertAthrRawData(from.data, to.data);
+  convertAthrInput(from.input, to.input);
+}
+
+template <typename From, typename To>
+static void convertAthrData(const From& from, To& to) {
+  to.nz_g = from.nz_g;
+  to.Theta_deg = from.Theta_deg;
+  to.Phi_deg = from.Phi_deg;
+  to.V_ias_kn = from.V_ias_kn;
+  to.V_tas_kn = from.V_tas_kn;
+  to.V_mach = from.V_mach;
+  to.V_gnd_kn = from.V_gnd_kn;
+  to.alpha_deg = from.alpha_deg;
+  to.H_ft = from.H_ft;
+  to.H_ind_ft = from.H_ind_ft;
+  to.H_radio_ft = from.H_radio_ft;
+  to.H_dot_fpm = from.H_dot_fpm;
+  to.ax_m_s2 = from.ax_m_s2;
+  to.ay_m_s2 = from.ay_m_s2;
+  to.az_m_s2 = from.az_m_s2;
+  to.bx_m_s2 = from.bx_m_s2;
+  to.by_m_s2 = from.by_m_s2;
+  to.bz_m_s2 = from.bz_m_s2;
+  to.Psi_magnetic_deg = from.Psi_magnetic_deg;
+  to.Psi_magnetic_track_deg = from.Psi_magnetic_track_deg;
+  to.on_ground = from.on_ground;
+  to.flap_handle_index = from.flap_handle_index;
+  to.is_engine_operative_1 = from.is_engine_operative_1;
+  to.is_engine_operative_2 = from.is_engine_operative_2;
+  to.commanded_engine_N1_1_percent = from.commanded_engine_N1_1_percent;
+  to.commanded_engine_N1_2_percent = from.commanded_engine_N1_2_percent;
+  to.engine_N1_1_percent = from.engine_N1_1_percent;
+  to.engine_N1_2_percent = from.engine_N1_2_percent;
+  to.TAT_degC = from.TAT_degC;
+  to.OAT_degC = from.OAT_degC;
+  to.ISA_degC = from.ISA_degC;
+  to.ambient_density_kg_per_m3 = from.ambient_density_kg_per_m3;
+}
+
+template <typename From, typename To>
+static void convertAthrDataComputed(const From& from, To& to) {
+  to.TLA_in_active_range = from.TLA_in_active_range;
+  to.is_FLX_active = from.is_FLX_active;
+  to.ATHR_push = from.ATHR_push;
+  to.ATHR_disabled = from.ATHR_disabled;
+  to.time_since_touchdown = from.time_since_touchdown;
+  to.alpha_floor_inhibited = from.alpha_floor_inhibited;
+}
+
+template <typename From, typename To>
+static void convertAthrOutput(const From& from, To& to) {
+  to.sim_throttle_lever_1_pos = from.sim_throttle_lever_1_pos;
+  to.sim_throttle_lever_2_pos = from.sim_throttle_lever_2_pos;
+  to.sim_thrust_mode_1 = from.sim_thrust_mode_1;
+  to.sim_thrust_mode_2 = from.sim_thrust_mode_2;
+  to.N1_TLA_1_percent = from.N1_TLA_1_percent;
+  to.N1_TLA_2_percent = from.N1_TLA_2_percent;
+  to.is_in_reverse_1 = from.is_in_reverse_1;
+  to.is_in_reverse_2 = from.is_in_reverse_2;
+  to.thrust_limit_type = from.thrust_limit_type;
+  to.thrust_limit_percent = from.thrust_limit_percent;
+  to.N1_c_1_percent = from.N1_c_1_percent;
+  to.N1_c_2_percent = from.N1_c_2_percent;
+  to.status = from.status;
+  to.mode = from.mode;
+  to.mode_message = from.mode_message;
+  to.thrust_lever_warning_flex = from.thrust_lever_warning_flex;
+  to.thrust_lever_warning_toga = from.thrust_lever_warning_toga;
+}
+
+template <typename From, typename To>
+static void convertAthrOut(const From& from, To& to) {
+  convertAthrTime(from.time, to.time);
+  convertAthrData(from.data, to.data);
+  convertAthrDataComputed(from.data_computed, to.data_computed);
+  convertAthrInput(from.input, to.input);
+  convertAthrOutput(from.output, to.output);
+}
+
+template <typename From, typename To>
+static void convertThrustLimitsIn(const From& from, To& to) {
+  to.dt = from.dt;
+  to.simulation_time_s = from.simulation_time_s;
+  to.H_ft = from.H_ft;
+  to.V_mach = from.V_mach;
+  to.TAT_degC = from.TAT_degC;
+  to.OAT_degC = from.OAT_degC;
+  to.ISA_degC = from.ISA_degC;
+  to.is_anti_ice_wing_active = from.is_anti_ice_wing_active;
+  to.is_anti_ice_engine_1_active = from.is_anti_ice_engine_1_active;
+  to.is_anti_ice_engine_2_active = from.is_anti_ice_engine_2_active;
+  to.is_air_conditioning_1_active = from.is_air_conditioning_1_active;
+  to.is_air_conditioning_2_active = from.is_air_conditioning_2_active;
+  to.thrust_limit_IDLE_percent = from.thrust_limit_IDLE_percent;
+  to.flex_temperature_degC = from.flex_temperature_degC;
+  to.use_external_CLB_limit = from.use_external_CLB_limit;
+  to.thrust_limit_CLB_percent = from.thrust_limit_CLB_percent;
+  to.thrust_limit_type = from.thrust_limit_type;
+}
+
+template <typename From, typename To>
+static void convertThrustLimitsOut(const From& from, To& to) {
+  to.thrust_limit_IDLE_percent = from.thrust_limit_IDLE_percent;
+  to.thrust_limit_CLB_percent = from.thrust_limit_CLB_percent;
+  to.thrust_limit_FLEX_percent = from.thrust_limit_FLEX_percent;
+  to.thrust_limit_MCT_percent = from.thrust_limit_MCT_percent;
+  to.thrust_limit_TOGA_percent = from.thrust_limit_TOGA_percent;
+}
+
+struct SinglePrecisionAutothrust::Model {
+  SinglePrecision::AutothrustModelClass model;
+  SinglePrecision::AutothrustModelClass::ExternalInputs_Autothrust_T input;
+  athr_out output;
+};
+
+SinglePrecisionAutothrust::SinglePrecisionAutothrust() : model(new Model()) {}
+
+SinglePrecisionAutothrust::~SinglePrecisionAutothrust() = default;
+
+void SinglePrecisionAutothrust::initialize() {
+  model->model.initialize();
+}
+
+void SinglePrecisionAutothrust::step(const athr_in& input) {
+  convertAthrIn(input, model->input.in);
+  model->model.setExternalInputs(&model->input);
+  model->model.step();
+  convertAthrOut(model->model.getExternalOutputs().out, model->output);
+}
+
+const athr_out& SinglePrecisionAutothrust::getOutput() const {
+  return model->output;
+}
+
+struct SinglePrecisionThrustLimits::Model {
+  SinglePrecision::ThrustLimitsModelClass model;
+  SinglePrecision::ThrustLimitsModelClass::ExternalInputs_ThrustLimits_T input;
+  thrust_limits_out output;
+};
+
+SinglePrecisionThrustLimits::SinglePrecisionThrustLimits() : model(new Model()) {}
+
+SinglePrecisionThrustLimits::~SinglePrecisionThrustLimits() = default;
+
+void SinglePrecisionThrustLimits::initialize() {
+  model->model.initialize();
+}
+
+void SinglePrecisionThrustLimits::step(const thrust_limits_in& input) {
+  convertThrustLimitsIn(input, model->input.in);
+  model->model.setExternalInputs(&model->input);
+  model->model.step();
+  convertThrustLimitsOut(model->model.getExternalOutputs().out, model->output);
+}
+
+const thrust_limits_out& SinglePrecisionThrustLimits::getOutput() const {
+  return model->output;
+}
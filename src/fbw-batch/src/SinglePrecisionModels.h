@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+
+#include "Autothrust_types.h"
+#include "ThrustLimits_types.h"
+
+// Build variant of the autothrust and thrust limits models with real_T = float. The generated code is compiled a
+// second time in its own namespace (see SinglePrecisionModels.cpp), so that both variants can be stepped side by side.
+// States, parameters, tables, signals and buses of the models are float, the wrappers convert the double buses of the
+// regular build, so the variants take the same inputs and their outputs can be compared directly.
+class SinglePrecisionAutothrust {
+ public:
+  SinglePrecisionAutothrust();
+  ~SinglePrecisionAutothrust();
+
+  void initialize();
+  void step(const athr_in& input);
+  const athr_out& getOutput() const;
+
+ private:
+  struct Model;
+  std::unique_ptr<Model> model;
+};
+
+class SinglePrecisionThrustLimits {
+ public:
+  SinglePrecisionThrustLimits();
+  ~SinglePrecisionThrustLimits();
+
+  void initialize();
+  void step(const thrust_limits_in& input);
+  const thrust_limits_out& getOutput() const;
+
+ private:
+  struct Model;
+  std::unique_ptr<Model> model;
+};
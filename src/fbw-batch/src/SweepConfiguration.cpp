@@ -0,0 +1,235 @@
+#include "SweepConfiguration.h"
+
+#include <ini.h>
+#include <ini_type_conversion.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#include "rtwtypes.h"
+
+using namespace std;
+using namespace mINI;
+
+namespace {
+
+string toLower(string value) {
+  transform(value.begin(), value.end(), value.begin(), ::tolower);
+  return value;
+}
+
+string trim(const string& value) {
+  auto first = value.find_first_not_of(" \t");
+  if (first == string::npos) {
+    return "";
+  }
+  auto last = value.find_last_not_of(" \t");
+  return value.substr(first, last - first + 1);
+}
+
+vector<string> split(const string& value, char delimiter) {
+  vector<string> result;
+  stringstream stream(value);
+  string item;
+  while (getline(stream, item, delimiter)) {
+    result.push_back(trim(item));
+  }
+  return result;
+}
+
+bool toDouble(const string& value, double& result) {
+  stringstream stream(value);
+  stream >> result;
+  return !stream.fail() && stream.eof();
+}
+
+bool findParameter(ModelType model, const string& key, ParameterAddress& address) {
+  const ParameterEntry* table = model == ModelType::FLY_BY_WIRE ? FlyByWireParameterTable : AutothrustParameterTable;
+  size_t tableSize = model == ModelType::FLY_BY_WIRE ? FlyByWireParameterTableSize : AutothrustParameterTableSize;
+
+  // optional array index: name[index]
+  string name = key;
+  size_t index = 0;
+  auto bracket = key.find('[');
+  if (bracket != string::npos) {
+    name = key.substr(0, bracket);
+    const char* begin = key.c_str() + bracket + 1;
+    char* end = nullptr;
+    index = strtoul(begin, &end, 10);
+    if (!isdigit(static_cast<unsigned char>(*begin)) || *end != ']' || *(end + 1) != '\0') {
+      cout << "Invalid index for parameter '" << key << "'!" << endl;
+      return false;
+    }
+  }
+
+  // ini keys are case insensitive
+  for (size_t i = 0; i < tableSize; i++) {
+    if (toLower(table[i].name) == name) {
+      if (index >= table[i].count) {
+        cout << "Index out of range for parameter '" << table[i].name << "'!" << endl;
+        return false;
+      }
+      address.model = model;
+      address.name = (model == ModelType::FLY_BY_WIRE ? "flybywire." : "autothrust.") + string(table[i].name);
+      if (bracket != string::npos) {
+        address.name += "[" + to_string(index) + "]";
+      }
+      address.offset = table[i].offset + index * sizeof(real_T);
+      return true;
+    }
+  }
+
+  cout << "Unknown parameter '" << key << "'!" << endl;
+  return false;
+}
+
+bool findOutput(const string& key, CostTerm& term) {
+  auto dot = key.find('.');
+  if (dot == string::npos) {
+    cout << "Cost output '" << key << "' needs to start with the model name!" << endl;
+    return false;
+  }
+
+  string model = key.substr(0, dot);
+  string name = key.substr(dot + 1);
+  const OutputEntry* table;
+  size_t tableSize;
+  if (model == "flybywire") {
+    term.model = ModelType::FLY_BY_WIRE;
+    table = FlyByWireOutputTable;
+    tableSize = FlyByWireOutputTableSize;
+  } else if (model == "autothrust") {
+    term.model = ModelType::AUTOTHRUST;
+    table = AutothrustOutputTable;
+    tableSize = AutothrustOutputTableSize;
+  } else {
+    cout << "Unknown model '" << model << "' in cost output '" << key << "'!" << endl;
+    return false;
+  }
+
+  for (size_t i = 0; i < tableSize; i++) {
+    if (toLower(table[i].name) == name) {
+      term.name = model + "." + table[i].name;
+      term.offset = table[i].offset;
+      term.type = table[i].type;
+      return true;
+    }
+  }
+
+  cout << "Unknown cost output '" << key << "'!" << endl;
+  return false;
+}
+
+bool loadParameters(INIStructure& ini, const string& section, ModelType model, SweepConfiguration& configuration) {
+  if (!ini.has(section)) {
+    return true;
+  }
+
+  for (const auto& item : ini.get(section)) {
+    ParameterAddress address;
+    if (!findParameter(model, item.first, address)) {
+      return false;
+    }
+
+    auto values = split(item.second, ':');
+    if (values.size() == 1) {
+      ParameterOverride parameterOverride = {address, 0.0};
+      if (!toDouble(values[0], parameterOverride.value)) {
+        cout << "Invalid value for parameter '" << address.name << "'!" << endl;
+        return false;
+      }
+      configuration.overrides.push_back(parameterOverride);
+    } else if (values.size() == 3) {
+      SweepDimension dimension = {address, 0.0, 0.0, 0};
+      double steps;
+      if (!toDouble(values[0], dimension.minimum) || !toDouble(values[1], dimension.maximum) || !toDouble(values[2], steps) ||
+          steps < 1) {
+        cout << "Invalid range for parameter '" << address.name << "'!" << endl;
+        return false;
+      }
+      dimension.steps = static_cast<uint32_t>(steps);
+      configuration.dimensions.push_back(dimension);
+    } else {
+      cout << "Expected 'value' or 'minimum : maximum : steps' for parameter '" << address.name << "'!" << endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool loadCost(INIStructure& ini, SweepConfiguration& configuration) {
+  if (!ini.has("COST")) {
+    cout << "Section COST is missing!" << endl;
+    return false;
+  }
+
+  for (const auto& item : ini.get("COST")) {
+    CostTerm term = {};
+    if (!findOutput(item.first, term)) {
+      return false;
+    }
+
+    auto values = split(toLower(item.second), ':');
+    if (values.empty() || values.size() > 2) {
+      cout << "Expected 'metric : weight' for cost output '" << term.name << "'!" << endl;
+      return false;
+    }
+
+    if (values[0] == "rms_error") {
+      term.metric = CostMetric::RMS_ERROR;
+    } else if (values[0] == "max_abs_error") {
+      term.metric = CostMetric::MAX_ABS_ERROR;
+    } else if (values[0] == "rms") {
+      term.metric = CostMetric::RMS;
+    } else if (values[0] == "max_abs") {
+      term.metric = CostMetric::MAX_ABS;
+    } else {
+      cout << "Unknown metric '" << values[0] << "' for cost output '" << term.name << "'!" << endl;
+      return false;
+    }
+
+    term.weight = 1.0;
+    if (values.size() == 2 && !toDouble(values[1], term.weight)) {
+      cout << "Invalid weight for cost output '" << term.name << "'!" << endl;
+      return false;
+    }
+
+    configuration.costTerms.push_back(term);
+  }
+
+  if (configuration.costTerms.empty()) {
+    cout << "Section COST is empty!" << endl;
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace
+
+bool SweepConfiguration::load(const string& filePath) {
+  INIStructure ini;
+  INIFile iniFile(filePath);
+  if (!iniFile.read(ini)) {
+    cout << "Failed to read sweep configuration '" << filePath << "'!" << endl;
+    return false;
+  }
+
+  string modeValue = toLower(ini.get("SWEEP").get("mode"));
+  if (modeValue.empty() || modeValue == "grid") {
+    mode = SweepMode::GRID;
+  } else if (modeValue == "random") {
+    mode = SweepMode::RANDOM;
+  } else {
+    cout << "Unknown sweep mode '" << modeValue << "'!" << endl;
+    return false;
+  }
+  samples = INITypeConversion::getInteger(ini, "SWEEP", "samples", samples);
+  seed = INITypeConversion::getInteger(ini, "SWEEP", "seed", seed);
+
+  return loadParameters(ini, "FLYBYWIRE", ModelType::FLY_BY_WIRE, *this) &&
+         loadParameters(ini, "AUTOTHRUST", ModelType::AUTOTHRUST, *this) && loadCost(ini, *this);
+}
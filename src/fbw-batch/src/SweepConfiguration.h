@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ModelTables.h"
+
+enum class ModelType { FLY_BY_WIRE, AUTOTHRUST };
+
+enum class SweepMode { GRID, RANDOM };
+
+enum class CostMetric { RMS_ERROR, MAX_ABS_ERROR, RMS, MAX_ABS };
+
+// a single real_T element in the parameter struct of a model
+struct ParameterAddress {
+  ModelType model;
+  std::string name;
+  size_t offset;
+};
+
+struct ParameterOverride {
+  ParameterAddress parameter;
+  double value;
+};
+
+struct SweepDimension {
+  ParameterAddress parameter;
+  double minimum;
+  double maximum;
+  uint32_t steps;
+};
+
+struct CostTerm {
+  ModelType model;
+  std::string name;
+  size_t offset;
+  ValueType type;
+  CostMetric metric;
+  double weight;
+};
+
+// Configuration of a parameter sweep, read from an ini file:
+//
+//   [SWEEP]
+//   mode = grid
+//   samples = 200
+//   seed = 0
+//
+//   [FLYBYWIRE]
+//   Gain_Gain_n = -50.0
+//   ScheduledGain_Table[2] = 0.5 : 2.0 : 4
+//
+//   [AUTOTHRUST]
+//   LagFilter_C1 = 0.5 : 3.0 : 6
+//
+//   [COST]
+//   flybywire.output.eta_pos = rms_error : 1.0
+//   autothrust.output.N1_c_1_percent = max_abs_error : 0.1
+//
+// A parameter is either fixed to a value or swept from minimum to maximum.
+// In grid mode every range is split into the given number of steps and all
+// combinations are evaluated, in random mode the given number of samples is
+// drawn uniformly from the ranges. The cost is the weighted sum of the given
+// metrics over all frames of all scenarios. Error metrics compare the model
+// output against the recorded one.
+struct SweepConfiguration {
+  SweepMode mode = SweepMode::GRID;
+  uint32_t samples = 100;
+  uint32_t seed = 0;
+  std::vector<ParameterOverride> overrides;
+  std::vector<SweepDimension> dimensions;
+  std::vector<CostTerm> costTerms;
+
+  bool load(const std::string& filePath);
+};
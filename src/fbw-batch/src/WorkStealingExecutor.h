@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Executes a fixed number of independent jobs on a set of worker threads.
+// Every worker owns a queue of job indices. It takes work from the back of its
+// own queue and, when that queue is empty, steals from the front of the queues
+// of the other workers. Jobs of very different length (e.g. Monte Carlo runs
+// with a randomized duration) are therefore balanced without a central queue.
+class WorkStealingExecutor {
+ public:
+  explicit WorkStealingExecutor(unsigned int numberOfWorkers)
+      : numberOfWorkers(numberOfWorkers > 0 ? numberOfWorkers : 1), numberOfSteals(0) {}
+
+  // job is called as job(jobIndex, workerIndex) exactly once for every index
+  template <typename Job>
+  void run(size_t numberOfJobs, Job&& job) {
+    std::vector<std::unique_ptr<Queue>> queues;
+    for (unsigned int i = 0; i < numberOfWorkers; i++) {
+      queues.emplace_back(std::make_unique<Queue>());
+    }
+
+    // distribute jobs round-robin so that every worker starts with work
+    for (size_t i = 0; i < numberOfJobs; i++) {
+      queues[i % numberOfWorkers]->jobs.push_back(i);
+    }
+
+    std::vector<std::thread> workers;
+    for (unsigned int worker = 0; worker < numberOfWorkers; worker++) {
+      workers.emplace_back([this, worker, &queues, &job]() {
+        size_t jobIndex;
+        while (popOwn(*queues[worker], jobIndex) || steal(queues, worker, jobIndex)) {
+          job(jobIndex, worker);
+        }
+      });
+    }
+
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+
+  unsigned int getNumberOfWorkers() const { return numberOfWorkers; }
+
+  uint64_t getNumberOfSteals() const { return numberOfSteals.load(); }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<size_t> jobs;
+  };
+
+  const unsigned int numberOfWorkers;
+  std::atomic<uint64_t> numberOfSteals;
+
+  static bool popOwn(Queue& queue, size_t& jobIndex) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty()) {
+      return false;
+    }
+    jobIndex = queue.jobs.back();
+    queue.jobs.pop_back();
+    return true;
+  }
+
+  bool steal(std::vector<std::unique_ptr<Queue>>& queues, unsigned int thief, size_t& jobIndex) {
+    // jobs are never added while running, so one pass over all victims is sufficient
+    for (unsigned int offset = 1; offset < numberOfWorkers; offset++) {
+      Queue& victim = *queues[(thief + offset) % numberOfWorkers];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.jobs.empty()) {
+        jobIndex = victim.jobs.front();
+        victim.jobs.pop_front();
+        numberOfSteals++;
+        return true;
+      }
+    }
+    return false;
+  }
+};
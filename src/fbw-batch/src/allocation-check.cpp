@@ -0,0 +1,203 @@
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+#include "AllocationCounter.h"
+#include "CommandLine.hpp"
+#include "FlyByWireInterface.h"
+#include "SimConnectEmulation.h"
+
+using namespace std;
+
+// steady flight of the user aircraft as seen by the module
+static SimData createSimData() {
+  SimData simData = {};
+  simData.simulationTime = 1.0;
+  simData.simulation_rate = 1;
+  simData.H_ft = 10000;
+  simData.H_radio_ft = 10000;
+  simData.V_ias_kn = 250;
+  simData.V_tas_kn = 290;
+  simData.V_mach = 0.45;
+  simData.Theta_deg = -2.5;
+  simData.alpha_deg = 2.5;
+  simData.nz_g = 1;
+  simData.ambient_temperature_celsius = -5;
+  simData.total_air_temperature_celsius = 5;
+  simData.engine_combustion_1 = 1;
+  simData.engine_combustion_2 = 1;
+  simData.kohlsmanSettingStd_3 = 1;
+  return simData;
+}
+
+// the module reads its configuration from the work folder, on the host these paths are plain files in the current
+// working directory
+static const char* MODEL_CONFIGURATION_FILEPATH = "\\work\\ModelConfiguration.ini";
+static const char* FLIGHT_DATA_RECORDER_CONFIGURATION_FILEPATH = "\\work\\FlightDataRecorder.ini";
+
+struct Configuration {
+  const char* name;
+  const char* modelConfiguration;
+  const char* flightDataRecorderConfiguration;
+};
+
+static const char* DEFAULT_FLIGHT_DATA_RECORDER_CONFIGURATION =
+    "[FLIGHT_DATA_RECORDER]\n"
+    "ENABLED = true\n"
+    "MAXIMUM_NUMBER_OF_FILES = 15\n"
+    "MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE = 864000\n";
+
+// every configuration enables an optional code path of the update loop
+static const Configuration CONFIGURATIONS[] = {
+    {"default", "", DEFAULT_FLIGHT_DATA_RECORDER_CONFIGURATION},
+    {"flight data recorder rotation", "",
+     "[FLIGHT_DATA_RECORDER]\n"
+     "ENABLED = true\n"
+     "MAXIMUM_NUMBER_OF_FILES = 15\n"
+     "MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE = 500\n"},
+    {"profiling",
+     "[PROFILING]\n"
+     "ENABLED = true\n"
+     "FLIGHT_DATA_RECORDER_ENABLED = true\n"
+     "WINDOW_SIZE = 60\n"
+     "LOG_INTERVAL = 1.0\n",
+     DEFAULT_FLIGHT_DATA_RECORDER_CONFIGURATION},
+    {"rate scheduler",
+     "[SCHEDULER]\n"
+     "ENABLED = true\n",
+     DEFAULT_FLIGHT_DATA_RECORDER_CONFIGURATION},
+    {"fixed rate",
+     "[MODEL]\n"
+     "FIXED_RATE_ENABLED = true\n"
+     "FIXED_RATE_FREQUENCY = 90\n",
+     DEFAULT_FLIGHT_DATA_RECORDER_CONFIGURATION},
+    {"client data change detection",
+     "[MODEL]\n"
+     "AUTOTHRUST_ENABLED = false\n"
+     "[SIMCONNECT]\n"
+     "CLIENT_DATA_CHANGED_ONLY = true\n"
+     "CLIENT_DATA_HEARTBEAT_PERIOD = 0.5\n",
+     DEFAULT_FLIGHT_DATA_RECORDER_CONFIGURATION},
+};
+
+static bool writeFile(const char* filepath, const char* content) {
+  ofstream file(filepath, ios::trunc);
+  file << content;
+  return file.good();
+}
+
+// connects a new module with the given configuration and counts the allocations of the frames after warm-up
+static bool runConfiguration(const Configuration& configuration,
+                             uint32_t numberOfWarmUpFrames,
+                             uint32_t numberOfFrames,
+                             double sampleTime,
+                             uint64_t& allocationsAfterWarmUp,
+                             uint64_t& bytesAfterWarmUp,
+                             uint32_t& framesWithAllocations) {
+  // store configuration in the work folder
+  if (!writeFile(MODEL_CONFIGURATION_FILEPATH, configuration.modelConfiguration) ||
+      !writeFile(FLIGHT_DATA_RECORDER_CONFIGURATION_FILEPATH, configuration.flightDataRecorderConfiguration)) {
+    cout << "Writing configuration failed!" << endl;
+    return false;
+  }
+
+  // connect module to emulated simulator
+  SimData simData = createSimData();
+  SimConnectEmulation::setSimObjectData(0, &simData, sizeof(simData));
+  auto flyByWireInterface = make_unique<FlyByWireInterface>();
+  if (!flyByWireInterface->connect()) {
+    cout << "Connect failed!" << endl;
+    return false;
+  }
+
+  // run frames and count allocations of each update
+  allocationsAfterWarmUp = 0;
+  bytesAfterWarmUp = 0;
+  framesWithAllocations = 0;
+  for (uint32_t frame = 0; frame < numberOfWarmUpFrames + numberOfFrames; frame++) {
+    simData.simulationTime += sampleTime;
+    SimConnectEmulation::setSimObjectData(0, &simData, sizeof(simData));
+
+    uint64_t allocations = AllocationCounter::getNumberOfAllocations();
+    uint64_t bytes = AllocationCounter::getAllocatedBytes();
+    flyByWireInterface->update(sampleTime);
+    allocations = AllocationCounter::getNumberOfAllocations() - allocations;
+    bytes = AllocationCounter::getAllocatedBytes() - bytes;
+
+    if (frame < numberOfWarmUpFrames || allocations == 0) {
+      continue;
+    }
+    if (framesWithAllocations < 10) {
+      cout << "Frame " << frame << ": " << allocations << " allocation(s) with " << bytes << " bytes" << endl;
+    }
+    allocationsAfterWarmUp += allocations;
+    bytesAfterWarmUp += bytes;
+    framesWithAllocations++;
+  }
+
+  flyByWireInterface->disconnect();
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  uint32_t numberOfWarmUpFrames = 300;
+  uint32_t numberOfFrames = 3000;
+  double sampleTime = 1.0 / 60.0;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args(
+      "Runs the fly-by-wire module headless in several configurations and checks that update() does not allocate after warm-up");
+  args.addArgument({"-w", "--warm-up"}, &numberOfWarmUpFrames, "Number of frames before allocations are counted");
+  args.addArgument({"-f", "--frames"}, &numberOfFrames, "Number of checked frames");
+  args.addArgument({"-t", "--sample-time"}, &sampleTime, "Sample time of each frame in seconds");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (numberOfFrames == 0 || sampleTime <= 0) {
+    cout << "Invalid parameters!" << endl;
+    return 1;
+  }
+
+  // run every configuration with a new module
+  bool isSuccessful = true;
+  for (const Configuration& configuration : CONFIGURATIONS) {
+    cout << "Configuration           : " << configuration.name << endl;
+
+    uint64_t allocationsAfterWarmUp = 0;
+    uint64_t bytesAfterWarmUp = 0;
+    uint32_t framesWithAllocations = 0;
+    if (!runConfiguration(configuration, numberOfWarmUpFrames, numberOfFrames, sampleTime, allocationsAfterWarmUp, bytesAfterWarmUp,
+                          framesWithAllocations)) {
+      return 1;
+    }
+
+    // print result
+    cout << "Checked frames          : " << numberOfFrames << " (after " << numberOfWarmUpFrames << " warm-up frames)" << endl;
+    cout << "Frames with allocations : " << framesWithAllocations << endl;
+    cout << "Allocations             : " << allocationsAfterWarmUp << " (" << bytesAfterWarmUp << " bytes)" << endl;
+    cout << endl;
+
+    isSuccessful &= allocationsAfterWarmUp == 0;
+  }
+
+  return isSuccessful ? 0 : 1;
+}
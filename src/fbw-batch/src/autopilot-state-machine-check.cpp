@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AutopilotStateMachine.h"
+#include "CommandLine.hpp"
+#include "FlightDataRecorderReplay.h"
+
+using namespace std;
+
+struct CheckResult {
+  uint64_t numberOfFlights = 0;
+  uint64_t numberOfSteps = 0;
+  uint64_t numberOfMismatches = 0;
+  double referenceNanoseconds = 0;
+  double incrementalNanoseconds = 0;
+};
+
+// autopilot state machine inputs of the recorded flights, the model parameters are used to invert the input conversions
+static bool loadFlights(const vector<string>& filePaths, bool isCompressed, vector<vector<ap_sm_input>>& flights) {
+  auto model = make_unique<AutopilotStateMachineModelClass>();
+  for (const auto& filePath : filePaths) {
+    vector<ReplayFrame> frames;
+    if (!FlightDataRecorderReplay::load(filePath, isCompressed, frames, &model->getParameters())) {
+      return false;
+    }
+    vector<ap_sm_input> inputs;
+    inputs.reserve(frames.size());
+    for (const auto& frame : frames) {
+      inputs.push_back(frame.autopilotStateMachineInput);
+    }
+    flights.push_back(std::move(inputs));
+  }
+  return true;
+}
+
+// straight flight towards an ils station, used when no recorded flights are given
+static vector<ap_sm_input> generateFlight(uint32_t numberOfSteps) {
+  vector<ap_sm_input> inputs(numberOfSteps);
+  ap_sm_input input = {};
+  input.data.aircraft_position = {47.0, 8.0, 3000.0};
+  input.data.V_ias_kn = 160.0;
+  input.data.V_tas_kn = 170.0;
+  input.data.V_gnd_kn = 170.0;
+  input.data.H_ft = 3000.0;
+  input.data.H_ind_ft = 3000.0;
+  input.data.H_radio_ft = 2500.0;
+  input.data.flight_phase = 5.0;
+  input.data.is_engine_operative_1 = true;
+  input.data.is_engine_operative_2 = true;
+  input.data.altimeter_setting_left_mbar = 1013.0;
+  input.data.altimeter_setting_right_mbar = 1013.0;
+  input.input.FD_active = true;
+  input.input.V_fcu_kn = 160.0;
+  input.input.H_fcu_ft = 3000.0;
+  for (auto& frame : inputs) {
+    input.time.dt = 1.0 / 30.0;
+    input.time.simulation_time += input.time.dt;
+    frame = input;
+  }
+  return inputs;
+}
+
+// Variations of a flight that exercise the radio navigation inputs of the recorded frames: the aircraft moves or
+// stands still in segments, stations are received or lost and the buttons of the flight control unit are pushed.
+static void applyVariation(uint32_t variation, uint32_t seed, vector<ap_sm_input>& inputs) {
+  mt19937_64 generator(seed);
+  uniform_real_distribution<double> unit(0.0, 1.0);
+
+  ap_lat_lon_alt position = inputs.empty() ? ap_lat_lon_alt{} : inputs.front().data.aircraft_position;
+  if (position.lat == 0.0 && position.lon == 0.0) {
+    position = {47.0, 8.0, 3000.0};
+  }
+  bool isMoving = true;
+  bool isStationReceived = variation == 2;
+  for (auto& input : inputs) {
+    if (unit(generator) < 0.002) {
+      isMoving = !isMoving;
+    }
+    if (isMoving) {
+      position.lat += 2e-5;
+      position.lon += 1e-5 * unit(generator);
+      position.alt = max(0.0, position.alt - 2.0);
+    }
+    input.data.aircraft_position = position;
+    input.data.H_radio_ft = position.alt;
+
+    if (variation < 2) {
+      continue;
+    }
+    if (unit(generator) < 0.001) {
+      isStationReceived = !isStationReceived;
+    }
+    if (isStationReceived) {
+      input.data.nav_valid = true;
+      input.data.nav_loc_valid = true;
+      input.data.nav_gs_valid = true;
+      input.data.nav_loc_deg = 20.0;
+      input.data.nav_gs_deg = 3.0;
+      input.data.nav_loc_magvar_deg = 2.0;
+      input.data.nav_loc_position = {47.2, 8.05, 400.0};
+      input.data.nav_gs_position = {47.19, 8.05, 400.0};
+      input.data.nav_dme_valid = unit(generator) < 0.5 ? 1.0 : 0.0;
+    }
+    input.input.AP_1_push = unit(generator) < 0.001;
+    input.input.LOC_push = unit(generator) < 0.001;
+    input.input.APPR_push = unit(generator) < 0.001;
+  }
+}
+
+// steps the model over all inputs and returns the duration in nanoseconds
+static double runModel(AutopilotStateMachineModelClass& model,
+                       const vector<ap_sm_input>& inputs,
+                       vector<AutopilotStateMachineModelClass::ExternalOutputs_AutopilotStateMachine_T>& outputs) {
+  AutopilotStateMachineModelClass::ExternalInputs_AutopilotStateMachine_T input = {};
+  model.initialize();
+  auto start = chrono::steady_clock::now();
+  for (size_t i = 0; i < inputs.size(); i++) {
+    input.in = inputs[i];
+    model.setExternalInputs(&input);
+    model.step();
+    outputs[i] = model.getExternalOutputs();
+  }
+  return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+}
+
+static void checkFlight(const vector<ap_sm_input>& inputs, CheckResult& result) {
+  auto reference = make_unique<AutopilotStateMachineModelClass>();
+  auto incremental = make_unique<AutopilotStateMachineModelClass>();
+  incremental->setIncrementalEvaluation(true);
+
+  vector<AutopilotStateMachineModelClass::ExternalOutputs_AutopilotStateMachine_T> referenceOutputs(inputs.size());
+  vector<AutopilotStateMachineModelClass::ExternalOutputs_AutopilotStateMachine_T> incrementalOutputs(inputs.size());
+  result.referenceNanoseconds += runModel(*reference, inputs, referenceOutputs);
+  result.incrementalNanoseconds += runModel(*incremental, inputs, incrementalOutputs);
+
+  // compare the bit patterns of the whole output bus
+  for (size_t i = 0; i < inputs.size(); i++) {
+    if (memcmp(&referenceOutputs[i], &incrementalOutputs[i], sizeof(referenceOutputs[i])) != 0) {
+      if (result.numberOfMismatches < 10) {
+        cout << "Mismatch in flight " << result.numberOfFlights << " at step " << i << " (time "
+             << inputs[i].time.simulation_time << ")" << endl;
+      }
+      result.numberOfMismatches++;
+    }
+  }
+  result.numberOfFlights++;
+  result.numberOfSteps += inputs.size();
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  string inFilePath;
+  string inDirectoryPath;
+  bool noCompression = false;
+  uint32_t seed = 0;
+  uint32_t numberOfSteps = 100000;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Checks the incremental evaluation of the autopilot state machine bit by bit against the full evaluation");
+  args.addArgument({"-i", "--in"}, &inFilePath, "Recorded fdr file");
+  args.addArgument({"-d", "--directory"}, &inDirectoryPath, "Directory with recorded fdr files");
+  args.addArgument({"-n", "--no-compression"}, &noCompression, "Input files are not compressed");
+  args.addArgument({"-s", "--seed"}, &seed, "Seed for the variations of the flights");
+  args.addArgument({"-t", "--steps"}, &numberOfSteps, "Number of steps of the generated flight (without recorded flights)");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // get recorded flights
+  vector<string> filePaths;
+  if (!inFilePath.empty()) {
+    filePaths.push_back(inFilePath);
+  }
+  if (!inDirectoryPath.empty()) {
+    for (const auto& entry : filesystem::directory_iterator(inDirectoryPath)) {
+      if (entry.path().extension() == ".fdr") {
+        filePaths.push_back(entry.path().string());
+      }
+    }
+    sort(filePaths.begin(), filePaths.end());
+  }
+  vector<vector<ap_sm_input>> flights;
+  if (!loadFlights(filePaths, !noCompression, flights)) {
+    return 1;
+  }
+  if (flights.empty()) {
+    flights.push_back(generateFlight(numberOfSteps));
+  }
+
+  // every flight as recorded, moving and with received stations
+  CheckResult result;
+  for (size_t i = 0; i < flights.size(); i++) {
+    for (uint32_t variation = 0; variation < 3; variation++) {
+      vector<ap_sm_input> inputs = flights[i];
+      if (variation > 0) {
+        applyVariation(variation, seed + static_cast<uint32_t>(i), inputs);
+      }
+      checkFlight(inputs, result);
+    }
+  }
+
+  // print result
+  double numberOfCheckedSteps = static_cast<double>(max<uint64_t>(1, result.numberOfSteps));
+  cout << "Flights (variations)    : " << result.numberOfFlights << endl;
+  cout << "Steps                   : " << result.numberOfSteps << endl;
+  cout << fixed << setprecision(2);
+  cout << "Full [ns/step]          : " << result.referenceNanoseconds / numberOfCheckedSteps << endl;
+  cout << "Incremental [ns/step]   : " << result.incrementalNanoseconds / numberOfCheckedSteps << endl;
+  cout << "Mismatches              : " << result.numberOfMismatches << endl;
+
+  return result.numberOfMismatches == 0 ? 0 : 1;
+}
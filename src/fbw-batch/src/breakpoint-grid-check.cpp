@@ -0,0 +1,218 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Autothrust.h"
+#include "BreakpointGrid.h"
+#include "CommandLine.hpp"
+#include "FlyByWire.h"
+#include "ModelTables.h"
+#include "ThrustLimits.h"
+
+using namespace std;
+
+struct ModelParameters {
+  const char* name;
+  const ParameterEntry* table;
+  size_t tableSize;
+  const uint8_t* parameters;
+};
+
+struct CheckResult {
+  uint64_t numberOfVectors = 0;
+  uint64_t numberOfKinds[3] = {};
+  uint64_t numberOfIndexed = 0;
+  uint64_t numberOfPoints = 0;
+  uint64_t numberOfIndexedPoints = 0;
+  uint64_t numberOfMismatches = 0;
+  double bisectionNanoseconds = 0;
+  double gridNanoseconds = 0;
+  double bisectionSweepNanoseconds = 0;
+  double gridSweepNanoseconds = 0;
+};
+
+// bisection of the generated kernels as reference
+static uint32_T findIndexReference(real_T u, const real_T bp[], uint32_T maxIndex) {
+  uint32_T bpIdx = maxIndex >> 1U;
+  uint32_T iLeft = 0U;
+  uint32_T iRght = maxIndex;
+  while (iRght - iLeft > 1U) {
+    if (u < bp[bpIdx]) {
+      iRght = bpIdx;
+    } else {
+      iLeft = bpIdx;
+    }
+    bpIdx = (iRght + iLeft) >> 1U;
+  }
+  return iLeft;
+}
+
+// finds the bracket of every point and returns the duration in nanoseconds
+template <typename FindIndex>
+static double findIndices(const vector<real_T>& points, vector<uint32_T>& indices, FindIndex findIndex) {
+  auto start = chrono::steady_clock::now();
+  for (size_t j = 0; j < points.size(); j++) {
+    indices[j] = findIndex(points[j]);
+  }
+  return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+}
+
+static bool isBreakpointVector(const ParameterEntry& entry) {
+  return entry.count >= 2 && (strstr(entry.name, "_bp0") != nullptr || strstr(entry.name, "BreakpointsForDimension") != nullptr);
+}
+
+// interior points: every breakpoint, its neighbouring doubles, the midpoints and random points
+static void getTestPoints(const real_T bp[],
+                          uint32_T maxIndex,
+                          uint32_t numberOfRandomPoints,
+                          mt19937_64& generator,
+                          vector<real_T>& points) {
+  points.clear();
+  for (uint32_T i = 0; i <= maxIndex; i++) {
+    points.push_back(bp[i]);
+    points.push_back(nextafter(bp[i], -INFINITY));
+    points.push_back(nextafter(bp[i], INFINITY));
+    if (i < maxIndex) {
+      points.push_back(0.5 * (bp[i] + bp[i + 1U]));
+    }
+  }
+  uniform_real_distribution<double> distribution(bp[0U], bp[maxIndex]);
+  for (uint32_t i = 0; i < numberOfRandomPoints; i++) {
+    points.push_back(distribution(generator));
+  }
+  points.erase(remove_if(points.begin(), points.end(), [&](real_T u) { return !(u > bp[0U] && u < bp[maxIndex]); }), points.end());
+}
+
+static void checkModel(const ModelParameters& model, uint32_t numberOfRandomPoints, bool printDump, CheckResult& result) {
+  mt19937_64 generator(0);
+  vector<real_T> points;
+  vector<uint32_T> referenceIndices;
+  vector<uint32_T> gridIndices;
+
+  for (size_t i = 0; i < model.tableSize; i++) {
+    const ParameterEntry& entry = model.table[i];
+    if (!isBreakpointVector(entry)) {
+      continue;
+    }
+
+    const real_T* bp = reinterpret_cast<const real_T*>(model.parameters + entry.offset);
+    const uint32_T maxIndex = static_cast<uint32_T>(entry.count - 1);
+    BreakpointGrid grid;
+    grid.initialize(bp, maxIndex);
+
+    result.numberOfVectors++;
+    result.numberOfKinds[grid.getKind()]++;
+    result.numberOfIndexed += grid.isIndexed();
+    if (printDump) {
+      cout << left << setw(14) << model.name << setw(48) << entry.name << right << setw(4) << entry.count << "  " << left
+           << setw(18) << BreakpointGrid::getKindName(grid.getKind()) << right << setw(4) << grid.getNumberOfSegments();
+      cout << fixed << setprecision(3) << setw(8) << grid.getMaximumDeviation() << setw(8) << (grid.isIndexed() ? "yes" : "no")
+           << endl;
+    }
+
+    // compare the bracket of every test point
+    getTestPoints(bp, maxIndex, numberOfRandomPoints, generator, points);
+    referenceIndices.resize(points.size());
+    gridIndices.resize(points.size());
+
+    // timing of the indexed vectors (the others run the same bisection) in random order and as slow sweep
+    double bisectionNanoseconds = findIndices(points, referenceIndices, [&](real_T u) { return findIndexReference(u, bp, maxIndex); });
+    double gridNanoseconds = findIndices(points, gridIndices, [&](real_T u) { return grid.findIndex(u); });
+    if (grid.isIndexed()) {
+      vector<real_T> sweep(points);
+      vector<uint32_T> sweepIndices(points.size());
+      sort(sweep.begin(), sweep.end());
+      result.bisectionNanoseconds += bisectionNanoseconds;
+      result.gridNanoseconds += gridNanoseconds;
+      result.bisectionSweepNanoseconds += findIndices(sweep, sweepIndices, [&](real_T u) { return findIndexReference(u, bp, maxIndex); });
+      result.gridSweepNanoseconds += findIndices(sweep, sweepIndices, [&](real_T u) { return grid.findIndex(u); });
+      result.numberOfIndexedPoints += points.size();
+    }
+
+    for (size_t j = 0; j < points.size(); j++) {
+      if (referenceIndices[j] != gridIndices[j]) {
+        if (result.numberOfMismatches < 10) {
+          cout << "Mismatch in " << model.name << "." << entry.name << " at " << setprecision(17) << points[j] << ": ";
+          cout << referenceIndices[j] << " != " << gridIndices[j] << endl;
+        }
+        result.numberOfMismatches++;
+      }
+    }
+    result.numberOfPoints += points.size();
+  }
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  uint32_t numberOfRandomPoints = 100000;
+  bool printDump = false;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Classifies the breakpoint vectors of the models and checks the grid brackets against bisection");
+  args.addArgument({"-d", "--dump"}, &printDump, "Print the classification of every breakpoint vector");
+  args.addArgument({"-p", "--points"}, &numberOfRandomPoints, "Number of random test points per breakpoint vector");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // default parameters of the models
+  auto flyByWire = make_unique<FlyByWireModelClass>();
+  auto autothrust = make_unique<AutothrustModelClass>();
+  auto thrustLimits = make_unique<ThrustLimitsModelClass>();
+  const ModelParameters models[] = {
+      {"FlyByWire", FlyByWireParameterTable, FlyByWireParameterTableSize,
+       reinterpret_cast<const uint8_t*>(&flyByWire->getParameters())},
+      {"Autothrust", AutothrustParameterTable, AutothrustParameterTableSize,
+       reinterpret_cast<const uint8_t*>(&autothrust->getParameters())},
+      {"ThrustLimits", ThrustLimitsParameterTable, ThrustLimitsParameterTableSize,
+       reinterpret_cast<const uint8_t*>(&thrustLimits->getParameters())},
+  };
+
+  if (printDump) {
+    cout << left << setw(14) << "model" << setw(48) << "breakpoints" << right << setw(4) << "n" << "  " << left << setw(18)
+         << "kind" << right << setw(4) << "seg" << setw(8) << "dev" << setw(8) << "indexed" << endl;
+  }
+
+  CheckResult result;
+  for (const auto& model : models) {
+    checkModel(model, numberOfRandomPoints, printDump, result);
+  }
+
+  // print result
+  cout << "Breakpoint vectors      : " << result.numberOfVectors << endl;
+  cout << "Uniform                 : " << result.numberOfKinds[BreakpointGrid::UNIFORM] << endl;
+  cout << "Piecewise uniform       : " << result.numberOfKinds[BreakpointGrid::PIECEWISE_UNIFORM] << endl;
+  cout << "Arbitrary               : " << result.numberOfKinds[BreakpointGrid::ARBITRARY] << endl;
+  cout << "Indexed                 : " << result.numberOfIndexed << endl;
+  cout << "Test points             : " << result.numberOfPoints << endl;
+  cout << fixed << setprecision(2);
+  const double numberOfIndexedPoints = static_cast<double>(max<uint64_t>(1, result.numberOfIndexedPoints));
+  cout << "Bisection [ns/point]    : " << result.bisectionNanoseconds / numberOfIndexedPoints << " (random), ";
+  cout << result.bisectionSweepNanoseconds / numberOfIndexedPoints << " (sweep)" << endl;
+  cout << "Grid [ns/point]         : " << result.gridNanoseconds / numberOfIndexedPoints << " (random), ";
+  cout << result.gridSweepNanoseconds / numberOfIndexedPoints << " (sweep)" << endl;
+  cout << "Mismatches              : " << result.numberOfMismatches << endl;
+
+  return result.numberOfMismatches == 0 ? 0 : 1;
+}
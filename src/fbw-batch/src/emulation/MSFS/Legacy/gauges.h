@@ -0,0 +1,55 @@
+#pragma once
+
+// Host emulation of the subset of the MSFS gauges API used by the fly-by-wire module.
+// It allows to run and benchmark the module code outside of the simulator.
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+typedef int ID;
+typedef unsigned int ID32;
+typedef double FLOAT64;
+typedef int SINT32;
+typedef unsigned int UINT32;
+typedef unsigned int ENUM;
+typedef int BOOL;
+typedef void* PVOID;
+typedef const char* PCSTRINGZ;
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+#define KEY_AILERON_LEFT 65600
+#define KEY_AILERON_RIGHT 65601
+
+typedef void (*GAUGE_KEY_EVENT_HANDLER)(ID32 event, UINT32 evdata, PVOID userdata);
+
+ID register_named_variable(PCSTRINGZ name);
+FLOAT64 get_named_variable_value(ID id);
+void set_named_variable_value(ID id, FLOAT64 value);
+void unregister_all_named_vars();
+
+BOOL execute_calculator_code(PCSTRINGZ code, FLOAT64* fvalue, SINT32* ivalue, PCSTRINGZ* svalue);
+
+void register_key_event_handler(GAUGE_KEY_EVENT_HANDLER handler, PVOID userdata);
+void unregister_key_event_handler(GAUGE_KEY_EVENT_HANDLER handler, PVOID userdata);
+
+// the module relies on min and max for mixed argument types like the simulator headers provide them
+template <class A, class B, class = typename std::enable_if<!std::is_same<A, B>::value>::type>
+inline typename std::common_type<A, B>::type max(A a, B b) {
+  return a > b ? a : b;
+}
+
+template <class A, class B, class = typename std::enable_if<!std::is_same<A, B>::value>::type>
+inline typename std::common_type<A, B>::type min(A a, B b) {
+  return a < b ? a : b;
+}
@@ -0,0 +1,324 @@
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CommandLine.hpp"
+#include "DiscreteFilters.h"
+
+// the filter functions of the generated models are private static members
+#define private public
+#include "AutopilotLaws.h"
+#include "AutopilotStateMachine.h"
+#include "Autothrust.h"
+#include "FlyByWire.h"
+#include "ThrustLimits.h"
+#undef private
+
+using namespace std;
+
+static constexpr size_t NUMBER_OF_FILTERS = 16;
+
+struct CheckResult {
+  uint64_t numberOfUpdates = 0;
+  uint64_t numberOfMismatches = 0;
+};
+
+// random input walk with jumps, random coefficients and time steps per update
+struct FilterInputs {
+  vector<double> U;
+  vector<double> dt;
+  double C[NUMBER_OF_FILTERS][6] = {};
+};
+
+static FilterInputs generateInputs(mt19937_64& generator, uint32_t numberOfSteps) {
+  uniform_real_distribution<double> unit(0.0, 1.0);
+  normal_distribution<double> noise(0.0, 1.0);
+  FilterInputs inputs;
+  inputs.U.resize(numberOfSteps * NUMBER_OF_FILTERS);
+  inputs.dt.resize(numberOfSteps);
+  for (size_t i = 0; i < NUMBER_OF_FILTERS; i++) {
+    for (auto& C : inputs.C[i]) {
+      C = 0.1 + 20.0 * unit(generator);
+    }
+    // signs of the rate limits are ignored by the rate limiters
+    inputs.C[i][1] *= unit(generator) < 0.5 ? -1.0 : 1.0;
+  }
+  vector<double> U(NUMBER_OF_FILTERS, 0.0);
+  for (uint32_t step = 0; step < numberOfSteps; step++) {
+    inputs.dt[step] = unit(generator) < 0.05 ? 0.2 * unit(generator) : 1.0 / 30.0;
+    for (size_t i = 0; i < NUMBER_OF_FILTERS; i++) {
+      U[i] = unit(generator) < 0.01 ? 100.0 * noise(generator) : U[i] + noise(generator);
+      inputs.U[step * NUMBER_OF_FILTERS + i] = U[i];
+    }
+  }
+  return inputs;
+}
+
+static void compare(const char* name, uint32_t step, size_t i, double expected, double actual, CheckResult& result) {
+  if (memcmp(&expected, &actual, sizeof(double)) != 0) {
+    if (result.numberOfMismatches < 10) {
+      cout << "Mismatch in " << name << " at step " << step << " filter " << i << ": " << setprecision(17) << expected << " != "
+           << actual << endl;
+    }
+    result.numberOfMismatches++;
+  }
+  result.numberOfUpdates++;
+}
+
+// runs the generated filter, the scalar library filter and the bank on the same inputs
+template <typename GeneratedState, typename LibraryState, typename Bank, typename Generated, typename Library, typename Setup>
+static void checkFilter(const char* name,
+                        const FilterInputs& inputs,
+                        Generated generated,
+                        Library library,
+                        Setup setup,
+                        CheckResult& result) {
+  GeneratedState generatedState[NUMBER_OF_FILTERS] = {};
+  LibraryState libraryState[NUMBER_OF_FILTERS] = {};
+  Bank bank;
+  for (size_t i = 0; i < NUMBER_OF_FILTERS; i++) {
+    setup(bank, i, inputs.C[i]);
+  }
+
+  const uint32_t numberOfSteps = static_cast<uint32_t>(inputs.dt.size());
+  double bankOutput[NUMBER_OF_FILTERS];
+  for (uint32_t step = 0; step < numberOfSteps; step++) {
+    const double* U = &inputs.U[step * NUMBER_OF_FILTERS];
+    const double dt = inputs.dt[step];
+    bank.step(U, dt, bankOutput);
+    for (size_t i = 0; i < NUMBER_OF_FILTERS; i++) {
+      double expected;
+      generated(U[i], inputs.C[i], dt, &expected, &generatedState[i]);
+      compare(name, step, i, expected, library(U[i], inputs.C[i], dt, libraryState[i]), result);
+      compare(name, step, i, expected, bankOutput[i], result);
+    }
+  }
+}
+
+static void checkFilters(const FilterInputs& inputs, CheckResult& result) {
+  auto setupLag = [](auto& bank, size_t i, const double* C) { bank.C1[i] = C[0]; };
+  auto setupLeadLag = [](auto& bank, size_t i, const double* C) {
+    bank.C1[i] = C[0];
+    bank.C2[i] = C[2];
+    bank.C3[i] = C[3];
+    bank.C4[i] = C[4];
+  };
+  auto setupRateLimiter = [](auto& bank, size_t i, const double* C) {
+    bank.up[i] = C[1];
+    bank.lo[i] = C[2];
+    bank.init[i] = C[3];
+  };
+  auto setupRateLimiterWithThreshold = [](auto& bank, size_t i, const double* C) {
+    bank.up[i] = C[1];
+    bank.lo[i] = C[2];
+    bank.init[i] = C[3];
+    bank.threshold[i] = C[4];
+  };
+  auto lag = [](double U, const double* C, double dt, FilterState& state) {
+    return DiscreteFilters::lagFilter(U, C[0], dt, state);
+  };
+  auto washout = [](double U, const double* C, double dt, FilterState& state) {
+    return DiscreteFilters::washoutFilter(U, C[0], dt, state);
+  };
+  auto leadLag = [](double U, const double* C, double dt, FilterState& state) {
+    return DiscreteFilters::leadLagFilter(U, C[0], C[2], C[3], C[4], dt, state);
+  };
+  auto rateLimiter = [](double U, const double* C, double dt, RateLimiterState& state) {
+    return DiscreteFilters::rateLimiter(U, C[1], C[2], dt, C[3], state);
+  };
+  auto rateLimiterWithThreshold = [](double U, const double* C, double dt, RateLimiterState& state) {
+    return DiscreteFilters::rateLimiterWithThreshold(U, C[1], C[2], dt, C[3], C[4], state);
+  };
+
+  // lag filters
+  checkFilter<FlyByWireModelClass::rtDW_LagFilter_FlyByWire_T, FilterState, LagFilterBank<NUMBER_OF_FILTERS>>(
+      "FlyByWire_LagFilter", inputs,
+      [](double U, const double* C, double dt, double* Y, FlyByWireModelClass::rtDW_LagFilter_FlyByWire_T* state) {
+        FlyByWireModelClass::FlyByWire_LagFilter(U, C[0], dt, Y, state);
+      },
+      lag, setupLag, result);
+  checkFilter<AutopilotLawsModelClass::rtDW_LagFilter_AutopilotLaws_T, FilterState, LagFilterBank<NUMBER_OF_FILTERS>>(
+      "AutopilotLaws_LagFilter", inputs,
+      [](double U, const double* C, double dt, double* Y, AutopilotLawsModelClass::rtDW_LagFilter_AutopilotLaws_T* state) {
+        AutopilotLawsModelClass::AutopilotLaws_LagFilter(U, C[0], dt, Y, state);
+      },
+      lag, setupLag, result);
+  checkFilter<AutopilotStateMachineModelClass::rtDW_LagFilter_AutopilotStateMachine_T, FilterState,
+              LagFilterBank<NUMBER_OF_FILTERS>>(
+      "AutopilotStateMachine_LagFilter", inputs,
+      [](double U, const double* C, double dt, double* Y, AutopilotStateMachineModelClass::rtDW_LagFilter_AutopilotStateMachine_T* state) {
+        AutopilotStateMachineModelClass::AutopilotStateMachine_LagFilter(U, C[0], dt, Y, state);
+      },
+      lag, setupLag, result);
+  checkFilter<AutothrustModelClass::rtDW_LagFilter_Autothrust_T, FilterState, LagFilterBank<NUMBER_OF_FILTERS>>(
+      "Autothrust_LagFilter", inputs,
+      [](double U, const double* C, double dt, double* Y, AutothrustModelClass::rtDW_LagFilter_Autothrust_T* state) {
+        AutothrustModelClass::Autothrust_LagFilter(U, C[0], dt, Y, state);
+      },
+      lag, setupLag, result);
+
+  // washout filters
+  checkFilter<FlyByWireModelClass::rtDW_WashoutFilter_FlyByWire_T, FilterState, WashoutFilterBank<NUMBER_OF_FILTERS>>(
+      "FlyByWire_WashoutFilter", inputs,
+      [](double U, const double* C, double dt, double* Y, FlyByWireModelClass::rtDW_WashoutFilter_FlyByWire_T* state) {
+        FlyByWireModelClass::FlyByWire_WashoutFilter(U, C[0], dt, Y, state);
+      },
+      washout, setupLag, result);
+  checkFilter<AutopilotLawsModelClass::rtDW_WashoutFilter_AutopilotLaws_T, FilterState, WashoutFilterBank<NUMBER_OF_FILTERS>>(
+      "AutopilotLaws_WashoutFilter", inputs,
+      [](double U, const double* C, double dt, double* Y, AutopilotLawsModelClass::rtDW_WashoutFilter_AutopilotLaws_T* state) {
+        AutopilotLawsModelClass::AutopilotLaws_WashoutFilter(U, C[0], dt, Y, state);
+      },
+      washout, setupLag, result);
+  checkFilter<AutopilotStateMachineModelClass::rtDW_WashoutFilter_AutopilotStateMachine_T, FilterState,
+              WashoutFilterBank<NUMBER_OF_FILTERS>>(
+      "AutopilotStateMachine_WashoutFilter", inputs,
+      [](double U, const double* C, double dt, double* Y,
+         AutopilotStateMachineModelClass::rtDW_WashoutFilter_AutopilotStateMachine_T* state) {
+        AutopilotStateMachineModelClass::AutopilotStateMachine_WashoutFilter(U, C[0], dt, Y, state);
+      },
+      washout, setupLag, result);
+  checkFilter<AutothrustModelClass::rtDW_WashoutFilter_Autothrust_T, FilterState, WashoutFilterBank<NUMBER_OF_FILTERS>>(
+      "Autothrust_WashoutFilter", inputs,
+      [](double U, const double* C, double dt, double* Y, AutothrustModelClass::rtDW_WashoutFilter_Autothrust_T* state) {
+        AutothrustModelClass::Autothrust_WashoutFilter(U, C[0], dt, Y, state);
+      },
+      washout, setupLag, result);
+
+  // lead-lag filters
+  checkFilter<AutopilotLawsModelClass::rtDW_LeadLagFilter_AutopilotLaws_T, FilterState, LeadLagFilterBank<NUMBER_OF_FILTERS>>(
+      "AutopilotLaws_LeadLagFilter", inputs,
+      [](double U, const double* C, double dt, double* Y, AutopilotLawsModelClass::rtDW_LeadLagFilter_AutopilotLaws_T* state) {
+        AutopilotLawsModelClass::AutopilotLaws_LeadLagFilter(U, C[0], C[2], C[3], C[4], dt, Y, state);
+      },
+      leadLag, setupLeadLag, result);
+  checkFilter<AutothrustModelClass::rtDW_LeadLagFilter_Autothrust_T, FilterState, LeadLagFilterBank<NUMBER_OF_FILTERS>>(
+      "Autothrust_LeadLagFilter", inputs,
+      [](double U, const double* C, double dt, double* Y, AutothrustModelClass::rtDW_LeadLagFilter_Autothrust_T* state) {
+        AutothrustModelClass::Autothrust_LeadLagFilter(U, C[0], C[2], C[3], C[4], dt, Y, state);
+      },
+      leadLag, setupLeadLag, result);
+
+  // rate limiters
+  checkFilter<FlyByWireModelClass::rtDW_RateLimiter_FlyByWire_T, RateLimiterState, RateLimiterBank<NUMBER_OF_FILTERS>>(
+      "FlyByWire_RateLimiter", inputs,
+      [](double U, const double* C, double dt, double* Y, FlyByWireModelClass::rtDW_RateLimiter_FlyByWire_T* state) {
+        FlyByWireModelClass::FlyByWire_RateLimiter(U, C[1], C[2], dt, C[3], Y, state);
+      },
+      rateLimiter, setupRateLimiter, result);
+  checkFilter<AutopilotLawsModelClass::rtDW_RateLimiter_AutopilotLaws_T, RateLimiterState, RateLimiterBank<NUMBER_OF_FILTERS>>(
+      "AutopilotLaws_RateLimiter", inputs,
+      [](double U, const double* C, double dt, double* Y, AutopilotLawsModelClass::rtDW_RateLimiter_AutopilotLaws_T* state) {
+        AutopilotLawsModelClass::AutopilotLaws_RateLimiter(U, C[1], C[2], dt, C[3], Y, state);
+      },
+      rateLimiter, setupRateLimiter, result);
+  checkFilter<ThrustLimitsModelClass::rtDW_RateLimiterwithThreshold_ThrustLimits_T, RateLimiterState,
+              RateLimiterBank<NUMBER_OF_FILTERS>>(
+      "ThrustLimits_RateLimiterwithThreshold", inputs,
+      [](double U, const double* C, double dt, double* Y, ThrustLimitsModelClass::rtDW_RateLimiterwithThreshold_ThrustLimits_T* state) {
+        ThrustLimitsModelClass::ThrustLimits_RateLimiterwithThreshold(U, C[1], C[2], dt, C[3], C[4], Y, state);
+      },
+      rateLimiterWithThreshold, setupRateLimiterWithThreshold, result);
+}
+
+// duration per filter update in nanoseconds of the scalar lead-lag filters and of the bank
+static void runBenchmark(const FilterInputs& inputs, uint32_t numberOfIterations, double& scalarNanoseconds, double& bankNanoseconds) {
+  const uint32_t numberOfSteps = static_cast<uint32_t>(inputs.dt.size());
+  double sum = 0;
+  double output[NUMBER_OF_FILTERS];
+
+  auto start = chrono::steady_clock::now();
+  for (uint32_t iteration = 0; iteration < numberOfIterations; iteration++) {
+    FilterState state[NUMBER_OF_FILTERS] = {};
+    for (uint32_t step = 0; step < numberOfSteps; step++) {
+      const double* U = &inputs.U[step * NUMBER_OF_FILTERS];
+      for (size_t i = 0; i < NUMBER_OF_FILTERS; i++) {
+        const double* C = inputs.C[i];
+        output[i] = DiscreteFilters::leadLagFilter(U[i], C[0], C[2], C[3], C[4], inputs.dt[step], state[i]);
+      }
+      sum += output[step % NUMBER_OF_FILTERS];
+    }
+  }
+  auto middle = chrono::steady_clock::now();
+  for (uint32_t iteration = 0; iteration < numberOfIterations; iteration++) {
+    LeadLagFilterBank<NUMBER_OF_FILTERS> bank;
+    for (size_t i = 0; i < NUMBER_OF_FILTERS; i++) {
+      bank.C1[i] = inputs.C[i][0];
+      bank.C2[i] = inputs.C[i][2];
+      bank.C3[i] = inputs.C[i][3];
+      bank.C4[i] = inputs.C[i][4];
+    }
+    for (uint32_t step = 0; step < numberOfSteps; step++) {
+      bank.step(&inputs.U[step * NUMBER_OF_FILTERS], inputs.dt[step], output);
+      sum += output[step % NUMBER_OF_FILTERS];
+    }
+  }
+  auto end = chrono::steady_clock::now();
+
+  const double numberOfUpdates = static_cast<double>(numberOfIterations) * numberOfSteps * NUMBER_OF_FILTERS;
+  scalarNanoseconds = chrono::duration<double, nano>(middle - start).count() / numberOfUpdates;
+  bankNanoseconds = chrono::duration<double, nano>(end - middle).count() / numberOfUpdates;
+  if (sum == 0.0) {
+    cout << "Checksum                : " << sum << endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  uint32_t seed = 0;
+  uint32_t numberOfSteps = 20000;
+  uint32_t numberOfIterations = 20;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Checks the filter library against the filters of the generated models and benchmarks the filter banks");
+  args.addArgument({"-s", "--seed"}, &seed, "Seed of the random inputs");
+  args.addArgument({"-n", "--steps"}, &numberOfSteps, "Number of steps per filter");
+  args.addArgument({"-t", "--iterations"}, &numberOfIterations, "Number of benchmark iterations");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (numberOfSteps == 0 || numberOfIterations == 0) {
+    cout << "Invalid parameters!" << endl;
+    return 1;
+  }
+
+  mt19937_64 generator(seed);
+  const FilterInputs inputs = generateInputs(generator, numberOfSteps);
+
+  CheckResult result;
+  checkFilters(inputs, result);
+
+  double scalarNanoseconds = 0;
+  double bankNanoseconds = 0;
+  runBenchmark(inputs, numberOfIterations, scalarNanoseconds, bankNanoseconds);
+
+  // print result
+  cout << "Compared updates        : " << result.numberOfUpdates << endl;
+  cout << fixed << setprecision(2);
+  cout << "Lead-lag scalar [ns]    : " << scalarNanoseconds << endl;
+  cout << "Lead-lag bank [ns]      : " << bankNanoseconds << endl;
+  cout << "Mismatches              : " << result.numberOfMismatches << endl;
+
+  return result.numberOfMismatches == 0 ? 0 : 1;
+}
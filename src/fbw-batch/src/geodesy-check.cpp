@@ -0,0 +1,311 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AutopilotLaws.h"
+#include "CommandLine.hpp"
+#include "GeodesyKernel.h"
+
+using namespace std;
+
+struct Geometry {
+  double lat1;
+  double lon1;
+  double lat2;
+  double lon2;
+  double height;
+};
+
+struct CheckResult {
+  uint64_t numberOfGeometries = 0;
+  uint64_t numberOfMismatches = 0;
+  double maximumDistanceError = 0;
+  double maximumBearingError = 0;
+  double maximumElevationError = 0;
+};
+
+struct BenchmarkResult {
+  double referenceKernelNanoseconds = 0;
+  double exactKernelNanoseconds = 0;
+  double approximateKernelNanoseconds = 0;
+  double checksum = 0;
+  double exactNanoseconds = 0;
+  double approximateNanoseconds = 0;
+  double maximumLocErrorDifference = 0;
+  double maximumGsErrorDifference = 0;
+  uint64_t numberOfValidityMismatches = 0;
+};
+
+// same formulas as the generated AutopilotLaws step
+static double referenceDistance(const Geometry& g) {
+  double a = std::sin((g.lat2 - g.lat1) * 0.017453292519943295 / 2.0);
+  double distance_m = std::sin((g.lon2 - g.lon1) * 0.017453292519943295 / 2.0);
+  a = std::cos(0.017453292519943295 * g.lat1) * std::cos(0.017453292519943295 * g.lat2) * distance_m * distance_m + a * a;
+  return std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
+}
+
+static double referenceBearing(const Geometry& g) {
+  double rtb_error_d = 0.017453292519943295 * g.lat1;
+  double Phi2 = 0.017453292519943295 * g.lat2;
+  double R = std::cos(Phi2);
+  double L = 0.017453292519943295 * g.lon2 - 0.017453292519943295 * g.lon1;
+  double rtb_Sum_if = std::cos(rtb_error_d);
+  rtb_error_d = std::sin(rtb_error_d);
+  return std::atan2(std::sin(L) * R, rtb_Sum_if * std::sin(Phi2) - rtb_error_d * R * std::cos(L)) * 57.295779513082323;
+}
+
+static double referenceElevation(double height, double distance) {
+  return std::asin(height / distance) * 57.295779513082323;
+}
+
+static bool isSame(double a, double b) {
+  return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+static double angleDifference(double a, double b) {
+  double difference = std::fmod(std::abs(a - b), 360.0);
+  return min(difference, 360.0 - difference);
+}
+
+// stations anywhere, aircraft mostly within 60 nm of the station, some far away and across the antimeridian
+static vector<Geometry> generateGeometries(uint32_t numberOfGeometries, mt19937_64& generator) {
+  uniform_real_distribution<double> unit(0.0, 1.0);
+  vector<Geometry> geometries(numberOfGeometries);
+  for (auto& g : geometries) {
+    g.lat2 = 160.0 * unit(generator) - 80.0;
+    g.lon2 = 360.0 * unit(generator) - 180.0;
+    double range = unit(generator) < 0.9 ? 1.0 : 40.0;
+    g.lat1 = max(-89.0, min(89.0, g.lat2 + range * (2.0 * unit(generator) - 1.0)));
+    g.lon1 = g.lon2 + range * (2.0 * unit(generator) - 1.0);
+    if (g.lon1 > 180.0) {
+      g.lon1 -= 360.0;
+    } else if (g.lon1 < -180.0) {
+      g.lon1 += 360.0;
+    }
+    g.height = 10000.0 * unit(generator) - 500.0;
+  }
+  return geometries;
+}
+
+static void checkKernel(const vector<Geometry>& geometries, CheckResult& result) {
+  GeodesyKernel exact;
+  GeodesyKernel approximate;
+  approximate.setApproximation(true);
+
+  // the station point is kept like in the model, it is only computed again when the station changes
+  GeodesyPoint aircraft;
+  GeodesyPoint station;
+  for (const auto& g : geometries) {
+    GeodesyKernel::update(g.lat1, g.lon1, aircraft);
+    GeodesyKernel::update(g.lat2, g.lon2, station);
+
+    double distance = referenceDistance(g);
+    double bearing = referenceBearing(g);
+    double slantDistance = std::sqrt(distance * distance + g.height * g.height);
+    double elevation = referenceElevation(g.height, slantDistance);
+
+    if (!isSame(distance, exact.distance(aircraft, station)) || !isSame(bearing, exact.bearing(aircraft, station)) ||
+        !isSame(elevation, exact.elevation(g.height, slantDistance))) {
+      if (result.numberOfMismatches < 10) {
+        cout << "Mismatch at " << setprecision(17) << g.lat1 << " " << g.lon1 << " -> " << g.lat2 << " " << g.lon2 << endl;
+      }
+      result.numberOfMismatches++;
+    }
+
+    result.maximumDistanceError = max(result.maximumDistanceError, std::abs(distance - approximate.distance(aircraft, station)));
+    result.maximumBearingError = max(result.maximumBearingError, angleDifference(bearing, approximate.bearing(aircraft, station)));
+    result.maximumElevationError =
+        max(result.maximumElevationError, std::abs(elevation - approximate.elevation(g.height, slantDistance)));
+    result.numberOfGeometries++;
+  }
+}
+
+// distance, bearing and elevation of a station that stays tuned for a while, like in the model
+template <typename Function>
+static double benchmarkGeometries(const vector<Geometry>& geometries, Function function, double& checksum) {
+  auto start = chrono::steady_clock::now();
+  for (size_t i = 0; i < geometries.size(); i++) {
+    Geometry g = geometries[i];
+    g.lat2 = geometries[i - i % 1000].lat2;
+    g.lon2 = geometries[i - i % 1000].lon2;
+    checksum += function(g);
+  }
+  return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+}
+
+static void benchmarkKernel(const vector<Geometry>& geometries, BenchmarkResult& result) {
+  result.referenceKernelNanoseconds += benchmarkGeometries(
+      geometries,
+      [](const Geometry& g) {
+        double distance = referenceDistance(g);
+        double slantDistance = std::sqrt(distance * distance + g.height * g.height);
+        return slantDistance + referenceBearing(g) + referenceElevation(g.height, slantDistance);
+      },
+      result.checksum);
+
+  for (bool isApproximation : {false, true}) {
+    GeodesyKernel kernel;
+    kernel.setApproximation(isApproximation);
+    GeodesyPoint aircraft;
+    GeodesyPoint station;
+    double nanoseconds = benchmarkGeometries(
+        geometries,
+        [&](const Geometry& g) {
+          GeodesyKernel::update(g.lat1, g.lon1, aircraft);
+          GeodesyKernel::update(g.lat2, g.lon2, station);
+          double distance = kernel.distance(aircraft, station);
+          double slantDistance = std::sqrt(distance * distance + g.height * g.height);
+          return slantDistance + kernel.bearing(aircraft, station) + kernel.elevation(g.height, slantDistance);
+        },
+        result.checksum);
+    (isApproximation ? result.approximateKernelNanoseconds : result.exactKernelNanoseconds) += nanoseconds;
+  }
+}
+
+// approach from 30 nm towards the localizer, the stations are lost and received again on the way
+static vector<AutopilotLawsModelClass::ExternalInputs_AutopilotLaws_T> generateApproach(uint32_t numberOfSteps,
+                                                                                       mt19937_64& generator) {
+  uniform_real_distribution<double> unit(0.0, 1.0);
+  vector<AutopilotLawsModelClass::ExternalInputs_AutopilotLaws_T> inputs(numberOfSteps);
+  AutopilotLawsModelClass::ExternalInputs_AutopilotLaws_T input = {};
+  input.in.data.aircraft_position = {47.0, 8.5, 3000.0};
+  input.in.data.nav_loc_position = {47.5, 8.55, 400.0};
+  input.in.data.nav_gs_position = {47.49, 8.55, 400.0};
+  input.in.data.nav_loc_deg = 3.0;
+  input.in.data.nav_gs_deg = 3.0;
+  input.in.data.nav_loc_magvar_deg = 2.0;
+  input.in.data.V_ias_kn = 140.0;
+  input.in.data.V_tas_kn = 145.0;
+  input.in.data.V_gnd_kn = 145.0;
+  input.in.data.Theta_deg = 2.0;
+  input.in.data.bz_m_s2 = -9.81;
+  bool isStationReceived = true;
+  for (auto& frame : inputs) {
+    input.in.time.dt = 1.0 / 30.0;
+    input.in.time.simulation_time += input.in.time.dt;
+    input.in.data.aircraft_position.lat += 1e-5;
+    input.in.data.aircraft_position.lon += 1e-6 * (unit(generator) - 0.5);
+    input.in.data.aircraft_position.alt = max(400.0, input.in.data.aircraft_position.alt - 0.5);
+    input.in.data.H_ft = input.in.data.aircraft_position.alt;
+    input.in.data.H_ind_ft = input.in.data.aircraft_position.alt;
+    input.in.data.H_radio_ft = input.in.data.aircraft_position.alt - 400.0;
+    input.in.data.Phi_deg = 2.0 * (unit(generator) - 0.5);
+    if (unit(generator) < 0.001) {
+      isStationReceived = !isStationReceived;
+    }
+    input.in.data.nav_valid = isStationReceived;
+    input.in.data.nav_loc_valid = isStationReceived;
+    input.in.data.nav_gs_valid = isStationReceived;
+    input.in.data.nav_dme_valid = 0.0;
+    frame = input;
+  }
+  return inputs;
+}
+
+// steps the model over all inputs and returns the duration in nanoseconds
+static double runModel(AutopilotLawsModelClass& model,
+                       const vector<AutopilotLawsModelClass::ExternalInputs_AutopilotLaws_T>& inputs,
+                       vector<AutopilotLawsModelClass::ExternalOutputs_AutopilotLaws_T>& outputs) {
+  model.initialize();
+  auto start = chrono::steady_clock::now();
+  for (size_t i = 0; i < inputs.size(); i++) {
+    model.setExternalInputs(&inputs[i]);
+    model.step();
+    outputs[i] = model.getExternalOutputs();
+  }
+  return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+}
+
+static void benchmarkStep(const vector<AutopilotLawsModelClass::ExternalInputs_AutopilotLaws_T>& inputs,
+                          BenchmarkResult& result) {
+  auto exact = make_unique<AutopilotLawsModelClass>();
+  auto approximate = make_unique<AutopilotLawsModelClass>();
+  approximate->setGeodesyApproximation(true);
+
+  vector<AutopilotLawsModelClass::ExternalOutputs_AutopilotLaws_T> exactOutputs(inputs.size());
+  vector<AutopilotLawsModelClass::ExternalOutputs_AutopilotLaws_T> approximateOutputs(inputs.size());
+  result.exactNanoseconds += runModel(*exact, inputs, exactOutputs);
+  result.approximateNanoseconds += runModel(*approximate, inputs, approximateOutputs);
+
+  for (size_t i = 0; i < inputs.size(); i++) {
+    const auto& e = exactOutputs[i].out.data;
+    const auto& a = approximateOutputs[i].out.data;
+    if (e.nav_e_loc_valid != a.nav_e_loc_valid || e.nav_e_gs_valid != a.nav_e_gs_valid) {
+      result.numberOfValidityMismatches++;
+    }
+    result.maximumLocErrorDifference =
+        max(result.maximumLocErrorDifference, std::abs(e.nav_e_loc_error_deg - a.nav_e_loc_error_deg));
+    result.maximumGsErrorDifference = max(result.maximumGsErrorDifference, std::abs(e.nav_e_gs_error_deg - a.nav_e_gs_error_deg));
+  }
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  uint32_t numberOfGeometries = 1000000;
+  uint32_t numberOfSteps = 100000;
+  uint32_t seed = 0;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Checks the geodesy kernels against the formulas of the autopilot laws and benchmarks the model step");
+  args.addArgument({"-g", "--geometries"}, &numberOfGeometries, "Number of random aircraft and station positions");
+  args.addArgument({"-t", "--steps"}, &numberOfSteps, "Number of steps of the benchmark approach");
+  args.addArgument({"-s", "--seed"}, &seed, "Seed of the random positions");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  mt19937_64 generator(seed);
+
+  // exact kernels bit by bit and the error of the approximate kernels
+  CheckResult result;
+  vector<Geometry> geometries = generateGeometries(numberOfGeometries, generator);
+  checkKernel(geometries, result);
+
+  // kernels and model step with exact and approximate kernels
+  BenchmarkResult benchmark;
+  benchmarkKernel(geometries, benchmark);
+  double numberOfBenchmarkGeometries = static_cast<double>(max<uint32_t>(1, numberOfGeometries));
+  benchmarkStep(generateApproach(numberOfSteps, generator), benchmark);
+  double numberOfBenchmarkSteps = static_cast<double>(max<uint32_t>(1, numberOfSteps));
+
+  // print result
+  cout << "Geometries                   : " << result.numberOfGeometries << endl;
+  cout << scientific << setprecision(3);
+  cout << "Max distance error [m]       : " << result.maximumDistanceError << endl;
+  cout << "Max bearing error [deg]      : " << result.maximumBearingError << endl;
+  cout << "Max elevation error [deg]    : " << result.maximumElevationError << endl;
+  cout << "Max loc deviation diff [deg] : " << benchmark.maximumLocErrorDifference << endl;
+  cout << "Max gs deviation diff [deg]  : " << benchmark.maximumGsErrorDifference << endl;
+  cout << fixed << setprecision(2);
+  cout << "Validity mismatches          : " << benchmark.numberOfValidityMismatches << endl;
+  cout << "Reference kernel [ns/call]   : " << benchmark.referenceKernelNanoseconds / numberOfBenchmarkGeometries << endl;
+  cout << "Exact kernel [ns/call]       : " << benchmark.exactKernelNanoseconds / numberOfBenchmarkGeometries << endl;
+  cout << "Approximate kernel [ns/call] : " << benchmark.approximateKernelNanoseconds / numberOfBenchmarkGeometries << endl;
+  cout << "Checksum                     : " << benchmark.checksum << endl;
+  cout << "Exact step [ns/step]         : " << benchmark.exactNanoseconds / numberOfBenchmarkSteps << endl;
+  cout << "Approximate step [ns/step]   : " << benchmark.approximateNanoseconds / numberOfBenchmarkSteps << endl;
+  cout << "Mismatches                   : " << result.numberOfMismatches << endl;
+
+  return result.numberOfMismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,290 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CommandLine.hpp"
+#include "InterpolatingLookupTable.h"
+
+using namespace std;
+
+// lookup is constant evaluated for tables known at compile time
+static constexpr double CHECK_X[] = {-20.0, 0.0, 25.0, 35.0, 45.0};
+static constexpr double CHECK_Y[] = {0.0, 25.0, 50.0, 75.0, 100.0};
+static constexpr FixedInterpolatingLookupTable<5> CHECK_TABLE(CHECK_X, CHECK_Y, 0, 100);
+static_assert(CHECK_TABLE.get(-30.0) == 0.0, "clamped below");
+static_assert(CHECK_TABLE.get(10.0) == 35.0, "interpolated");
+static_assert(CHECK_TABLE.get(35.0) == 75.0, "exact at point");
+static_assert(CHECK_TABLE.get(60.0) == 100.0, "clamped above");
+
+// default mapping of a throttle axis with reverse on axis
+static const vector<pair<double, double>> THROTTLE_MAPPING = {
+    {-1.00, -20.0}, {-0.95, -20.0}, {-0.72, -6.0}, {-0.62, -6.0}, {-0.50, 0.0},  {-0.40, 0.0},
+    {-0.03, 25.0},  {+0.07, 25.0},  {+0.42, 35.0}, {+0.52, 35.0}, {+0.95, 45.0}, {+1.00, 45.0},
+};
+static constexpr size_t THROTTLE_MAPPING_SIZE = 12;
+
+struct CheckResult {
+  uint64_t numberOfTables = 0;
+  uint64_t numberOfPoints = 0;
+  uint64_t numberOfFailures = 0;
+};
+
+// previous implementation with linear search as reference
+class LinearLookupTable {
+ public:
+  void initialize(vector<pair<double, double>> mapping, double minimum, double maximum) {
+    mappingTable = std::move(mapping);
+    mappingMinimum = minimum;
+    mappingMaximum = maximum;
+  }
+
+  double get(double value) const {
+    if (mappingTable.empty()) {
+      return 0;
+    }
+    for (size_t i = 0; i < mappingTable.size() - 1; ++i) {
+      if (mappingTable[i].first <= value && mappingTable[i + 1].first >= value) {
+        double diff_x = value - mappingTable[i].first;
+        double diff_n = mappingTable[i + 1].first - mappingTable[i].first;
+        double result = mappingTable[i].first;
+        if (diff_n != 0) {
+          result = mappingTable[i].second + (mappingTable[i + 1].second - mappingTable[i].second) * diff_x / diff_n;
+        }
+        return fmin(fmax(result, mappingMinimum), mappingMaximum);
+      }
+    }
+    return 0;
+  }
+
+ private:
+  vector<pair<double, double>> mappingTable;
+  double mappingMinimum = 0;
+  double mappingMaximum = 0;
+};
+
+static void fail(CheckResult& result, const string& property, double value, double expected, double actual) {
+  if (result.numberOfFailures < 10) {
+    cout << "Failure (" << property << ") at " << setprecision(17) << value << ": expected " << expected << ", got " << actual
+         << endl;
+  }
+  result.numberOfFailures++;
+}
+
+// sorted random table with plateaus and steps (points with equal x)
+static vector<pair<double, double>> generateTable(mt19937_64& generator, size_t numberOfPoints) {
+  uniform_real_distribution<double> unit(0.0, 1.0);
+  vector<pair<double, double>> mapping;
+  double x = -1.0 + unit(generator);
+  double y = 100.0 * unit(generator) - 50.0;
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    mapping.emplace_back(x, y);
+    double kind = unit(generator);
+    x += kind < 0.1 ? 0.0 : 0.5 * unit(generator);
+    y = kind < 0.3 ? y : 100.0 * unit(generator) - 50.0;
+  }
+  return mapping;
+}
+
+static void checkTable(const vector<pair<double, double>>& mapping,
+                       double minimum,
+                       double maximum,
+                       uint32_t numberOfRandomPoints,
+                       mt19937_64& generator,
+                       CheckResult& result) {
+  auto clip = [&](double value) { return fmin(fmax(value, minimum), maximum); };
+
+  InterpolatingLookupTable table;
+  LinearLookupTable reference;
+  table.initialize(mapping, minimum, maximum);
+  reference.initialize(mapping, minimum, maximum);
+
+  // the order of the input does not matter (except for points with equal x)
+  vector<pair<double, double>> descending(mapping);
+  stable_sort(descending.begin(), descending.end(), [](const pair<double, double>& a, const pair<double, double>& b) {
+    return a.first > b.first;
+  });
+  InterpolatingLookupTable descendingTable;
+  descendingTable.initialize(descending, minimum, maximum);
+
+  const double first = mapping.front().first;
+  const double last = mapping.back().first;
+
+  // exact at every point, at a step the value of the right side is taken
+  for (size_t i = 0; i < mapping.size(); i++) {
+    if (i + 1 < mapping.size() && mapping[i + 1].first == mapping[i].first) {
+      continue;
+    }
+    double actual = table.get(mapping[i].first);
+    if (actual != clip(mapping[i].second)) {
+      fail(result, "point", mapping[i].first, clip(mapping[i].second), actual);
+    }
+    result.numberOfPoints++;
+  }
+
+  // clamped outside of the table and for NaN
+  const double outside[] = {first - 1.0, -INFINITY, last + 1.0, INFINITY, NAN};
+  const double outsideExpected[] = {mapping.front().second, mapping.front().second, mapping.back().second,
+                                    mapping.back().second, mapping.front().second};
+  for (size_t i = 0; i < 5; i++) {
+    double actual = table.get(outside[i]);
+    if (actual != clip(outsideExpected[i])) {
+      fail(result, "clamping", outside[i], clip(outsideExpected[i]), actual);
+    }
+    result.numberOfPoints++;
+  }
+
+  // random points within the table
+  uniform_real_distribution<double> distribution(first, last);
+  for (uint32_t i = 0; i < numberOfRandomPoints && last > first; i++) {
+    double value = distribution(generator);
+    double actual = table.get(value);
+    result.numberOfPoints++;
+
+    // segment of the value
+    size_t k = 0;
+    while (k + 2 < mapping.size() && mapping[k + 1].first <= value) {
+      k++;
+    }
+    const double y0 = mapping[k].second;
+    const double y1 = mapping[k + 1].second;
+
+    // within the values of the segment
+    if (actual < clip(fmin(y0, y1)) || actual > clip(fmax(y0, y1))) {
+      fail(result, "bounds", value, clip(y0), actual);
+    }
+
+    // equal to the previous implementation within rounding, it differs only at steps
+    double expected = reference.get(value);
+    if (fabs(actual - expected) > 1e-9 * fmax(1.0, fabs(expected))) {
+      fail(result, "reference", value, expected, actual);
+    }
+
+    if (descendingTable.get(value) != actual) {
+      fail(result, "order", value, actual, descendingTable.get(value));
+    }
+  }
+
+  // compile time variant is bitwise identical
+  if (mapping.size() == THROTTLE_MAPPING_SIZE) {
+    double x[THROTTLE_MAPPING_SIZE] = {};
+    double y[THROTTLE_MAPPING_SIZE] = {};
+    for (size_t i = 0; i < THROTTLE_MAPPING_SIZE; i++) {
+      x[i] = mapping[i].first;
+      y[i] = mapping[i].second;
+    }
+    FixedInterpolatingLookupTable<THROTTLE_MAPPING_SIZE> fixedTable(x, y, minimum, maximum);
+    for (uint32_t i = 0; i < numberOfRandomPoints; i++) {
+      double value = first - 0.1 + (last - first + 0.2) * (i + 0.5) / numberOfRandomPoints;
+      if (fixedTable.get(value) != table.get(value)) {
+        fail(result, "fixed", value, table.get(value), fixedTable.get(value));
+      }
+      result.numberOfPoints++;
+    }
+  }
+
+  result.numberOfTables++;
+}
+
+// duration per lookup in nanoseconds
+template <typename Lookup>
+static double runBenchmark(const vector<double>& values, uint32_t numberOfIterations, double& sum, Lookup lookup) {
+  auto start = chrono::steady_clock::now();
+  for (uint32_t iteration = 0; iteration < numberOfIterations; iteration++) {
+    for (double value : values) {
+      sum += lookup(value);
+    }
+  }
+  auto duration = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+  return duration / (static_cast<double>(numberOfIterations) * values.size());
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  uint32_t numberOfTables = 10000;
+  uint32_t numberOfRandomPoints = 1000;
+  uint32_t numberOfIterations = 100;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Checks properties of the interpolating lookup tables and benchmarks them against a linear search");
+  args.addArgument({"-n", "--tables"}, &numberOfTables, "Number of random tables");
+  args.addArgument({"-p", "--points"}, &numberOfRandomPoints, "Number of random points per table");
+  args.addArgument({"-t", "--iterations"}, &numberOfIterations, "Number of benchmark iterations");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (numberOfIterations == 0 || numberOfRandomPoints == 0) {
+    cout << "Invalid parameters!" << endl;
+    return 1;
+  }
+
+  // properties of the throttle mapping and of random tables
+  CheckResult result;
+  mt19937_64 generator(0);
+  checkTable(THROTTLE_MAPPING, -20.0, 45.0, numberOfRandomPoints, generator, result);
+  for (uint32_t i = 0; i < numberOfTables; i++) {
+    size_t numberOfPoints = 1 + i % 16;
+    checkTable(generateTable(generator, numberOfPoints), -40.0, 40.0, numberOfRandomPoints, generator, result);
+  }
+
+  // uninitialized table
+  if (InterpolatingLookupTable().get(0.5) != 0.0) {
+    fail(result, "uninitialized", 0.5, 0.0, InterpolatingLookupTable().get(0.5));
+  }
+
+  // benchmark with the throttle mapping over the whole axis
+  vector<double> values(1024);
+  uniform_real_distribution<double> axis(-1.0, 1.0);
+  for (auto& value : values) {
+    value = axis(generator);
+  }
+  LinearLookupTable linearTable;
+  InterpolatingLookupTable table;
+  linearTable.initialize(THROTTLE_MAPPING, -20.0, 45.0);
+  table.initialize(THROTTLE_MAPPING, -20.0, 45.0);
+  double x[THROTTLE_MAPPING_SIZE] = {};
+  double y[THROTTLE_MAPPING_SIZE] = {};
+  for (size_t i = 0; i < THROTTLE_MAPPING_SIZE; i++) {
+    x[i] = THROTTLE_MAPPING[i].first;
+    y[i] = THROTTLE_MAPPING[i].second;
+  }
+  FixedInterpolatingLookupTable<THROTTLE_MAPPING_SIZE> fixedTable(x, y, -20.0, 45.0);
+
+  double sum = 0;
+  double linearNanoseconds = runBenchmark(values, numberOfIterations, sum, [&](double v) { return linearTable.get(v); });
+  double tableNanoseconds = runBenchmark(values, numberOfIterations, sum, [&](double v) { return table.get(v); });
+  double fixedNanoseconds = runBenchmark(values, numberOfIterations, sum, [&](double v) { return fixedTable.get(v); });
+
+  // print result
+  cout << "Tables                  : " << result.numberOfTables << endl;
+  cout << "Checked points          : " << result.numberOfPoints << endl;
+  cout << fixed << setprecision(2);
+  cout << "Linear search [ns/call] : " << linearNanoseconds << endl;
+  cout << "Table [ns/call]         : " << tableNanoseconds << endl;
+  cout << "Fixed table [ns/call]   : " << fixedNanoseconds << endl;
+  cout << "Checksum                : " << sum << endl;
+  cout << "Failures                : " << result.numberOfFailures << endl;
+
+  return result.numberOfFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,233 @@
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CommandLine.hpp"
+#include "FlightDataRecorderReplay.h"
+#include "MonteCarloScenario.h"
+#include "ThrustLimits.h"
+
+// the generated kernels are the reference, the models call the recording replacements below (both kernels are part of
+// this translation unit so that the compiler can treat them equally)
+#include "CachedIndexLookup.cpp"
+#define look1_binlxpw look1_binlxpw_reference
+#include "look1_binlxpw.cpp"
+#undef look1_binlxpw
+#define look2_binlxpw look2_binlxpw_reference
+#include "look2_binlxpw.cpp"
+#undef look2_binlxpw
+
+using namespace std;
+
+// table of a call site, call sites are identified by their breakpoints and table data
+struct LookupSite {
+  bool isTwoDimensional;
+  const real_T* bp0;
+  const real_T* bp1;
+  const real_T* table;
+  const uint32_T* maxIndices;
+  uint32_T maxIndex;
+  uint32_T stride;
+};
+
+struct LookupCall {
+  uint32_t site;
+  real_T u0;
+  real_T u1;
+};
+
+static vector<LookupSite> sites;
+static map<pair<const real_T*, const real_T*>, uint32_t> siteIndices;
+static vector<LookupCall> calls;
+static size_t maximumNumberOfCalls = 0;
+
+static uint32_t getSite(const LookupSite& site) {
+  auto result = siteIndices.emplace(make_pair(site.bp0, site.table), static_cast<uint32_t>(sites.size()));
+  if (result.second) {
+    sites.push_back(site);
+  }
+  return result.first->second;
+}
+
+real_T look1_binlxpw(real_T u0, const real_T bp0[], const real_T table[], uint32_T maxIndex) {
+  if (calls.size() < maximumNumberOfCalls) {
+    calls.push_back({getSite({false, bp0, nullptr, table, nullptr, maxIndex, 0U}), u0, 0});
+  }
+  return look1_binlxpw_reference(u0, bp0, table, maxIndex);
+}
+
+real_T look2_binlxpw(real_T u0, real_T u1, const real_T bp0[], const real_T bp1[], const real_T table[], const uint32_T maxIndex[],
+                     uint32_T stride) {
+  if (calls.size() < maximumNumberOfCalls) {
+    calls.push_back({getSite({true, bp0, bp1, table, maxIndex, 0U, stride}), u0, u1});
+  }
+  return look2_binlxpw_reference(u0, u1, bp0, bp1, table, maxIndex, stride);
+}
+
+// runs the models on a recorded flight, thrust limits get their inputs from the recorded autothrust inputs
+static bool recordFlight(const string& filePath, bool isCompressed) {
+  vector<ReplayFrame> frames;
+  if (!FlightDataRecorderReplay::load(filePath, isCompressed, frames)) {
+    return false;
+  }
+
+  auto flyByWire = make_unique<FlyByWireModelClass>();
+  auto autothrust = make_unique<AutothrustModelClass>();
+  auto thrustLimits = make_unique<ThrustLimitsModelClass>();
+  flyByWire->initialize();
+  autothrust->initialize();
+  thrustLimits->initialize();
+
+  FlyByWireModelClass::ExternalInputs_FlyByWire_T flyByWireInput = {};
+  AutothrustModelClass::ExternalInputs_Autothrust_T autothrustInput = {};
+  ThrustLimitsModelClass::ExternalInputs_ThrustLimits_T thrustLimitsInput = {};
+
+  for (const auto& frame : frames) {
+    flyByWireInput.in = frame.flyByWireInput;
+    flyByWire->setExternalInputs(&flyByWireInput);
+    flyByWire->step();
+
+    autothrustInput.in = frame.autothrustInput;
+    autothrust->setExternalInputs(&autothrustInput);
+    autothrust->step();
+
+    thrustLimitsInput.in.dt = frame.autothrustInput.time.dt;
+    thrustLimitsInput.in.simulation_time_s = frame.autothrustInput.time.simulation_time;
+    thrustLimitsInput.in.H_ft = frame.autothrustInput.data.H_ft;
+    thrustLimitsInput.in.V_mach = frame.autothrustInput.data.V_mach;
+    thrustLimitsInput.in.TAT_degC = frame.autothrustInput.data.TAT_degC;
+    thrustLimitsInput.in.OAT_degC = frame.autothrustInput.data.OAT_degC;
+    thrustLimitsInput.in.thrust_limit_type = frame.autothrustOutput.output.thrust_limit_type;
+    thrustLimits->setExternalInputs(&thrustLimitsInput);
+    thrustLimits->step();
+  }
+
+  return true;
+}
+
+// replays all recorded calls through the given kernel and returns the duration per call in nanoseconds
+template <typename Kernel>
+static double runBenchmark(uint32_t numberOfIterations, vector<real_T>& results, Kernel kernel) {
+  auto start = chrono::steady_clock::now();
+  for (uint32_t iteration = 0; iteration < numberOfIterations; iteration++) {
+    for (size_t i = 0; i < calls.size(); i++) {
+      results[i] = kernel(calls[i]);
+    }
+  }
+  auto duration = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+  return duration / (static_cast<double>(numberOfIterations) * max<size_t>(1, calls.size()));
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  string inFilePath;
+  bool noCompression = false;
+  uint32_t numberOfRuns = 20;
+  uint32_t numberOfIterations = 20;
+  uint32_t numberOfCalls = 5000000;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Checks and benchmarks the cached index lookup kernels against the generated kernels");
+  args.addArgument({"-i", "--in"}, &inFilePath, "Recorded fdr file (Monte Carlo runs are used without)");
+  args.addArgument({"-n", "--no-compression"}, &noCompression, "Input file is not compressed");
+  args.addArgument({"-r", "--runs"}, &numberOfRuns, "Number of Monte Carlo runs without input file");
+  args.addArgument({"-t", "--iterations"}, &numberOfIterations, "Number of benchmark iterations over the recorded calls");
+  args.addArgument({"-c", "--calls"}, &numberOfCalls, "Maximum number of recorded calls");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (numberOfIterations == 0 || numberOfCalls == 0) {
+    cout << "Invalid parameters!" << endl;
+    return 1;
+  }
+
+  // record the inputs of every lookup while the models run
+  maximumNumberOfCalls = numberOfCalls;
+  calls.reserve(numberOfCalls);
+  if (!inFilePath.empty()) {
+    if (!recordFlight(inFilePath, !noCompression)) {
+      return 1;
+    }
+  } else {
+    MonteCarloConfiguration configuration;
+    for (uint32_t i = 0; i < numberOfRuns; i++) {
+      MonteCarloScenario::run(configuration, i);
+    }
+  }
+
+  // run reference and cached kernels, the cached index is kept per call site
+  vector<real_T> referenceResults(calls.size());
+  vector<real_T> cachedResults(calls.size());
+  vector<uint32_T> indices(2 * sites.size(), 0U);
+
+  double referenceNanoseconds = runBenchmark(numberOfIterations, referenceResults, [](const LookupCall& call) {
+    const LookupSite& site = sites[call.site];
+    if (site.isTwoDimensional) {
+      return look2_binlxpw_reference(call.u0, call.u1, site.bp0, site.bp1, site.table, site.maxIndices, site.stride);
+    }
+    return look1_binlxpw_reference(call.u0, site.bp0, site.table, site.maxIndex);
+  });
+
+  double cachedNanoseconds = runBenchmark(numberOfIterations, cachedResults, [&indices](const LookupCall& call) {
+    const LookupSite& site = sites[call.site];
+    uint32_T* index = &indices[2 * call.site];
+    if (site.isTwoDimensional) {
+      return look2_binlxpw_cached(call.u0, call.u1, site.bp0, site.bp1, site.table, site.maxIndices, site.stride, index);
+    }
+    return look1_binlxpw_cached(call.u0, site.bp0, site.table, site.maxIndex, *index);
+  });
+
+  // compare bit patterns
+  uint64_t numberOfMismatches = 0;
+  for (size_t i = 0; i < calls.size(); i++) {
+    if (memcmp(&referenceResults[i], &cachedResults[i], sizeof(real_T)) != 0) {
+      if (numberOfMismatches < 10) {
+        const LookupSite& site = sites[calls[i].site];
+        cout << "Mismatch at call " << i << " (site " << calls[i].site << ", " << (site.isTwoDimensional ? "2D" : "1D") << "): ";
+        cout << setprecision(17) << referenceResults[i] << " != " << cachedResults[i] << endl;
+      }
+      numberOfMismatches++;
+    }
+  }
+
+  // average number of breakpoints searched per call
+  double numberOfBreakpoints = 0;
+  for (const auto& call : calls) {
+    const LookupSite& site = sites[call.site];
+    numberOfBreakpoints += site.isTwoDimensional ? (site.maxIndices[0] + site.maxIndices[1] + 2) / 2.0 : site.maxIndex + 1;
+  }
+
+  // print result
+  cout << "Call sites              : " << sites.size() << endl;
+  cout << "Recorded calls          : " << calls.size() << endl;
+  cout << "Breakpoints per axis    : " << numberOfBreakpoints / max<size_t>(1, calls.size()) << endl;
+  cout << fixed << setprecision(2);
+  cout << "Reference [ns/call]     : " << referenceNanoseconds << endl;
+  cout << "Cached index [ns/call]  : " << cachedNanoseconds << endl;
+  cout << "Speedup                 : " << referenceNanoseconds / max(cachedNanoseconds, 1e-9) << endl;
+  cout << "Mismatches              : " << numberOfMismatches << endl;
+
+  return numberOfMismatches == 0 ? 0 : 1;
+}
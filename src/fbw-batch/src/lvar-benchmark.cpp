@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "CommandLine.hpp"
+#include "GaugesEmulation.h"
+#include "LocalVariable.h"
+
+using namespace std;
+
+// replica of the former implementation (set of heap allocated variables) as reference
+class LegacyLocalVariable {
+ public:
+  explicit LegacyLocalVariable(const string& variable) : name(variable) {
+    id = register_named_variable(name.c_str());
+    read();
+    LOCAL_VARIABLES.insert(this);
+  }
+  ~LegacyLocalVariable() { LOCAL_VARIABLES.erase(this); }
+
+  double get() { return value; }
+  void set(double newValue) {
+    value = newValue;
+    isDirty = true;
+  }
+
+  void read() { value = get_named_variable_value(id); }
+  void write() {
+    if (!isDirty) {
+      return;
+    }
+    set_named_variable_value(id, value);
+    isDirty = false;
+  }
+
+  static void beginFrame() { readAll(); }
+
+  static void readAll() {
+    for (auto variable : LOCAL_VARIABLES) {
+      variable->read();
+    }
+  }
+  static void writeAll() {
+    for (auto variable : LOCAL_VARIABLES) {
+      variable->write();
+    }
+  }
+
+ private:
+  static std::set<LegacyLocalVariable*> LOCAL_VARIABLES;
+
+  ID id;
+  string name;
+  bool isDirty = false;
+  double value = 0.0;
+};
+
+set<LegacyLocalVariable*> LegacyLocalVariable::LOCAL_VARIABLES;
+
+struct BenchmarkResult {
+  double beginFrameNanoseconds;
+  double accessNanoseconds;
+  double writeAllNanoseconds;
+  double readsPerFrame;
+  double writesPerFrame;
+};
+
+template <typename Variable>
+static BenchmarkResult runBenchmark(const string& prefix,
+                                    uint32_t numberOfVariables,
+                                    uint32_t numberOfFrames,
+                                    const vector<uint32_t>& accessed,
+                                    const vector<uint32_t>& written) {
+  // create variables
+  vector<unique_ptr<Variable>> variables;
+  for (uint32_t i = 0; i < numberOfVariables; i++) {
+    variables.push_back(make_unique<Variable>(prefix + to_string(i)));
+  }
+
+  GaugesEmulation::resetCounters();
+
+  chrono::nanoseconds beginFrameTime(0);
+  chrono::nanoseconds accessTime(0);
+  chrono::nanoseconds writeAllTime(0);
+  double sum = 0;
+
+  for (uint32_t frame = 0; frame < numberOfFrames; frame++) {
+    auto t0 = chrono::steady_clock::now();
+    Variable::beginFrame();
+    auto t1 = chrono::steady_clock::now();
+    for (auto i : accessed) {
+      sum += variables[i]->get();
+    }
+    for (auto i : written) {
+      variables[i]->set(frame + i);
+    }
+    auto t2 = chrono::steady_clock::now();
+    Variable::writeAll();
+    auto t3 = chrono::steady_clock::now();
+    beginFrameTime += t1 - t0;
+    accessTime += t2 - t1;
+    writeAllTime += t3 - t2;
+  }
+
+  // keep the compiler from removing the reads
+  if (sum == -1.0) {
+    cout << sum << endl;
+  }
+
+  return {static_cast<double>(beginFrameTime.count()) / numberOfFrames, static_cast<double>(accessTime.count()) / numberOfFrames,
+          static_cast<double>(writeAllTime.count()) / numberOfFrames,
+          static_cast<double>(GaugesEmulation::getNumberOfReads()) / numberOfFrames,
+          static_cast<double>(GaugesEmulation::getNumberOfWrites()) / numberOfFrames};
+}
+
+static void printResult(const string& name, const BenchmarkResult& result) {
+  cout << left << setw(10) << name << right << fixed << setprecision(1);
+  cout << setw(14) << result.beginFrameNanoseconds;
+  cout << setw(14) << result.accessNanoseconds;
+  cout << setw(14) << result.writeAllNanoseconds;
+  cout << setw(14) << result.readsPerFrame;
+  cout << setw(14) << result.writesPerFrame << endl;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  uint32_t numberOfVariables = 250;
+  uint32_t numberOfFrames = 20000;
+  double accessedFraction = 0.6;
+  double writtenFraction = 0.3;
+  uint32_t callCost = 0;
+  uint32_t seed = 0;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Benchmarks the per-frame cost of local variables against the emulated gauges API");
+  args.addArgument({"-n", "--variables"}, &numberOfVariables, "Number of registered variables");
+  args.addArgument({"-f", "--frames"}, &numberOfFrames, "Number of frames");
+  args.addArgument({"-a", "--accessed"}, &accessedFraction, "Fraction of variables read per frame");
+  args.addArgument({"-w", "--written"}, &writtenFraction, "Fraction of variables written per frame");
+  args.addArgument({"-c", "--call-cost"}, &callCost, "Emulated cost of a native call in nanoseconds");
+  args.addArgument({"-s", "--seed"}, &seed, "Seed for selecting the accessed variables");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (numberOfVariables == 0 || numberOfFrames == 0 || accessedFraction < 0 || accessedFraction > 1 || writtenFraction < 0 ||
+      writtenFraction > 1) {
+    cout << "Invalid parameters!" << endl;
+    return 1;
+  }
+
+  // select the variables which are accessed every frame (same set in every frame like in the interface)
+  mt19937 generator(seed);
+  vector<uint32_t> indices(numberOfVariables);
+  iota(indices.begin(), indices.end(), 0);
+  shuffle(indices.begin(), indices.end(), generator);
+  vector<uint32_t> accessed(indices.begin(), indices.begin() + static_cast<size_t>(accessedFraction * numberOfVariables));
+  shuffle(indices.begin(), indices.end(), generator);
+  vector<uint32_t> written(indices.begin(), indices.begin() + static_cast<size_t>(writtenFraction * numberOfVariables));
+
+  GaugesEmulation::setCallCost(callCost);
+
+  cout << "Variables: " << numberOfVariables << ", accessed: " << accessed.size() << ", written: " << written.size();
+  cout << ", frames: " << numberOfFrames << ", call cost: " << callCost << " ns" << endl;
+  cout << left << setw(10) << "" << right;
+  cout << setw(14) << "begin [ns]" << setw(14) << "access [ns]" << setw(14) << "writeAll [ns]";
+  cout << setw(14) << "reads/frame" << setw(14) << "writes/frame" << endl;
+
+  printResult("legacy", runBenchmark<LegacyLocalVariable>("LEGACY_", numberOfVariables, numberOfFrames, accessed, written));
+  printResult("registry", runBenchmark<LocalVariable>("REGISTRY_", numberOfVariables, numberOfFrames, accessed, written));
+
+  // success
+  return 0;
+}
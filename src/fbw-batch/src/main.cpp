@@ -0,0 +1,98 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "CommandLine.hpp"
+#include "MonteCarloScenario.h"
+#include "WorkStealingExecutor.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  uint32_t numberOfRuns = 1000;
+  uint32_t numberOfThreads = thread::hardware_concurrency();
+  uint32_t seed = 0;
+  double duration = 60.0;
+  double sampleTime = 1.0 / 30.0;
+  string outFilePath;
+  string delimiter = ",";
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Runs a32nx fly-by-wire model instances in parallel (Monte Carlo)");
+  args.addArgument({"-r", "--runs"}, &numberOfRuns, "Number of runs");
+  args.addArgument({"-j", "--threads"}, &numberOfThreads, "Number of worker threads");
+  args.addArgument({"-s", "--seed"}, &seed, "Seed for the random flight conditions");
+  args.addArgument({"-t", "--duration"}, &duration, "Mean duration of a run in seconds");
+  args.addArgument({"-dt", "--sample-time"}, &sampleTime, "Sample time of a model step in seconds");
+  args.addArgument({"-o", "--out"}, &outFilePath, "Output file for the per-run results (optional)");
+  args.addArgument({"-d", "--delimiter"}, &delimiter, "Delimiter");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (duration <= 0 || sampleTime <= 0) {
+    cout << "Duration and sample time need to be positive!" << endl;
+    return 1;
+  }
+
+  MonteCarloConfiguration configuration;
+  configuration.seed = seed;
+  configuration.duration = duration;
+  configuration.sampleTime = sampleTime;
+
+  WorkStealingExecutor executor(numberOfThreads);
+
+  // print information on run
+  cout << "Running " << numberOfRuns << " runs on " << executor.getNumberOfWorkers() << " threads";
+  cout << " with seed '" << seed << "'" << endl;
+
+  // every job writes only its own slot, no synchronization needed
+  vector<MonteCarloResult> results(numberOfRuns);
+
+  auto start = chrono::steady_clock::now();
+  executor.run(numberOfRuns, [&](size_t runIndex, unsigned int) { results[runIndex] = MonteCarloScenario::run(configuration, runIndex); });
+  chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+  // print statistics
+  uint64_t totalSteps = 0;
+  for (const auto& result : results) {
+    totalSteps += result.steps;
+  }
+  cout << "Executed " << totalSteps << " model steps in " << elapsed.count() << " s";
+  cout << " (" << (totalSteps / elapsed.count()) << " model-steps/s, ";
+  cout << executor.getNumberOfSteals() << " steals)" << endl;
+
+  // write results if requested
+  if (!outFilePath.empty()) {
+    ofstream out(outFilePath, ios::out | ios::trunc);
+    if (!out.is_open()) {
+      cout << "Failed to create output file!" << endl;
+      return 1;
+    }
+    MonteCarloScenario::writeHeader(out, delimiter);
+    for (const auto& result : results) {
+      MonteCarloScenario::writeResult(out, delimiter, result);
+    }
+  }
+
+  // success
+  return 0;
+}
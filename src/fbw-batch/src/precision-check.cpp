@@ -0,0 +1,459 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Autothrust.h"
+#include "CommandLine.hpp"
+#include "FlightDataRecorderReplay.h"
+#include "SinglePrecisionModels.h"
+#include "ThrustLimits.h"
+
+// the fadec polynomials are header-only, the types of the simconnect sdk are the only dependencies
+typedef void* HANDLE;
+typedef double FLOAT64;
+#include "RegPolynomials.h"
+
+using namespace std;
+
+// maximum deviation of one output of the single-precision variant from the double-precision build
+struct Deviation {
+  const char* name = "";
+  bool isDiscrete = false;
+  uint64_t numberOfSamples = 0;
+  uint64_t numberOfMismatches = 0;
+  double maxDeviation = 0;
+  double maxReference = 0;
+};
+
+class DeviationTable {
+ public:
+  explicit DeviationTable(const char* title) : title(title) {}
+
+  // continuous output, a non-finite value only matches the same non-finite value
+  void add(const char* name, double reference, double actual) {
+    Deviation& deviation = get(name, false);
+    double difference = abs(actual - reference);
+    if (isnan(difference)) {
+      difference = (isnan(reference) && isnan(actual)) || reference == actual ? 0.0 : INFINITY;
+    }
+    deviation.numberOfSamples++;
+    deviation.maxDeviation = max(deviation.maxDeviation, difference);
+    if (isfinite(reference)) {
+      deviation.maxReference = max(deviation.maxReference, abs(reference));
+    }
+  }
+
+  // discrete output (states, modes and flags), only mismatches are counted
+  void addDiscrete(const char* name, double reference, double actual) {
+    Deviation& deviation = get(name, true);
+    deviation.numberOfSamples++;
+    if (reference != actual) {
+      deviation.numberOfMismatches++;
+    }
+  }
+
+  // an output is accepted when the deviation is within the tolerance relative to its magnitude (at least 1) and when
+  // the share of mismatching discrete samples is within the discrete tolerance
+  bool isAccepted(const Deviation& deviation, double tolerance, double discreteTolerance) const {
+    if (deviation.isDiscrete) {
+      return deviation.numberOfMismatches <= discreteTolerance * static_cast<double>(deviation.numberOfSamples);
+    }
+    return deviation.maxDeviation <= tolerance * max(1.0, deviation.maxReference);
+  }
+
+  // prints the table and returns the number of rejected outputs
+  uint32_t print(double tolerance, double discreteTolerance) const {
+    uint32_t numberOfRejectedOutputs = 0;
+    cout << title << endl;
+    cout << "  " << left << setw(40) << "Output" << right << setw(14) << "Max deviation" << setw(14) << "Max |value|"
+         << setw(12) << "Mismatches" << setw(10) << "Result" << endl;
+    for (const auto& deviation : deviations) {
+      bool isOutputAccepted = isAccepted(deviation, tolerance, discreteTolerance);
+      cout << "  " << left << setw(40) << deviation.name << right << scientific << setprecision(3);
+      if (deviation.isDiscrete) {
+        cout << setw(14) << "-" << setw(14) << "-" << setw(12) << deviation.numberOfMismatches;
+      } else {
+        cout << setw(14) << deviation.maxDeviation << setw(14) << deviation.maxReference << setw(12) << "-";
+      }
+      cout << setw(10) << (isOutputAccepted ? "ok" : "REJECTED") << endl;
+      if (!isOutputAccepted) {
+        numberOfRejectedOutputs++;
+      }
+    }
+    cout << endl;
+    return numberOfRejectedOutputs;
+  }
+
+ private:
+  const char* title;
+  vector<Deviation> deviations;
+
+  Deviation& get(const char* name, bool isDiscrete) {
+    for (auto& deviation : deviations) {
+      if (deviation.name == name || strcmp(deviation.name, name) == 0) {
+        return deviation;
+      }
+    }
+    Deviation deviation;
+    deviation.name = name;
+    deviation.isDiscrete = isDiscrete;
+    deviations.push_back(deviation);
+    return deviations.back();
+  }
+};
+
+// climbing flight with the thrust levers moving between the detents and the manual range and with the autothrust being
+// engaged and disconnected, used in addition to the recorded flights
+static vector<athr_in> generateAutothrustInputs(uint32_t seed, uint32_t numberOfSteps) {
+  static const double DETENTS_DEG[] = {0.0, 25.0, 35.0, 45.0};
+  mt19937_64 generator(seed);
+  uniform_real_distribution<double> unit(0.0, 1.0);
+  normal_distribution<double> noise(0.0, 1.0);
+
+  vector<athr_in> inputs;
+  inputs.reserve(numberOfSteps);
+  athr_in input = {};
+  input.data.nz_g = 1.0;
+  input.data.V_ias_kn = 250.0;
+  input.data.H_ft = 5000.0;
+  input.data.TAT_degC = 10.0;
+  input.data.OAT_degC = 5.0;
+  input.data.ambient_density_kg_per_m3 = 1.05;
+  input.data.is_engine_operative_1 = true;
+  input.data.is_engine_operative_2 = true;
+  input.input.TLA_1_deg = 25.0;
+  input.input.TLA_2_deg = 25.0;
+  input.input.V_c_kn = 250.0;
+  input.input.V_LS_kn = 140.0;
+  input.input.V_MAX_kn = 340.0;
+  input.input.thrust_limit_REV_percent = -20.0;
+  input.input.thrust_limit_IDLE_percent = 20.0;
+  input.input.thrust_limit_CLB_percent = 89.0;
+  input.input.thrust_limit_MCT_percent = 90.0;
+  input.input.thrust_limit_TOGA_percent = 95.0;
+  input.input.thrust_reduction_altitude = 1500.0;
+  input.input.thrust_reduction_altitude_go_around = 1500.0;
+  input.input.flight_phase = 3.0;
+  input.input.FD_active = true;
+  for (uint32_t i = 0; i < numberOfSteps; i++) {
+    input.time.dt = 1.0 / 30.0;
+    input.time.simulation_time += input.time.dt;
+
+    // the speed drifts around the target, the engines follow the commanded thrust of the levers
+    input.data.V_ias_kn = clamp(input.data.V_ias_kn + 0.2 * noise(generator), 150.0, 330.0);
+    input.data.V_tas_kn = input.data.V_ias_kn * (1.0 + input.data.H_ft / 60000.0);
+    input.data.V_gnd_kn = input.data.V_tas_kn;
+    input.data.V_mach = input.data.V_tas_kn / 661.0;
+    input.data.H_ft = clamp(input.data.H_ft + 1.0 + noise(generator), 2000.0, 39000.0);
+    input.data.H_ind_ft = input.data.H_ft;
+    input.data.H_radio_ft = 2500.0;
+    input.data.H_dot_fpm = 1800.0 + 60.0 * noise(generator);
+    input.data.Theta_deg = 5.0 + 0.1 * noise(generator);
+    input.data.alpha_deg = 3.0 + 0.1 * noise(generator);
+    const double n1 = 20.0 + 70.0 * input.input.TLA_1_deg / 45.0;
+    input.data.engine_N1_1_percent += 0.05 * (max(n1, 20.0) - input.data.engine_N1_1_percent);
+    input.data.engine_N1_2_percent = input.data.engine_N1_1_percent;
+    input.data.commanded_engine_N1_1_percent = input.data.engine_N1_1_percent;
+    input.data.commanded_engine_N1_2_percent = input.data.engine_N1_2_percent;
+    input.data.corrected_engine_N1_1_percent = input.data.engine_N1_1_percent;
+    input.data.corrected_engine_N1_2_percent = input.data.engine_N1_2_percent;
+
+    // the levers move to a detent or into the manual range, the autothrust is pushed and disconnected rarely
+    if (unit(generator) < 0.002) {
+      input.input.TLA_1_deg = unit(generator) < 0.7 ? DETENTS_DEG[static_cast<int>(4.0 * unit(generator))] : 45.0 * unit(generator);
+      input.input.TLA_2_deg = input.input.TLA_1_deg;
+    }
+    input.input.ATHR_push = i == 30 || unit(generator) < 0.0005;
+    input.input.ATHR_disconnect = unit(generator) < 0.0002;
+    if (unit(generator) < 0.001) {
+      input.input.V_c_kn = 200.0 + 100.0 * unit(generator);
+    }
+    inputs.push_back(input);
+  }
+  return inputs;
+}
+
+// thrust limit inputs of a recorded frame, the thrust limit type is taken from the recorded autothrust output
+static thrust_limits_in getThrustLimitsInput(const ReplayFrame& frame) {
+  const athr_in& autothrust = frame.autothrustInput;
+  thrust_limits_in input = {};
+  input.dt = autothrust.time.dt;
+  input.simulation_time_s = autothrust.time.simulation_time;
+  input.H_ft = autothrust.data.H_ft;
+  input.V_mach = autothrust.data.V_mach;
+  input.TAT_degC = autothrust.data.TAT_degC;
+  input.OAT_degC = autothrust.data.OAT_degC;
+  input.is_anti_ice_wing_active = autothrust.input.is_anti_ice_wing_active;
+  input.is_anti_ice_engine_1_active = autothrust.input.is_anti_ice_engine_1_active;
+  input.is_anti_ice_engine_2_active = autothrust.input.is_anti_ice_engine_2_active;
+  input.is_air_conditioning_1_active = autothrust.input.is_air_conditioning_1_active;
+  input.is_air_conditioning_2_active = autothrust.input.is_air_conditioning_2_active;
+  input.thrust_limit_IDLE_percent = autothrust.input.thrust_limit_IDLE_percent;
+  input.flex_temperature_degC = autothrust.input.flex_temperature_degC;
+  input.thrust_limit_type = static_cast<real_T>(frame.autothrustOutput.output.thrust_limit_type);
+  return input;
+}
+
+// random walk through the envelope of the thrust limits, used in addition to the recorded flights
+static vector<thrust_limits_in> generateThrustLimitsInputs(uint32_t seed, uint32_t numberOfSteps) {
+  mt19937_64 generator(seed);
+  uniform_real_distribution<double> unit(0.0, 1.0);
+  normal_distribution<double> noise(0.0, 1.0);
+
+  vector<thrust_limits_in> inputs;
+  inputs.reserve(numberOfSteps);
+  thrust_limits_in input = {};
+  input.TAT_degC = 15.0;
+  input.OAT_degC = 15.0;
+  input.thrust_limit_IDLE_percent = 20.0;
+  input.thrust_limit_type = 1.0;
+  for (uint32_t i = 0; i < numberOfSteps; i++) {
+    input.dt = 1.0 / 30.0;
+    input.simulation_time_s += input.dt;
+    input.H_ft = clamp(input.H_ft + 20.0 * noise(generator), -2000.0, 45000.0);
+    input.TAT_degC = clamp(input.TAT_degC + 0.05 * noise(generator), -60.0, 55.0);
+    input.OAT_degC = input.TAT_degC - 5.0 * unit(generator);
+    input.V_mach = 0.8 * unit(generator);
+    if (unit(generator) < 0.002) {
+      input.is_anti_ice_engine_1_active = !input.is_anti_ice_engine_1_active;
+      input.is_anti_ice_engine_2_active = input.is_anti_ice_engine_1_active;
+    }
+    if (unit(generator) < 0.002) {
+      input.flex_temperature_degC = unit(generator) < 0.3 ? 0.0 : 30.0 + 40.0 * unit(generator);
+    }
+    if (unit(generator) < 0.005) {
+      input.thrust_limit_type = static_cast<double>(static_cast<int>(6.0 * unit(generator)));
+    }
+    inputs.push_back(input);
+  }
+  return inputs;
+}
+
+static void checkAutothrust(const vector<athr_in>& inputs, DeviationTable& table) {
+  auto reference = make_unique<AutothrustModelClass>();
+  auto single = make_unique<SinglePrecisionAutothrust>();
+  AutothrustModelClass::ExternalInputs_Autothrust_T input = {};
+  reference->initialize();
+  single->initialize();
+
+  for (const auto& in : inputs) {
+    input.in = in;
+    reference->setExternalInputs(&input);
+    reference->step();
+    single->step(in);
+
+    const athr_output& expected = reference->getExternalOutputs().out.output;
+    const athr_output& actual = single->getOutput().output;
+    table.add("sim_throttle_lever_1_pos", expected.sim_throttle_lever_1_pos, actual.sim_throttle_lever_1_pos);
+    table.add("sim_throttle_lever_2_pos", expected.sim_throttle_lever_2_pos, actual.sim_throttle_lever_2_pos);
+    table.add("N1_TLA_1_percent", expected.N1_TLA_1_percent, actual.N1_TLA_1_percent);
+    table.add("N1_TLA_2_percent", expected.N1_TLA_2_percent, actual.N1_TLA_2_percent);
+    table.add("thrust_limit_percent", expected.thrust_limit_percent, actual.thrust_limit_percent);
+    table.add("N1_c_1_percent", expected.N1_c_1_percent, actual.N1_c_1_percent);
+    table.add("N1_c_2_percent", expected.N1_c_2_percent, actual.N1_c_2_percent);
+    table.addDiscrete("sim_thrust_mode_1", expected.sim_thrust_mode_1, actual.sim_thrust_mode_1);
+    table.addDiscrete("sim_thrust_mode_2", expected.sim_thrust_mode_2, actual.sim_thrust_mode_2);
+    table.addDiscrete("is_in_reverse_1", expected.is_in_reverse_1, actual.is_in_reverse_1);
+    table.addDiscrete("is_in_reverse_2", expected.is_in_reverse_2, actual.is_in_reverse_2);
+    table.addDiscrete("thrust_limit_type", expected.thrust_limit_type, actual.thrust_limit_type);
+    table.addDiscrete("status", expected.status, actual.status);
+    table.addDiscrete("mode", expected.mode, actual.mode);
+    table.addDiscrete("mode_message", expected.mode_message, actual.mode_message);
+    table.addDiscrete("thrust_lever_warning_flex", expected.thrust_lever_warning_flex, actual.thrust_lever_warning_flex);
+    table.addDiscrete("thrust_lever_warning_toga", expected.thrust_lever_warning_toga, actual.thrust_lever_warning_toga);
+  }
+}
+
+static void checkThrustLimits(const vector<thrust_limits_in>& inputs, DeviationTable& table) {
+  auto reference = make_unique<ThrustLimitsModelClass>();
+  auto single = make_unique<SinglePrecisionThrustLimits>();
+  ThrustLimitsModelClass::ExternalInputs_ThrustLimits_T input = {};
+  reference->initialize();
+  single->initialize();
+
+  for (const auto& in : inputs) {
+    input.in = in;
+    reference->setExternalInputs(&input);
+    reference->step();
+    single->step(in);
+
+    const thrust_limits_out& expected = reference->getExternalOutputs().out;
+    const thrust_limits_out& actual = single->getOutput();
+    table.add("thrust_limit_IDLE_percent", expected.thrust_limit_IDLE_percent, actual.thrust_limit_IDLE_percent);
+    table.add("thrust_limit_CLB_percent", expected.thrust_limit_CLB_percent, actual.thrust_limit_CLB_percent);
+    table.add("thrust_limit_FLEX_percent", expected.thrust_limit_FLEX_percent, actual.thrust_limit_FLEX_percent);
+    table.add("thrust_limit_MCT_percent", expected.thrust_limit_MCT_percent, actual.thrust_limit_MCT_percent);
+    table.add("thrust_limit_TOGA_percent", expected.thrust_limit_TOGA_percent, actual.thrust_limit_TOGA_percent);
+  }
+}
+
+// evaluates one polynomial with both precisions, the arguments are rounded to float for the single-precision variant
+template <typename Function>
+static void comparePolynomial(DeviationTable& table, const char* name, Function function) {
+  static RegressionPolynomials<double> reference;
+  static RegressionPolynomials<float> single;
+  table.add(name, function(reference), function(single));
+}
+
+// corrected fuel flow and egt along the recorded flight (corrected N1 equals N1 in the replay)
+static void checkCorrectedPolynomials(const vector<ReplayFrame>& frames, DeviationTable& table) {
+  for (const auto& frame : frames) {
+    const athr_raw_data& data = frame.autothrustInput.data;
+    for (double cn1 : {data.corrected_engine_N1_1_percent, data.corrected_engine_N1_2_percent}) {
+      comparePolynomial(table, "correctedFuelFlow", [&](auto& p) { return p.correctedFuelFlow(cn1, data.V_mach, data.H_ft); });
+      comparePolynomial(table, "correctedEGT", [&](auto& p) {
+        auto cff = p.correctedFuelFlow(cn1, data.V_mach, data.H_ft);
+        return p.correctedEGT(cn1, cff, data.V_mach, data.H_ft);
+      });
+    }
+  }
+}
+
+// random samples of the start-up, shutdown and oil polynomials within their operating ranges
+static void checkEnginePolynomials(uint32_t seed, uint32_t numberOfSamples, DeviationTable& table) {
+  mt19937_64 generator(seed);
+  uniform_real_distribution<double> unit(0.0, 1.0);
+  for (uint32_t i = 0; i < numberOfSamples; i++) {
+    const double ambientTemp = -50.0 + 100.0 * unit(generator);
+    const double deltaTime = 0.01 + 0.1 * unit(generator);
+    const double idleN2 = 60.0 + 10.0 * unit(generator);
+    const double idleN1 = 18.0 + 4.0 * unit(generator);
+    const double idleFF = 300.0 + 100.0 * unit(generator);
+    const double idleEGT = 350.0 + 100.0 * unit(generator);
+    const double n2 = idleN2 * unit(generator);
+    const double preN2 = n2 * (0.99 + 0.01 * unit(generator));
+    const double preN1 = 100.0 * unit(generator);
+    const double preEGT = ambientTemp + 900.0 * unit(generator);
+    const double cn1 = 20.0 + 85.0 * unit(generator);
+    const double mach = 0.85 * unit(generator);
+    const double alt = -1000.0 + 40000.0 * unit(generator);
+    const double energy = 200.0 * unit(generator);
+    const double preOilTemp = 20.0 + 70.0 * unit(generator);
+    const double thrust = 27000.0 * unit(generator);
+    const double simN2 = 110.0 * unit(generator);
+
+    comparePolynomial(table, "shutdownN2", [&](auto& p) { return p.shutdownN2(preN2, deltaTime); });
+    comparePolynomial(table, "shutdownN1", [&](auto& p) { return p.shutdownN1(preN1, deltaTime); });
+    comparePolynomial(table, "shutdownEGT", [&](auto& p) { return p.shutdownEGT(preEGT, ambientTemp, deltaTime); });
+    comparePolynomial(table, "startN2", [&](auto& p) { return p.startN2(n2, preN2, idleN2); });
+    comparePolynomial(table, "startN1", [&](auto& p) { return p.startN1(n2, idleN2, idleN1); });
+    comparePolynomial(table, "startFF", [&](auto& p) { return p.startFF(n2, idleN2, idleFF); });
+    comparePolynomial(table, "startEGT", [&](auto& p) { return p.startEGT(n2, idleN2, ambientTemp, idleEGT); });
+    comparePolynomial(table, "startOilTemp", [&](auto& p) { return p.startOilTemp(n2, idleN2, ambientTemp); });
+    comparePolynomial(table, "correctedFuelFlow (sampled)", [&](auto& p) { return p.correctedFuelFlow(cn1, mach, alt); });
+    comparePolynomial(table, "correctedEGT (sampled)", [&](auto& p) {
+      auto cff = p.correctedFuelFlow(cn1, mach, alt);
+      return p.correctedEGT(cn1, cff, mach, alt);
+    });
+    comparePolynomial(table, "oilTemperature", [&](auto& p) { return p.oilTemperature(energy, preOilTemp, 90.0, deltaTime); });
+    comparePolynomial(table, "oilGulpPct", [&](auto& p) { return p.oilGulpPct(thrust); });
+    comparePolynomial(table, "oilPressure", [&](auto& p) { return p.oilPressure(simN2); });
+  }
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  string inFilePath;
+  string inDirectoryPath;
+  bool noCompression = false;
+  uint32_t seed = 0;
+  uint32_t numberOfSteps = 200000;
+  double tolerance = 1e-3;
+  double discreteTolerance = 1e-3;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Replays recorded flights through the single-precision and the double-precision build of the models "
+                   "and reports the maximum deviation of every output");
+  args.addArgument({"-i", "--in"}, &inFilePath, "Recorded fdr file");
+  args.addArgument({"-d", "--directory"}, &inDirectoryPath, "Directory with recorded fdr files");
+  args.addArgument({"-n", "--no-compression"}, &noCompression, "Input files are not compressed");
+  args.addArgument({"-s", "--seed"}, &seed, "Seed for the generated inputs");
+  args.addArgument({"-t", "--steps"}, &numberOfSteps, "Number of generated steps and polynomial samples");
+  args.addArgument({"-r", "--tolerance"}, &tolerance, "Accepted deviation relative to the magnitude of an output (at least 1)");
+  args.addArgument({"-m", "--mismatches"}, &discreteTolerance, "Accepted share of mismatching samples of a discrete output");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // get recorded flights
+  vector<string> filePaths;
+  if (!inFilePath.empty()) {
+    filePaths.push_back(inFilePath);
+  }
+  if (!inDirectoryPath.empty()) {
+    for (const auto& entry : filesystem::directory_iterator(inDirectoryPath)) {
+      if (entry.path().extension() == ".fdr") {
+        filePaths.push_back(entry.path().string());
+      }
+    }
+    sort(filePaths.begin(), filePaths.end());
+  }
+
+  // every recorded flight through both variants, the models start from their initial state with every flight
+  DeviationTable autothrustTable("Autothrust");
+  DeviationTable thrustLimitsTable("ThrustLimits");
+  DeviationTable polynomialsTable("FADEC polynomials");
+  uint64_t numberOfFrames = 0;
+  auto start = chrono::steady_clock::now();
+  for (const auto& filePath : filePaths) {
+    vector<ReplayFrame> frames;
+    if (!FlightDataRecorderReplay::load(filePath, !noCompression, frames)) {
+      return 1;
+    }
+    vector<athr_in> autothrustInputs;
+    vector<thrust_limits_in> thrustLimitsInputs;
+    autothrustInputs.reserve(frames.size());
+    thrustLimitsInputs.reserve(frames.size());
+    for (const auto& frame : frames) {
+      autothrustInputs.push_back(frame.autothrustInput);
+      thrustLimitsInputs.push_back(getThrustLimitsInput(frame));
+    }
+    checkAutothrust(autothrustInputs, autothrustTable);
+    checkThrustLimits(thrustLimitsInputs, thrustLimitsTable);
+    checkCorrectedPolynomials(frames, polynomialsTable);
+    numberOfFrames += frames.size();
+  }
+
+  // generated inputs cover the envelope beyond the recorded flights
+  checkAutothrust(generateAutothrustInputs(seed, numberOfSteps), autothrustTable);
+  checkThrustLimits(generateThrustLimitsInputs(seed, numberOfSteps), thrustLimitsTable);
+  checkEnginePolynomials(seed, numberOfSteps, polynomialsTable);
+  double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  // print result
+  cout << "Flights                 : " << filePaths.size() << endl;
+  cout << "Recorded frames         : " << numberOfFrames << endl;
+  cout << "Generated steps         : " << numberOfSteps << endl;
+  cout << fixed << setprecision(2);
+  cout << "Duration [s]            : " << seconds << endl;
+  cout << endl;
+  uint32_t numberOfRejectedOutputs = 0;
+  numberOfRejectedOutputs += autothrustTable.print(tolerance, discreteTolerance);
+  numberOfRejectedOutputs += thrustLimitsTable.print(tolerance, discreteTolerance);
+  numberOfRejectedOutputs += polynomialsTable.print(tolerance, discreteTolerance);
+  cout << "Rejected outputs        : " << numberOfRejectedOutputs << endl;
+
+  return numberOfRejectedOutputs == 0 ? 0 : 1;
+}
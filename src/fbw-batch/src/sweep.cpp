@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "CommandLine.hpp"
+#include "FlightDataRecorderReplay.h"
+#include "ParameterSweep.h"
+#include "SweepConfiguration.h"
+#include "WorkStealingExecutor.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  string configurationFilePath;
+  string inPath;
+  string outFilePath;
+  string delimiter = ",";
+  uint32_t numberOfThreads = thread::hardware_concurrency();
+  bool noCompression = false;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Sweeps a32nx model parameters against recorded fdr files");
+  args.addArgument({"-c", "--config"}, &configurationFilePath, "Sweep configuration file");
+  args.addArgument({"-i", "--in"}, &inPath, "Input file or directory with input files");
+  args.addArgument({"-o", "--out"}, &outFilePath, "Output file for the cost of every candidate");
+  args.addArgument({"-d", "--delimiter"}, &delimiter, "Delimiter");
+  args.addArgument({"-j", "--threads"}, &numberOfThreads, "Number of worker threads");
+  args.addArgument({"-n", "--no-compression"}, &noCompression, "Input files are not compressed");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (configurationFilePath.empty() || inPath.empty() || outFilePath.empty()) {
+    cout << "Configuration, input and output parameters are required!" << endl;
+    return 1;
+  }
+  if (!filesystem::exists(inPath)) {
+    cout << "Input does not exist!" << endl;
+    return 1;
+  }
+
+  // load configuration
+  SweepConfiguration configuration;
+  if (!configuration.load(configurationFilePath)) {
+    return 1;
+  }
+
+  // load scenarios
+  vector<string> scenarioFiles;
+  if (filesystem::is_directory(inPath)) {
+    for (const auto& entry : filesystem::directory_iterator(inPath)) {
+      if (entry.is_regular_file()) {
+        scenarioFiles.push_back(entry.path().string());
+      }
+    }
+    sort(scenarioFiles.begin(), scenarioFiles.end());
+  } else {
+    scenarioFiles.push_back(inPath);
+  }
+
+  vector<vector<ReplayFrame>> scenarios(scenarioFiles.size());
+  uint64_t numberOfFrames = 0;
+  for (size_t i = 0; i < scenarioFiles.size(); i++) {
+    if (!FlightDataRecorderReplay::load(scenarioFiles[i], !noCompression, scenarios[i])) {
+      return 1;
+    }
+    numberOfFrames += scenarios[i].size();
+  }
+
+  ParameterSweep sweep(configuration, scenarios);
+  auto candidates = sweep.createCandidates();
+
+  WorkStealingExecutor executor(numberOfThreads);
+
+  // print information on sweep
+  cout << "Evaluating " << candidates.size() << " candidates on " << scenarios.size() << " scenarios";
+  cout << " (" << numberOfFrames << " frames) using " << executor.getNumberOfWorkers() << " threads" << endl;
+
+  // every job writes only its own slot, no synchronization needed
+  vector<double> costs(candidates.size());
+
+  auto start = chrono::steady_clock::now();
+  executor.run(candidates.size(), [&](size_t candidateIndex, unsigned int) { costs[candidateIndex] = sweep.evaluate(candidates[candidateIndex]); });
+  chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+  cout << "Evaluated " << candidates.size() << " candidates in " << elapsed.count() << " s";
+  cout << " (" << (candidates.size() * numberOfFrames / elapsed.count()) << " frames/s)" << endl;
+
+  // write results
+  ofstream out(outFilePath, ios::out | ios::trunc);
+  if (!out.is_open()) {
+    cout << "Failed to create output file!" << endl;
+    return 1;
+  }
+  out << "candidate";
+  for (const auto& dimension : configuration.dimensions) {
+    out << delimiter << dimension.parameter.name;
+  }
+  out << delimiter << "cost" << endl;
+  for (size_t i = 0; i < candidates.size(); i++) {
+    out << i;
+    for (double value : candidates[i]) {
+      out << delimiter << value;
+    }
+    out << delimiter << costs[i] << endl;
+  }
+
+  // print best candidate
+  if (!candidates.empty()) {
+    size_t best = min_element(costs.begin(), costs.end()) - costs.begin();
+    cout << "Best candidate " << best << " with cost " << costs[best] << ":" << endl;
+    for (size_t i = 0; i < configuration.dimensions.size(); i++) {
+      cout << "  " << configuration.dimensions[i].parameter.name << " = " << candidates[best][i] << endl;
+    }
+  }
+
+  // success
+  return 0;
+}
@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CommandLine.hpp"
+#include "InterpolatingLookupTable.h"
+#include "ThrustLeverAngleTable.h"
+
+using namespace std;
+
+static constexpr double TLA_REVERSE = -20.0;
+static constexpr double TLA_REVERSE_IDLE = -6.0;
+static constexpr double TLA_IDLE = 0.0;
+static constexpr double TLA_CLIMB = 25.0;
+static constexpr double TLA_FLEX_MCT = 35.0;
+static constexpr double TLA_TOGA = 45.0;
+
+// detents in the order of the throttle configuration (reverse low to toga high)
+struct Configuration {
+  bool useReverseOnAxis;
+  double detents[12];
+};
+
+struct CheckResult {
+  uint64_t numberOfUpdates = 0;
+  uint64_t numberOfMappedEntries = 0;
+  uint64_t numberOfCheckedValues = 0;
+  uint64_t numberOfMismatches = 0;
+};
+
+// same mapping as ThrottleAxisMapping::updateMappingFromConfiguration()
+static vector<pair<double, double>> getMapping(const Configuration& configuration) {
+  static constexpr double TLA[] = {TLA_REVERSE, TLA_REVERSE_IDLE, TLA_IDLE, TLA_CLIMB, TLA_FLEX_MCT, TLA_TOGA};
+  vector<pair<double, double>> mapping;
+  for (size_t i = configuration.useReverseOnAxis ? 0 : 4; i < 12; i++) {
+    mapping.emplace_back(configuration.detents[i], TLA[i / 2]);
+  }
+  return mapping;
+}
+
+static Configuration getDefaultConfiguration() {
+  return {true, {-1.00, -0.95, -0.72, -0.62, -0.50, -0.40, -0.03, +0.07, +0.42, +0.52, +0.95, +1.00}};
+}
+
+// compares every raw axis value (and some beyond the range) against a freshly initialized interpolating table
+static void checkTable(const ThrustLeverAngleTable& table, const Configuration& configuration, CheckResult& result) {
+  InterpolatingLookupTable reference;
+  reference.initialize(getMapping(configuration), configuration.useReverseOnAxis ? TLA_REVERSE : TLA_IDLE, TLA_TOGA);
+
+  for (long raw = ThrustLeverAngleTable::RAW_MINIMUM - 100; raw <= ThrustLeverAngleTable::RAW_MAXIMUM + 100; raw++) {
+    double expected = reference.get(raw / 16384.0);
+    double actual = table.getRaw(raw);
+    if (actual != expected) {
+      if (result.numberOfMismatches < 10) {
+        cout << "Mismatch after update " << result.numberOfUpdates << " at " << raw << ": " << setprecision(17) << expected
+             << " != " << actual << endl;
+      }
+      result.numberOfMismatches++;
+    }
+    result.numberOfCheckedValues++;
+  }
+}
+
+static void update(ThrustLeverAngleTable& table, const Configuration& configuration, CheckResult& result) {
+  result.numberOfMappedEntries +=
+      table.update(getMapping(configuration), configuration.useReverseOnAxis ? TLA_REVERSE : TLA_IDLE, TLA_TOGA);
+  result.numberOfUpdates++;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  uint32_t numberOfEdits = 2000;
+  uint32_t seed = 0;
+  uint32_t numberOfIterations = 1000;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Checks the precomputed thrust lever angles of the raw axis values against the interpolating table");
+  args.addArgument({"-e", "--edits"}, &numberOfEdits, "Number of random configuration edits");
+  args.addArgument({"-s", "--seed"}, &seed, "Seed of the random edits");
+  args.addArgument({"-t", "--iterations"}, &numberOfIterations, "Number of benchmark iterations");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (numberOfIterations == 0) {
+    cout << "Invalid parameters!" << endl;
+    return 1;
+  }
+
+  CheckResult result;
+  mt19937_64 generator(seed);
+  uniform_real_distribution<double> unit(0.0, 1.0);
+
+  // default configuration
+  ThrustLeverAngleTable table;
+  Configuration configuration = getDefaultConfiguration();
+  update(table, configuration, result);
+  checkTable(table, configuration, result);
+
+  // edits like in the throttle configuration page: single detents, reverse on axis and whole configurations
+  for (uint32_t i = 0; i < numberOfEdits; i++) {
+    double kind = unit(generator);
+    if (kind < 0.8) {
+      configuration.detents[generator() % 12] += 0.02 * (unit(generator) - 0.5);
+    } else if (kind < 0.9) {
+      configuration.useReverseOnAxis = !configuration.useReverseOnAxis;
+    } else if (kind < 0.95) {
+      for (auto& detent : configuration.detents) {
+        detent = 2.0 * unit(generator) - 1.0;
+      }
+      sort(begin(configuration.detents), end(configuration.detents));
+    } else {
+      // unchanged configuration
+    }
+    update(table, configuration, result);
+    checkTable(table, configuration, result);
+  }
+
+  // benchmark of raw axis events
+  vector<long> rawValues(4096);
+  uniform_int_distribution<long> rawDistribution(ThrustLeverAngleTable::RAW_MINIMUM, ThrustLeverAngleTable::RAW_MAXIMUM);
+  for (auto& raw : rawValues) {
+    raw = rawDistribution(generator);
+  }
+  double sum = 0;
+  auto start = chrono::steady_clock::now();
+  for (uint32_t iteration = 0; iteration < numberOfIterations; iteration++) {
+    for (long raw : rawValues) {
+      sum += table.get(raw / ThrustLeverAngleTable::RAW_SCALE);
+    }
+  }
+  auto middle = chrono::steady_clock::now();
+  for (uint32_t iteration = 0; iteration < numberOfIterations; iteration++) {
+    for (long raw : rawValues) {
+      sum += table.getRaw(raw);
+    }
+  }
+  auto end = chrono::steady_clock::now();
+  double numberOfCalls = static_cast<double>(numberOfIterations) * rawValues.size();
+
+  // print result
+  cout << "Updates                 : " << result.numberOfUpdates << endl;
+  cout << "Mapped entries / update : " << result.numberOfMappedEntries / max<uint64_t>(1, result.numberOfUpdates) << " of "
+       << ThrustLeverAngleTable::NUMBER_OF_ENTRIES << endl;
+  cout << "Checked values          : " << result.numberOfCheckedValues << endl;
+  cout << fixed << setprecision(2);
+  cout << "Interpolation [ns/call] : " << chrono::duration<double, nano>(middle - start).count() / numberOfCalls << endl;
+  cout << "Table [ns/call]         : " << chrono::duration<double, nano>(end - middle).count() / numberOfCalls << endl;
+  cout << "Checksum                : " << sum << endl;
+  cout << "Mismatches              : " << result.numberOfMismatches << endl;
+
+  return result.numberOfMismatches == 0 ? 0 : 1;
+}
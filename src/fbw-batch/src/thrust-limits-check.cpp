@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CommandLine.hpp"
+#include "FlightDataRecorderReplay.h"
+#include "ThrustLimits.h"
+#include "ThrustLimitsFused.h"
+
+using namespace std;
+
+// thrust limit inputs of a recorded flight, the thrust limit type is taken from the recorded autothrust output
+static bool loadFlight(const string& filePath, bool isCompressed, vector<thrust_limits_in>& inputs) {
+  vector<ReplayFrame> frames;
+  if (!FlightDataRecorderReplay::load(filePath, isCompressed, frames)) {
+    return false;
+  }
+
+  for (const auto& frame : frames) {
+    const athr_in& autothrust = frame.autothrustInput;
+    thrust_limits_in input = {};
+    input.dt = autothrust.time.dt;
+    input.simulation_time_s = autothrust.time.simulation_time;
+    input.H_ft = autothrust.data.H_ft;
+    input.V_mach = autothrust.data.V_mach;
+    input.TAT_degC = autothrust.data.TAT_degC;
+    input.OAT_degC = autothrust.data.OAT_degC;
+    input.is_anti_ice_wing_active = autothrust.input.is_anti_ice_wing_active;
+    input.is_anti_ice_engine_1_active = autothrust.input.is_anti_ice_engine_1_active;
+    input.is_anti_ice_engine_2_active = autothrust.input.is_anti_ice_engine_2_active;
+    input.is_air_conditioning_1_active = autothrust.input.is_air_conditioning_1_active;
+    input.is_air_conditioning_2_active = autothrust.input.is_air_conditioning_2_active;
+    input.thrust_limit_IDLE_percent = autothrust.input.thrust_limit_IDLE_percent;
+    input.flex_temperature_degC = autothrust.input.flex_temperature_degC;
+    input.thrust_limit_type = static_cast<real_T>(frame.autothrustOutput.output.thrust_limit_type);
+    inputs.push_back(input);
+  }
+
+  return true;
+}
+
+// random walk through the whole envelope including inputs beyond the breakpoints of the tables
+static void generateInputs(uint32_t seed, uint32_t numberOfSteps, vector<thrust_limits_in>& inputs) {
+  mt19937_64 generator(seed);
+  uniform_real_distribution<double> unit(0.0, 1.0);
+  normal_distribution<double> noise(0.0, 1.0);
+
+  thrust_limits_in input = {};
+  input.H_ft = 0.0;
+  input.TAT_degC = 15.0;
+  input.OAT_degC = 15.0;
+  input.thrust_limit_IDLE_percent = 20.0;
+  input.thrust_limit_type = 1.0;
+
+  for (uint32_t i = 0; i < numberOfSteps; i++) {
+    input.dt = unit(generator) < 0.01 ? 0.25 * unit(generator) : 1.0 / 30.0;
+    input.simulation_time_s += input.dt;
+
+    // slow drift with occasional jumps
+    if (unit(generator) < 0.001) {
+      input.H_ft = -5000.0 + 55000.0 * unit(generator);
+      input.TAT_degC = -90.0 + 170.0 * unit(generator);
+    } else {
+      input.H_ft = clamp(input.H_ft + 20.0 * noise(generator), -5000.0, 50000.0);
+      input.TAT_degC = clamp(input.TAT_degC + 0.05 * noise(generator), -90.0, 80.0);
+    }
+    input.OAT_degC = input.TAT_degC - 5.0 * unit(generator);
+    input.V_mach = 0.8 * unit(generator);
+
+    // discrete inputs change rarely
+    if (unit(generator) < 0.002) {
+      input.is_anti_ice_wing_active = !input.is_anti_ice_wing_active;
+    }
+    if (unit(generator) < 0.002) {
+      input.is_anti_ice_engine_1_active = !input.is_anti_ice_engine_1_active;
+    }
+    if (unit(generator) < 0.002) {
+      input.is_anti_ice_engine_2_active = !input.is_anti_ice_engine_2_active;
+    }
+    if (unit(generator) < 0.002) {
+      input.is_air_conditioning_1_active = !input.is_air_conditioning_1_active;
+    }
+    if (unit(generator) < 0.002) {
+      input.is_air_conditioning_2_active = !input.is_air_conditioning_2_active;
+    }
+    if (unit(generator) < 0.001) {
+      input.use_external_CLB_limit = !input.use_external_CLB_limit;
+      input.thrust_limit_CLB_percent = 80.0 + 10.0 * unit(generator);
+    }
+    if (unit(generator) < 0.002) {
+      input.flex_temperature_degC = unit(generator) < 0.3 ? 0.0 : 30.0 + 40.0 * unit(generator);
+    }
+    if (unit(generator) < 0.005) {
+      input.thrust_limit_type = static_cast<double>(static_cast<int>(6.0 * unit(generator)));
+    }
+    inputs.push_back(input);
+  }
+}
+
+// steps the given model over all inputs and returns the duration per step in nanoseconds
+template <typename Model>
+static double runModel(Model& model, const vector<thrust_limits_in>& inputs, vector<thrust_limits_out>& outputs) {
+  typename Model::ExternalInputs input = {};
+  auto start = chrono::steady_clock::now();
+  for (size_t i = 0; i < inputs.size(); i++) {
+    input.in = inputs[i];
+    model.setExternalInputs(&input);
+    model.step();
+    outputs[i] = model.getExternalOutputs().out;
+  }
+  auto duration = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+  return duration / max<size_t>(1, inputs.size());
+}
+
+// the generated model with the type names of the fused evaluator
+struct ThrustLimitsReference : public ThrustLimitsModelClass {
+  typedef ExternalInputs_ThrustLimits_T ExternalInputs;
+};
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  string inFilePath;
+  bool noCompression = false;
+  uint32_t seed = 0;
+  uint32_t numberOfSteps = 2000000;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Checks the fused thrust limits evaluator bit by bit against the generated model");
+  args.addArgument({"-i", "--in"}, &inFilePath, "Recorded fdr file (random inputs are used without)");
+  args.addArgument({"-n", "--no-compression"}, &noCompression, "Input file is not compressed");
+  args.addArgument({"-s", "--seed"}, &seed, "Seed for the random inputs");
+  args.addArgument({"-t", "--steps"}, &numberOfSteps, "Number of steps with random inputs");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // get inputs
+  vector<thrust_limits_in> inputs;
+  if (!inFilePath.empty()) {
+    if (!loadFlight(inFilePath, !noCompression, inputs)) {
+      return 1;
+    }
+  } else {
+    inputs.reserve(numberOfSteps);
+    generateInputs(seed, numberOfSteps, inputs);
+  }
+
+  // run both models
+  auto reference = make_unique<ThrustLimitsReference>();
+  auto fused = make_unique<ThrustLimitsFused>();
+  reference->initialize();
+  fused->initialize(reference->getParameters());
+
+  vector<thrust_limits_out> referenceOutputs(inputs.size());
+  vector<thrust_limits_out> fusedOutputs(inputs.size());
+  double referenceNanoseconds = runModel(*reference, inputs, referenceOutputs);
+  double fusedNanoseconds = runModel(*fused, inputs, fusedOutputs);
+
+  // compare bit patterns of every output
+  static const char* OUTPUT_NAMES[] = {"IDLE", "CLB", "FLEX", "MCT", "TOGA"};
+  static const size_t NUMBER_OF_OUTPUTS = sizeof(thrust_limits_out) / sizeof(real_T);
+  uint64_t numberOfMismatches = 0;
+  for (size_t i = 0; i < inputs.size(); i++) {
+    const real_T* expected = &referenceOutputs[i].thrust_limit_IDLE_percent;
+    const real_T* actual = &fusedOutputs[i].thrust_limit_IDLE_percent;
+    for (size_t j = 0; j < NUMBER_OF_OUTPUTS; j++) {
+      if (memcmp(&expected[j], &actual[j], sizeof(real_T)) != 0) {
+        if (numberOfMismatches < 10) {
+          cout << "Mismatch at step " << i << " (" << OUTPUT_NAMES[j] << ", TAT " << inputs[i].TAT_degC << ", H " << inputs[i].H_ft;
+          cout << "): " << setprecision(17) << expected[j] << " != " << actual[j] << endl;
+        }
+        numberOfMismatches++;
+      }
+    }
+  }
+
+  // print result
+  cout << "Steps                   : " << inputs.size() << endl;
+  cout << "Tables / distinct axes  : " << fused->getNumberOfTables() << " / " << fused->getNumberOfAxes() << endl;
+  cout << fixed << setprecision(2);
+  cout << "Reference [ns/step]     : " << referenceNanoseconds << endl;
+  cout << "Fused [ns/step]         : " << fusedNanoseconds << endl;
+  cout << "Speedup                 : " << referenceNanoseconds / max(fusedNanoseconds, 1e-9) << endl;
+  cout << "Mismatches              : " << numberOfMismatches << endl;
+
+  return numberOfMismatches == 0 ? 0 : 1;
+}
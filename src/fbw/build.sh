@@ -11,6 +11,11 @@ else
   WASMLD_ARGS="--strip-debug"
 fi
 
+# route the table lookups of the generated models through the cached index kernels
+if [[ " $* " == *" --lookup-cached-index "* ]]; then
+  CLANG_ARGS="${CLANG_ARGS} -DLOOKUP_CACHED_INDEX"
+fi
+
 set -ex
 
 # create temporary folder for o files
@@ -71,6 +76,7 @@ clang++ \
   -fvisibility=hidden \
   -I "${MSFS_SDK}/WASM/include" \
   -I "${MSFS_SDK}/SimConnect SDK/include" \
+  -I "${DIR}/../wasm-common/src" \
   -I "${DIR}/src/inih" \
   -I "${DIR}/src/interface" \
   "${DIR}/src/interface/SimConnectInterface.cpp" \
@@ -96,15 +102,23 @@ clang++ \
   "${DIR}/src/model/uMultiWord2Double.cpp" \
   -I "${DIR}/src/zlib" \
   "${DIR}/src/zlib/zfstream.cc" \
+  "${DIR}/src/AllocationCounter.cpp" \
   "${DIR}/src/AnimationAileronHandler.cpp" \
+  "${DIR}/src/BreakpointGrid.cpp" \
+  "${DIR}/src/CachedIndexLookup.cpp" \
   "${DIR}/src/ElevatorTrimHandler.cpp" \
   "${DIR}/src/FlyByWireInterface.cpp" \
   "${DIR}/src/FlightDataRecorder.cpp" \
+  "${DIR}/src/FrameTimeProfiler.cpp" \
   "${DIR}/src/LocalVariable.cpp" \
   "${DIR}/src/InterpolatingLookupTable.cpp" \
+  "${DIR}/src/LoadSheddingPolicy.cpp" \
+  "${DIR}/src/RateScheduler.cpp" \
   "${DIR}/src/RudderTrimHandler.cpp" \
   "${DIR}/src/SpoilersHandler.cpp" \
   "${DIR}/src/ThrottleAxisMapping.cpp" \
+  "${DIR}/src/ThrustLeverAngleTable.cpp" \
+  "${DIR}/src/ThrustLimitsFused.cpp" \
   "${DIR}/src/main.cpp" \
 
 # restore directory
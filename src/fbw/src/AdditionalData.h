@@ -26,4 +26,6 @@ struct AdditionalData {
   double throttle_lever_2_pos;
   double corrected_engine_N1_1_percent;
   double corrected_engine_N1_2_percent;
+  double sim_data_age;
+  double sim_data_slow_age;
 };
@@ -0,0 +1,83 @@
+#include <cstdlib>
+#include <new>
+
+#include "AllocationCounter.h"
+
+static uint64_t numberOfAllocations = 0;
+static uint64_t numberOfDeallocations = 0;
+static uint64_t allocatedBytes = 0;
+
+static void* allocate(size_t size) {
+  numberOfAllocations++;
+  allocatedBytes += size;
+  return malloc(size == 0 ? 1 : size);
+}
+
+static void deallocate(void* pointer) {
+  if (pointer == nullptr) {
+    return;
+  }
+  numberOfDeallocations++;
+  free(pointer);
+}
+
+uint64_t AllocationCounter::getNumberOfAllocations() {
+  return numberOfAllocations;
+}
+
+uint64_t AllocationCounter::getNumberOfDeallocations() {
+  return numberOfDeallocations;
+}
+
+uint64_t AllocationCounter::getAllocatedBytes() {
+  return allocatedBytes;
+}
+
+// replacement of the global allocation functions (exceptions are disabled -> abort when out of memory)
+void* operator new(size_t size) {
+  void* pointer = allocate(size);
+  if (pointer == nullptr) {
+    abort();
+  }
+  return pointer;
+}
+
+void* operator new[](size_t size) {
+  void* pointer = allocate(size);
+  if (pointer == nullptr) {
+    abort();
+  }
+  return pointer;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+  deallocate(pointer);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+// Counts heap allocations of the module. The global operators new and delete are replaced in AllocationCounter.cpp and
+// forward to malloc and free, memory allocated directly with malloc (e.g. by zlib) is not counted.
+class AllocationCounter {
+ public:
+  AllocationCounter() = delete;
+  ~AllocationCounter() = delete;
+
+  // monotonic counters since start of the module
+  static uint64_t getNumberOfAllocations();
+  static uint64_t getNumberOfDeallocations();
+  static uint64_t getAllocatedBytes();
+};
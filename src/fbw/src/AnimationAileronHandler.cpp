@@ -2,10 +2,10 @@
 #include <cmath>
 
 AnimationAileronHandler::AnimationAileronHandler() {
-  rateLimiterLeft.setRate(AILERON_RATE);
-  rateLimiterRight.setRate(AILERON_RATE);
-  rateLimiterDroop.setRate(DROOP_RATE);
-  rateLimiterAntiDroop.setRate(ANTI_DROOP_RATE);
+  for (size_t i = 0; i < 2; i++) {
+    rateLimiterPosition.up[i] = AILERON_RATE;
+    rateLimiterPosition.lo[i] = AILERON_RATE;
+  }
 }
 
 void AnimationAileronHandler::update(bool autopilotActive,
@@ -27,9 +27,9 @@ void AnimationAileronHandler::update(bool autopilotActive,
   // anti-droop
   if (groundSpoilersActive && !antiDroopInhibited && (-pitchAttitudeDegrees) < ANTI_DROOP_PITCH_ATTITUDE_REFERENCE &&
       flapsHandleIndex > 0) {
-    rateLimiterAntiDroop.update(ANTI_DROOP_BIAS_ON, dt);
+    DiscreteFilters::rateLimiter(ANTI_DROOP_BIAS_ON, ANTI_DROOP_RATE, ANTI_DROOP_RATE, dt, 0.0, rateLimiterAntiDroop);
   } else {
-    rateLimiterAntiDroop.update(ANTI_DROOP_BIAS_OFF, dt);
+    DiscreteFilters::rateLimiter(ANTI_DROOP_BIAS_OFF, ANTI_DROOP_RATE, ANTI_DROOP_RATE, dt, 0.0, rateLimiterAntiDroop);
   }
 
   // droop
@@ -44,18 +44,20 @@ void AnimationAileronHandler::update(bool autopilotActive,
       targetValueDroop = DROOP_BIAS_OFF;
     }
   }
-  rateLimiterDroop.update(targetValueDroop, dt);
+  DiscreteFilters::rateLimiter(targetValueDroop, DROOP_RATE, DROOP_RATE, dt, 0.0, rateLimiterDroop);
   lastFlapsPosition = flapsPosition;
 
   // set target position
-  rateLimiterLeft.update(fmax(-1.0, fmin(1.0, position + rateLimiterDroop.getValue() + rateLimiterAntiDroop.getValue())), dt);
-  rateLimiterRight.update(fmax(-1.0, fmin(1.0, position - rateLimiterDroop.getValue() - rateLimiterAntiDroop.getValue())), dt);
+  const double targetPosition[2] = {fmax(-1.0, fmin(1.0, position + rateLimiterDroop.pY + rateLimiterAntiDroop.pY)),
+                                    fmax(-1.0, fmin(1.0, position - rateLimiterDroop.pY - rateLimiterAntiDroop.pY))};
+  double limitedPosition[2];
+  rateLimiterPosition.step(targetPosition, dt, limitedPosition);
 }
 
 double AnimationAileronHandler::getPositionLeft() {
-  return rateLimiterLeft.getValue();
+  return rateLimiterPosition.getValue(0);
 }
 
 double AnimationAileronHandler::getPositionRight() {
-  return rateLimiterRight.getValue();
+  return rateLimiterPosition.getValue(1);
 }
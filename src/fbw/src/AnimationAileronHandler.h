@@ -1,6 +1,6 @@
 #pragma once
 
-#include "RateLimiter.h"
+#include "DiscreteFilters.h"
 
 class AnimationAileronHandler {
  public:
@@ -37,8 +37,8 @@ class AnimationAileronHandler {
   double lastFlapsPosition = 0;
   double targetValueDroop = DROOP_BIAS_OFF;
 
-  RateLimiter rateLimiterLeft;
-  RateLimiter rateLimiterRight;
-  RateLimiter rateLimiterDroop;
-  RateLimiter rateLimiterAntiDroop;
+  // left and right aileron
+  RateLimiterBank<2> rateLimiterPosition;
+  RateLimiterState rateLimiterDroop = {};
+  RateLimiterState rateLimiterAntiDroop = {};
 };
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <cmath>
+
+#include "BreakpointGrid.h"
+
+static const char* KIND_NAMES[] = {"ARBITRARY", "UNIFORM", "PIECEWISE_UNIFORM"};
+
+void BreakpointGrid::initialize(const real_T bp[], uint32_T maxIndex) {
+  this->bp = bp;
+  this->maxIndex = maxIndex;
+  kind = ARBITRARY;
+  numberOfSegments = 0;
+  maximumDeviation = 0.0;
+
+  // breakpoints need to be strictly increasing
+  for (uint32_T i = 0; i < maxIndex; i++) {
+    if (!(bp[i] < bp[i + 1U])) {
+      return;
+    }
+  }
+
+  // split into the longest uniform segments, too many segments are not worth the selection
+  uint32_T firstIndex = 0;
+  while (firstIndex < maxIndex) {
+    if (numberOfSegments == MAXIMUM_NUMBER_OF_SEGMENTS) {
+      numberOfSegments = 0;
+      maximumDeviation = 0.0;
+      return;
+    }
+
+    uint32_T lastIndex = firstIndex + 1U;
+    real_T deviation = 0.0;
+    while (lastIndex < maxIndex && isUniform(firstIndex, lastIndex + 1U, deviation)) {
+      lastIndex++;
+    }
+
+    segments[numberOfSegments].firstIndex = firstIndex;
+    segments[numberOfSegments].lastIndex = lastIndex;
+    segments[numberOfSegments].inverseSpacing = (lastIndex - firstIndex) / (bp[lastIndex] - bp[firstIndex]);
+    maximumDeviation = std::fmax(maximumDeviation, deviation);
+    numberOfSegments++;
+    firstIndex = lastIndex;
+  }
+
+  kind = numberOfSegments == 1U ? UNIFORM : PIECEWISE_UNIFORM;
+}
+
+uint32_T BreakpointGrid::findIndex(real_T u) const {
+  if (!isIndexed()) {
+    // same bisection as the generated kernels
+    uint32_T bpIdx = maxIndex >> 1U;
+    uint32_T iLeft = 0U;
+    uint32_T iRght = maxIndex;
+    while (iRght - iLeft > 1U) {
+      if (u < bp[bpIdx]) {
+        iRght = bpIdx;
+      } else {
+        iLeft = bpIdx;
+      }
+      bpIdx = (iRght + iLeft) >> 1U;
+    }
+    return iLeft;
+  }
+
+  // select segment, there are only a few of them and the number of comparisons is fixed per vector
+  uint32_T s = 0;
+  for (uint32_T k = 1U; k < numberOfSegments; k++) {
+    s += u >= bp[segments[k].firstIndex];
+  }
+  const Segment& segment = segments[s];
+
+  // estimate within the segment, the estimate is off by at most one step because every breakpoint deviates by less
+  // than half a spacing from the uniform grid (a small negative estimate truncates to zero)
+  const uint32_T offset = static_cast<uint32_T>((u - bp[segment.firstIndex]) * segment.inverseSpacing);
+  uint32_T index = segment.firstIndex + std::min(offset, segment.lastIndex - segment.firstIndex - 1U);
+  index -= (index > segment.firstIndex && u < bp[index]);
+  index += (index + 1U < segment.lastIndex && u >= bp[index + 1U]);
+
+  // never taken for a valid classification, keeps the result exact in any case
+  while (index > 0U && u < bp[index]) {
+    index--;
+  }
+  while (index + 1U < maxIndex && u >= bp[index + 1U]) {
+    index++;
+  }
+  return index;
+}
+
+BreakpointGrid::Kind BreakpointGrid::getKind() const {
+  return kind;
+}
+
+bool BreakpointGrid::isIndexed() const {
+  return kind != ARBITRARY && maxIndex >= MINIMUM_MAX_INDEX;
+}
+
+uint32_T BreakpointGrid::getNumberOfSegments() const {
+  return numberOfSegments;
+}
+
+real_T BreakpointGrid::getMaximumDeviation() const {
+  return maximumDeviation;
+}
+
+const char* BreakpointGrid::getKindName(Kind kind) {
+  return KIND_NAMES[kind];
+}
+
+bool BreakpointGrid::isUniform(uint32_T firstIndex, uint32_T lastIndex, real_T& deviation) const {
+  // deviation of every breakpoint from the uniform grid relative to the spacing
+  const real_T spacing = (bp[lastIndex] - bp[firstIndex]) / (lastIndex - firstIndex);
+  real_T result = 0.0;
+  for (uint32_T i = firstIndex + 1U; i < lastIndex; i++) {
+    result = std::fmax(result, std::abs(bp[i] - (bp[firstIndex] + (i - firstIndex) * spacing)) / spacing);
+  }
+  if (result >= 0.5) {
+    return false;
+  }
+  deviation = result;
+  return true;
+}
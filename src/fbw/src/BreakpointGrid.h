@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+#include "rtwtypes.h"
+
+// Classification of a breakpoint vector of the generated models. Uniform and piecewise uniform vectors find the bracket
+// of an input with one multiplication by a precomputed reciprocal spacing instead of a bisection. Breakpoints may deviate
+// from the uniform spacing by less than half a spacing, the estimate is then corrected by at most one step. The bracket
+// fulfilling bp[i] <= u < bp[i + 1] is unique, therefore the result always equals the one of the generated kernels.
+class BreakpointGrid {
+ public:
+  enum Kind { ARBITRARY, UNIFORM, PIECEWISE_UNIFORM };
+
+  static constexpr uint32_T MAXIMUM_NUMBER_OF_SEGMENTS = 4;
+
+  // short vectors are bisected in any case, a bisection over a few breakpoints is cheaper than the estimate
+  static constexpr uint32_T MINIMUM_MAX_INDEX = 8;
+
+  // classifies the breakpoints, they are referenced and must outlive the grid
+  void initialize(const real_T bp[], uint32_T maxIndex);
+
+  // bracket for bp[0] < u < bp[maxIndex] (the outer branches of the kernels are handled by the caller)
+  uint32_T findIndex(real_T u) const;
+
+  Kind getKind() const;
+  bool isIndexed() const;
+  uint32_T getNumberOfSegments() const;
+  real_T getMaximumDeviation() const;
+
+  static const char* getKindName(Kind kind);
+
+ private:
+  struct Segment {
+    uint32_T firstIndex;
+    uint32_T lastIndex;
+    real_T inverseSpacing;
+  };
+
+  const real_T* bp = nullptr;
+  uint32_T maxIndex = 0;
+  Kind kind = ARBITRARY;
+  uint32_T numberOfSegments = 0;
+  Segment segments[MAXIMUM_NUMBER_OF_SEGMENTS] = {};
+  real_T maximumDeviation = 0.0;
+
+  bool isUniform(uint32_T firstIndex, uint32_T lastIndex, real_T& deviation) const;
+};
@@ -0,0 +1,88 @@
+#include "CachedIndexLookup.h"
+
+// Finds the bracket of u0 for bp0[0] < u0 < bp0[maxIndex] starting at the cached index. The bracket fulfilling
+// bp0[i] <= u0 < bp0[i + 1] is unique, therefore the result equals the one of the bisection in the generated kernels.
+static uint32_T findBracket(real_T u0, const real_T bp0[], uint32_T maxIndex, uint32_T index) {
+  uint32_T iLeft = index < maxIndex ? index : maxIndex - 1U;
+  uint32_T iRght;
+
+  if (u0 >= bp0[iLeft]) {
+    // common case: input is still within the last bracket
+    if (u0 < bp0[iLeft + 1U]) {
+      return iLeft;
+    }
+    // hunt upwards with doubling steps until the input is enclosed
+    uint32_T step = 1U;
+    iLeft++;
+    iRght = iLeft + step;
+    while (iRght < maxIndex && u0 >= bp0[iRght]) {
+      iLeft = iRght;
+      step <<= 1U;
+      iRght = iLeft + step;
+    }
+    if (iRght > maxIndex) {
+      iRght = maxIndex;
+    }
+  } else {
+    // hunt downwards with doubling steps until the input is enclosed
+    uint32_T step = 1U;
+    iRght = iLeft;
+    iLeft = iRght >= step ? iRght - step : 0U;
+    while (iLeft > 0U && u0 < bp0[iLeft]) {
+      iRght = iLeft;
+      step <<= 1U;
+      iLeft = iRght >= step ? iRght - step : 0U;
+    }
+  }
+
+  // bisect the enclosing range
+  while (iRght - iLeft > 1U) {
+    uint32_T bpIdx = (iRght + iLeft) >> 1U;
+    if (u0 < bp0[bpIdx]) {
+      iRght = bpIdx;
+    } else {
+      iLeft = bpIdx;
+    }
+  }
+
+  return iLeft;
+}
+
+// same branches and arithmetic as the generated kernels, only the bisection is replaced
+static real_T getFraction(real_T u0, const real_T bp0[], uint32_T maxIndex, uint32_T& index) {
+  if (u0 <= bp0[0U]) {
+    index = 0U;
+    return (u0 - bp0[0U]) / (bp0[1U] - bp0[0U]);
+  } else if (u0 < bp0[maxIndex]) {
+    index = findBracket(u0, bp0, maxIndex, index);
+    return (u0 - bp0[index]) / (bp0[index + 1U] - bp0[index]);
+  } else {
+    index = maxIndex - 1U;
+    return (u0 - bp0[maxIndex - 1U]) / (bp0[maxIndex] - bp0[maxIndex - 1U]);
+  }
+}
+
+real_T look1_binlxpw_cached(real_T u0, const real_T bp0[], const real_T table[], uint32_T maxIndex, uint32_T& index) {
+  real_T frac = getFraction(u0, bp0, maxIndex, index);
+  real_T yL_0d0 = table[index];
+  return (table[index + 1U] - yL_0d0) * frac + yL_0d0;
+}
+
+real_T look2_binlxpw_cached(real_T u0,
+                            real_T u1,
+                            const real_T bp0[],
+                            const real_T bp1[],
+                            const real_T table[],
+                            const uint32_T maxIndex[],
+                            uint32_T stride,
+                            uint32_T index[2]) {
+  real_T fraction0 = getFraction(u0, bp0, maxIndex[0U], index[0U]);
+  real_T frac = getFraction(u1, bp1, maxIndex[1U], index[1U]);
+
+  uint32_T bpIdx = index[1U] * stride + index[0U];
+  real_T yL_0d0 = table[bpIdx];
+  yL_0d0 += (table[bpIdx + 1U] - yL_0d0) * fraction0;
+  bpIdx += stride;
+  real_T yL_0d1 = table[bpIdx];
+  return (((table[bpIdx + 1U] - yL_0d1) * fraction0 + yL_0d1) - yL_0d0) * frac + yL_0d0;
+}
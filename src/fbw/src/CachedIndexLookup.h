@@ -0,0 +1,41 @@
+#pragma once
+
+#include "rtwtypes.h"
+
+// Variants of the generated lookup kernels look1_binlxpw and look2_binlxpw which remember the last bracket of each call
+// site. The inputs of most tables change only slightly from frame to frame, so the search hunts outward from the last
+// bracket instead of bisecting the whole table. Results are bit-identical to the generated kernels.
+//
+// When LOOKUP_CACHED_INDEX is defined, the headers of the generated kernels route every call of the generated models
+// through these variants with its own cached index.
+
+real_T look1_binlxpw_cached(real_T u0, const real_T bp0[], const real_T table[], uint32_T maxIndex, uint32_T& index);
+
+real_T look2_binlxpw_cached(real_T u0,
+                            real_T u1,
+                            const real_T bp0[],
+                            const real_T bp1[],
+                            const real_T table[],
+                            const uint32_T maxIndex[],
+                            uint32_T stride,
+                            uint32_T index[2]);
+
+// the cached index is a static of each call site (per thread when the model runs on host threads)
+#ifdef _LIBCPP_HAS_NO_THREADS
+#define LOOKUP_INDEX_STORAGE static
+#else
+#define LOOKUP_INDEX_STORAGE static thread_local
+#endif
+
+// call of a cached kernel with its own index, used by the kernel headers to route the calls of the generated models
+#define LOOK1_BINLXPW_CACHED(u0, bp0, table, maxIndex)                                  \
+  ([&]() -> real_T {                                                                   \
+    LOOKUP_INDEX_STORAGE uint32_T look1_binlxpw_index = 0U;                            \
+    return look1_binlxpw_cached((u0), (bp0), (table), (maxIndex), look1_binlxpw_index); \
+  }())
+
+#define LOOK2_BINLXPW_CACHED(u0, u1, bp0, bp1, table, maxIndex, stride)                                            \
+  ([&]() -> real_T {                                                                                              \
+    LOOKUP_INDEX_STORAGE uint32_T look2_binlxpw_index[2] = {0U, 0U};                                              \
+    return look2_binlxpw_cached((u0), (u1), (bp0), (bp1), (table), (maxIndex), (stride), look2_binlxpw_index); \
+  }())
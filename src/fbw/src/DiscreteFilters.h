@@ -0,0 +1,250 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+// Discrete filters of the generated models (lag, washout, lead-lag and rate limiters). The operations are the ones of
+// the generated functions in the same order, the results are bit-identical (see filter-check). Every filter takes its
+// state as argument, the first update initializes the state like the not_empty flags of the generated models.
+//
+// The banks hold the state of N filters of one type as arrays and update all of them in one loop. All filters of a bank
+// are initialized by the first step, the update loop itself has no branches and vectorizes.
+
+struct FilterState {
+  double pY = 0.0;
+  double pU = 0.0;
+  bool isInitialized = false;
+};
+
+struct RateLimiterState {
+  double pY = 0.0;
+  bool isInitialized = false;
+};
+
+class DiscreteFilters {
+ public:
+  static double lagFilter(double U, double C1, double dt, FilterState& state) {
+    initialize(U, state);
+    const double denom_tmp = dt * C1;
+    const double ca = denom_tmp / (denom_tmp + 2.0);
+    const double Y = (2.0 - denom_tmp) / (denom_tmp + 2.0) * state.pY + (U * ca + state.pU * ca);
+    state.pY = Y;
+    state.pU = U;
+    return Y;
+  }
+
+  static double washoutFilter(double U, double C1, double dt, FilterState& state) {
+    initialize(U, state);
+    const double denom_tmp = dt * C1;
+    const double ca = 2.0 / (denom_tmp + 2.0);
+    const double Y = (2.0 - denom_tmp) / (denom_tmp + 2.0) * state.pY + (U * ca - state.pU * ca);
+    state.pY = Y;
+    state.pU = U;
+    return Y;
+  }
+
+  static double leadLagFilter(double U, double C1, double C2, double C3, double C4, double dt, FilterState& state) {
+    initialize(U, state);
+    const double denom_tmp = dt * C4;
+    const double denom = 2.0 * C3 + denom_tmp;
+    const double tmp = dt * C2;
+    const double Y = ((2.0 * C1 + tmp) / denom * U + (tmp - 2.0 * C1) / denom * state.pU) + (2.0 * C3 - denom_tmp) / denom * state.pY;
+    state.pY = Y;
+    state.pU = U;
+    return Y;
+  }
+
+  static double rateLimiter(double u, double up, double lo, double Ts, double init, RateLimiterState& state) {
+    initialize(init, state);
+    state.pY += std::fmax(std::fmin(u - state.pY, std::abs(up) * Ts), -std::abs(lo) * Ts);
+    return state.pY;
+  }
+
+  // rate limiter that follows the input directly when it deviates by more than the threshold
+  static double rateLimiterWithThreshold(double u,
+                                         double up,
+                                         double lo,
+                                         double Ts,
+                                         double init,
+                                         double threshold,
+                                         RateLimiterState& state) {
+    initialize(init, state);
+    double Y = std::fmax(std::fmin(u - state.pY, std::abs(up) * Ts), -std::abs(lo) * Ts) + state.pY;
+    if (std::abs(u - Y) > threshold) {
+      Y = u;
+    }
+    state.pY = Y;
+    return Y;
+  }
+
+  static void reset(double value, FilterState& state) {
+    state.pY = value;
+    state.pU = value;
+    state.isInitialized = true;
+  }
+
+  static void reset(double value, RateLimiterState& state) {
+    state.pY = value;
+    state.isInitialized = true;
+  }
+
+ private:
+  static void initialize(double value, FilterState& state) {
+    if (!state.isInitialized) {
+      reset(value, state);
+    }
+  }
+
+  static void initialize(double value, RateLimiterState& state) {
+    if (!state.isInitialized) {
+      reset(value, state);
+    }
+  }
+};
+
+template <size_t N>
+class LagFilterBank {
+ public:
+  double C1[N] = {};
+
+  void step(const double U[N], double dt, double Y[N]) {
+    if (!isInitialized) {
+      initialize(U);
+    }
+    for (size_t i = 0; i < N; i++) {
+      const double denom_tmp = dt * C1[i];
+      const double ca = denom_tmp / (denom_tmp + 2.0);
+      Y[i] = (2.0 - denom_tmp) / (denom_tmp + 2.0) * pY[i] + (U[i] * ca + pU[i] * ca);
+      pY[i] = Y[i];
+      pU[i] = U[i];
+    }
+  }
+
+ private:
+  double pY[N] = {};
+  double pU[N] = {};
+  bool isInitialized = false;
+
+  void initialize(const double U[N]) {
+    for (size_t i = 0; i < N; i++) {
+      pY[i] = U[i];
+      pU[i] = U[i];
+    }
+    isInitialized = true;
+  }
+};
+
+template <size_t N>
+class WashoutFilterBank {
+ public:
+  double C1[N] = {};
+
+  void step(const double U[N], double dt, double Y[N]) {
+    if (!isInitialized) {
+      initialize(U);
+    }
+    for (size_t i = 0; i < N; i++) {
+      const double denom_tmp = dt * C1[i];
+      const double ca = 2.0 / (denom_tmp + 2.0);
+      Y[i] = (2.0 - denom_tmp) / (denom_tmp + 2.0) * pY[i] + (U[i] * ca - pU[i] * ca);
+      pY[i] = Y[i];
+      pU[i] = U[i];
+    }
+  }
+
+ private:
+  double pY[N] = {};
+  double pU[N] = {};
+  bool isInitialized = false;
+
+  void initialize(const double U[N]) {
+    for (size_t i = 0; i < N; i++) {
+      pY[i] = U[i];
+      pU[i] = U[i];
+    }
+    isInitialized = true;
+  }
+};
+
+template <size_t N>
+class LeadLagFilterBank {
+ public:
+  double C1[N] = {};
+  double C2[N] = {};
+  double C3[N] = {};
+  double C4[N] = {};
+
+  void step(const double U[N], double dt, double Y[N]) {
+    if (!isInitialized) {
+      initialize(U);
+    }
+    for (size_t i = 0; i < N; i++) {
+      const double denom_tmp = dt * C4[i];
+      const double denom = 2.0 * C3[i] + denom_tmp;
+      const double tmp = dt * C2[i];
+      Y[i] = ((2.0 * C1[i] + tmp) / denom * U[i] + (tmp - 2.0 * C1[i]) / denom * pU[i]) + (2.0 * C3[i] - denom_tmp) / denom * pY[i];
+      pY[i] = Y[i];
+      pU[i] = U[i];
+    }
+  }
+
+ private:
+  double pY[N] = {};
+  double pU[N] = {};
+  bool isInitialized = false;
+
+  void initialize(const double U[N]) {
+    for (size_t i = 0; i < N; i++) {
+      pY[i] = U[i];
+      pU[i] = U[i];
+    }
+    isInitialized = true;
+  }
+};
+
+// rate limiters with threshold, a threshold of infinity gives the plain rate limiter
+template <size_t N>
+class RateLimiterBank {
+ public:
+  double up[N] = {};
+  double lo[N] = {};
+  double init[N] = {};
+  double threshold[N] = {};
+
+  RateLimiterBank() {
+    for (size_t i = 0; i < N; i++) {
+      threshold[i] = INFINITY;
+    }
+  }
+
+  void step(const double u[N], double Ts, double Y[N]) {
+    if (!isInitialized) {
+      initialize();
+    }
+    for (size_t i = 0; i < N; i++) {
+      const double y = std::fmax(std::fmin(u[i] - pY[i], std::abs(up[i]) * Ts), -std::abs(lo[i]) * Ts) + pY[i];
+      Y[i] = std::abs(u[i] - y) > threshold[i] ? u[i] : y;
+      pY[i] = Y[i];
+    }
+  }
+
+  double getValue(size_t i) const { return pY[i]; }
+
+  void reset(size_t i, double value) {
+    if (!isInitialized) {
+      initialize();
+    }
+    pY[i] = value;
+  }
+
+ private:
+  double pY[N] = {};
+  bool isInitialized = false;
+
+  void initialize() {
+    for (size_t i = 0; i < N; i++) {
+      pY[i] = init[i];
+    }
+    isInitialized = true;
+  }
+};
@@ -3,11 +3,10 @@
 #include <ini_type_conversion.h>
 #include <stdio.h>
 #include <chrono>
+#include <cstring>
+#include <ctime>
 #include <fstream>
-#include <iomanip>
 #include <iostream>
-#include <sstream>
-#include <vector>
 
 #include "FlightDataRecorder.h"
 
@@ -36,6 +35,9 @@ void FlightDataRecorder::initialize() {
   cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfFiles           = " << maximumFileCount << endl;
   cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfEntriesPerFile  = " << maximumSampleCounter << endl;
   cout << "WASM: Flight Data Recorder Configuration : Interface Version              = " << INTERFACE_VERSION << endl;
+
+  // use own buffer for the stream so that opening a new file does not allocate memory
+  fileStream.rdbuf()->pubsetbuf(fileStreamBuffer, sizeof(fileStreamBuffer));
 }
 
 void FlightDataRecorder::update(AutopilotStateMachineModelClass* autopilotStateMachine,
@@ -43,7 +45,8 @@ void FlightDataRecorder::update(AutopilotStateMachineModelClass* autopilotStateM
                                 AutothrustModelClass* autoThrust,
                                 FlyByWireModelClass* flyByWire,
                                 const EngineData& engineData,
-                                const AdditionalData& additionalData) {
+                                const AdditionalData& additionalData,
+                                const PerformanceData& performanceData) {
   // check if enabled
   if (!isEnabled) {
     return;
@@ -53,18 +56,32 @@ void FlightDataRecorder::update(AutopilotStateMachineModelClass* autopilotStateM
   manageFlightDataRecorderFiles();
 
   // write data to file
-  fileStream->write((char*)(&autopilotStateMachine->getExternalOutputs().out), sizeof(autopilotStateMachine->getExternalOutputs().out));
-  fileStream->write((char*)(&autopilotLaws->getExternalOutputs().out.output), sizeof(autopilotLaws->getExternalOutputs().out.output));
-  fileStream->write((char*)(&autoThrust->getExternalOutputs().out), sizeof(autoThrust->getExternalOutputs().out));
-  fileStream->write((char*)(&flyByWire->getExternalOutputs().out), sizeof(flyByWire->getExternalOutputs().out));
-  fileStream->write((char*)(&engineData), sizeof(engineData));
-  fileStream->write((char*)(&additionalData), sizeof(additionalData));
+  write(&autopilotStateMachine->getExternalOutputs().out, sizeof(autopilotStateMachine->getExternalOutputs().out));
+  write(&autopilotLaws->getExternalOutputs().out.output, sizeof(autopilotLaws->getExternalOutputs().out.output));
+  write(&autoThrust->getExternalOutputs().out, sizeof(autoThrust->getExternalOutputs().out));
+  write(&flyByWire->getExternalOutputs().out, sizeof(flyByWire->getExternalOutputs().out));
+  write(&engineData, sizeof(engineData));
+  write(&additionalData, sizeof(additionalData));
+  write(&performanceData, sizeof(performanceData));
+
+  // catch up on deferred data
+  if (!isCompressionDeferred) {
+    writeDeferredData(DEFERRED_CHUNK_SIZE);
+  }
+}
+
+void FlightDataRecorder::setCompressionDeferred(bool isDeferred) {
+  if (isDeferred && deferredData.capacity() < MAXIMUM_DEFERRED_SIZE) {
+    // allocate once to avoid reallocation while under load
+    deferredData.reserve(MAXIMUM_DEFERRED_SIZE);
+  }
+  isCompressionDeferred = isDeferred;
 }
 
 void FlightDataRecorder::terminate() {
-  if (fileStream) {
-    fileStream->close();
-    fileStream.reset();
+  if (fileStream.is_open()) {
+    writeDeferredData(deferredData.size());
+    fileStream.close();
   }
 }
 
@@ -75,69 +92,113 @@ void FlightDataRecorder::manageFlightDataRecorderFiles() {
   // check if file is considered full
   if (sampleCounter >= maximumSampleCounter) {
     // close file and delete
-    if (fileStream) {
-      fileStream->close();
-      fileStream.reset();
+    if (fileStream.is_open()) {
+      writeDeferredData(deferredData.size());
+      fileStream.close();
     }
     // reset counter
     sampleCounter = 0;
   }
 
-  if (!fileStream) {
+  if (!fileStream.is_open()) {
     // create new file
-    fileStream = make_shared<gzofstream>(getFlightDataRecorderFilename().c_str());
+    char filename[64];
+    getFlightDataRecorderFilename(filename, sizeof(filename));
+    fileStream.open(filename);
     // write version to file
-    fileStream->write((char*)&INTERFACE_VERSION, sizeof(INTERFACE_VERSION));
+    fileStream.write((char*)&INTERFACE_VERSION, sizeof(INTERFACE_VERSION));
     // clean up directory
     cleanUpFlightDataRecorderFiles();
   }
 }
 
-string FlightDataRecorder::getFlightDataRecorderFilename() {
+void FlightDataRecorder::write(const void* data, size_t size) {
+  // keep data in memory while deferred or while older data is still pending (order must be kept)
+  bool hasDeferredData = deferredDataOffset < deferredData.size();
+  if ((isCompressionDeferred || hasDeferredData) && deferredData.size() + size <= MAXIMUM_DEFERRED_SIZE) {
+    const char* bytes = static_cast<const char*>(data);
+    deferredData.insert(deferredData.end(), bytes, bytes + size);
+    return;
+  }
+
+  // memory is exhausted -> write pending data first
+  writeDeferredData(deferredData.size());
+  fileStream.write((char*)data, size);
+}
+
+void FlightDataRecorder::writeDeferredData(size_t maximumSize) {
+  if (!fileStream.is_open()) {
+    return;
+  }
+
+  // compress next chunk of pending data
+  size_t size = min(maximumSize, deferredData.size() - deferredDataOffset);
+  if (size > 0) {
+    fileStream.write(deferredData.data() + deferredDataOffset, size);
+    deferredDataOffset += size;
+  }
+
+  // keep memory for next deferral
+  if (deferredDataOffset >= deferredData.size()) {
+    deferredData.clear();
+    deferredDataOffset = 0;
+  }
+}
+
+void FlightDataRecorder::getFlightDataRecorderFilename(char* filename, size_t size) {
   // get time
   auto in_time_t = chrono::system_clock::to_time_t(chrono::system_clock::now());
 
   // get filepath based on time
-  stringstream result;
-  result << put_time(gmtime(&in_time_t), "\\work\\%Y-%m-%d-%H-%M-%S.fdr");
-
-  // return result
-  return result.str();
+  strftime(filename, size, "\\work\\%Y-%m-%d-%H-%M-%S.fdr", gmtime(&in_time_t));
 }
 
 void FlightDataRecorder::cleanUpFlightDataRecorderFiles() {
-  // vector for directory entries
-  vector<string> files;
-
   // extension
-  string extension = "fdr";
-
-  // structure representing an directory entry
-  struct dirent* directoryEntry;
-
-  // open directory
-  DIR* directory = opendir("\\work");
-
-  // read directory until end
-  while ((directoryEntry = readdir(directory)) != NULL) {
-    // get filename as string
-    string filename = directoryEntry->d_name;
+  const char* extension = ".fdr";
+  const size_t extensionLength = strlen(extension);
+
+  // remove the oldest file until the maximum is reached, the directory is scanned again instead of collecting the
+  // filenames to avoid allocations
+  while (true) {
+    // open directory
+    DIR* directory = opendir("\\work");
+    if (directory == NULL) {
+      return;
+    }
 
-    // check if file has right extension
-    if (filename.find(extension, (filename.length() - extension.length())) != string::npos) {
-      files.push_back(filename);
+    // structure representing an directory entry
+    struct dirent* directoryEntry;
+
+    // count files and find the oldest one (filenames are based on time)
+    int fileCount = 0;
+    char oldestFilename[256] = {};
+    while ((directoryEntry = readdir(directory)) != NULL) {
+      // check if file has right extension
+      size_t length = strlen(directoryEntry->d_name);
+      if (length < extensionLength || strcmp(directoryEntry->d_name + length - extensionLength, extension) != 0) {
+        continue;
+      }
+
+      fileCount++;
+      if (oldestFilename[0] == '\0' || strcmp(directoryEntry->d_name, oldestFilename) < 0) {
+        strncpy(oldestFilename, directoryEntry->d_name, sizeof(oldestFilename) - 1);
+      }
     }
-  }
 
-  // close directory
-  closedir(directory);
+    // close directory
+    closedir(directory);
 
-  // sort vector
-  sort(files.begin(), files.end(), std::greater<>());
+    // check if done
+    if (fileCount <= maximumFileCount) {
+      return;
+    }
 
-  // remove older files
-  while (files.size() > maximumFileCount) {
-    bool result = remove(("\\work\\" + files.back()).c_str());
-    files.pop_back();
+    // remove oldest file, stop when it cannot be removed
+    char filepath[sizeof(oldestFilename) + 8];
+    snprintf(filepath, sizeof(filepath), "\\work\\%s", oldestFilename);
+    if (remove(filepath) != 0) {
+      return;
+    }
   }
 }
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdio>
 #include <fstream>
+#include <vector>
 
 #include "AdditionalData.h"
 #include "AutopilotLaws.h"
@@ -8,12 +10,13 @@
 #include "Autothrust.h"
 #include "EngineData.h"
 #include "FlyByWire.h"
+#include "PerformanceData.h"
 #include "zfstream.h"
 
 class FlightDataRecorder {
  public:
   // IMPORTANT: this constant needs to increased with every interface change
-  const uint64_t INTERFACE_VERSION = 17;
+  const uint64_t INTERFACE_VERSION = 19;
 
   void initialize();
 
@@ -22,22 +25,39 @@ class FlightDataRecorder {
               AutothrustModelClass* autoThrust,
               FlyByWireModelClass* flyByWire,
               const EngineData& engineData,
-              const AdditionalData& additionalData);
+              const AdditionalData& additionalData,
+              const PerformanceData& performanceData);
+
+  // when deferred, samples are kept uncompressed in memory and compressed in chunks once deferral ends
+  void setCompressionDeferred(bool isDeferred);
 
   void terminate();
 
  private:
+  // maximum amount of uncompressed data kept in memory and the amount compressed per sample when catching up
+  static constexpr size_t MAXIMUM_DEFERRED_SIZE = 1024 * 1024;
+  static constexpr size_t DEFERRED_CHUNK_SIZE = 64 * 1024;
+
   const std::string CONFIGURATION_FILEPATH = "\\work\\FlightDataRecorder.ini";
 
   bool isEnabled = false;
   int sampleCounter = false;
   int maximumSampleCounter = 0;
   int maximumFileCount = 0;
-  std::shared_ptr<gzofstream> fileStream;
+  gzofstream fileStream;
+  char fileStreamBuffer[BUFSIZ] = {};
+
+  bool isCompressionDeferred = false;
+  std::vector<char> deferredData;
+  size_t deferredDataOffset = 0;
+
+  void write(const void* data, size_t size);
+
+  void writeDeferredData(size_t maximumSize);
 
   void manageFlightDataRecorderFiles();
 
-  std::string getFlightDataRecorderFilename();
+  void getFlightDataRecorderFilename(char* filename, size_t size);
 
   void cleanUpFlightDataRecorderFiles();
 };
@@ -5,11 +5,21 @@
 #include <iostream>
 
 #include "FlyByWireInterface.h"
+#include "Logger.h"
 #include "SimConnectData.h"
+#include "SimDataMapping.h"
 
 using namespace std;
 using namespace mINI;
 
+// mapping of the thrust lever angle to the 3D animation position
+static constexpr double THROTTLE_POSITION_3D_TLA[] = {-20.0, 0.0, 25.0, 35.0, 45.0};
+static constexpr double THROTTLE_POSITION_3D_POSITION[] = {0.0, 25.0, 50.0, 75.0, 100.0};
+static constexpr FixedInterpolatingLookupTable<5> throttlePositionLookupTable3d(THROTTLE_POSITION_3D_TLA,
+                                                                                THROTTLE_POSITION_3D_POSITION,
+                                                                                0,
+                                                                                100);
+
 bool FlyByWireInterface::connect() {
   // setup local variables
   setupLocalVariables();
@@ -25,19 +35,32 @@ bool FlyByWireInterface::connect() {
 
   // initialize model
   autopilotStateMachine.initialize();
+  autopilotStateMachine.setIncrementalEvaluation(autopilotStateMachineIncrementalEnabled);
   autopilotLaws.initialize();
+  autopilotLaws.setGeodesyApproximation(autopilotLawsGeodesyApproximationEnabled);
   autoThrust.initialize();
   flyByWire.initialize();
+  thrustLimitsFused.initialize(thrustLimits.getParameters());
 
   // initialize flight data recorder
   flightDataRecorder.initialize();
 
   // connect to sim connect
-  return simConnectInterface.connect(clientDataEnabled, autopilotStateMachineEnabled, autopilotLawsEnabled, flyByWireEnabled, throttleAxis,
-                                     spoilersHandler, elevatorTrimHandler, rudderTrimHandler, flightControlsKeyChangeAileron,
-                                     flightControlsKeyChangeElevator, flightControlsKeyChangeRudder,
-                                     disableXboxCompatibilityRudderAxisPlusMinus, idMinimumSimulationRate->get(),
-                                     idMaximumSimulationRate->get(), limitSimulationRateByPerformance);
+  bool result = simConnectInterface.connect(clientDataEnabled, autopilotStateMachineEnabled, autopilotLawsEnabled, flyByWireEnabled,
+                                            throttleAxis, spoilersHandler, elevatorTrimHandler, rudderTrimHandler,
+                                            flightControlsKeyChangeAileron, flightControlsKeyChangeElevator, flightControlsKeyChangeRudder,
+                                            disableXboxCompatibilityRudderAxisPlusMinus, idMinimumSimulationRate->get(),
+                                            idMaximumSimulationRate->get(), limitSimulationRateByPerformance, simDataSubscriptionEnabled,
+                                            simDataSlowChangedOnly, clientDataChangedOnly, clientDataHeartbeatPeriod);
+
+  // write initial values of local variables
+  LocalVariable::writeAll();
+
+  // write buffered log messages
+  Logger::flush();
+
+  // return result
+  return result;
 }
 
 void FlyByWireInterface::disconnect() {
@@ -57,66 +80,110 @@ void FlyByWireInterface::disconnect() {
 
   // unregister local variables
   unregister_all_named_vars();
+
+  // write buffered log messages
+  Logger::flush();
 }
 
 bool FlyByWireInterface::update(double sampleTime) {
   bool result = true;
 
+  // start frame time measurement
+  frameTimeProfiler.beginFrame();
+  loadSheddingPolicy.beginFrame();
+
+  // throttle publishing of client data under load
+  simConnectInterface.setClientDataPublishingEnabled(loadSheddingPolicy.isClientDataPublishingDue());
+
   // get data & inputs
+  frameTimeProfiler.begin(FrameTimeProfiler::READ_DATA);
   result &= readDataAndLocalVariables(sampleTime);
+  frameTimeProfiler.end(FrameTimeProfiler::READ_DATA);
+
+  // create context of this frame
+  const FrameContext context = createFrameContext(sampleTime);
 
   // update performance monitoring
-  result &= updatePerformanceMonitoring(sampleTime);
+  result &= updatePerformanceMonitoring(context);
 
   // handle simulation rate reduction
-  result &= handleSimulationRate(sampleTime);
+  result &= handleSimulationRate(context);
 
   // do not process laws in pause or slew
-  if (simConnectInterface.getSimData().slew_on) {
+  if (context.simData.slew_on) {
     wasInSlew = true;
+    LocalVariable::writeAll();
+    frameTimeProfiler.endFrame(sampleTime);
+    Logger::flush();
     return result;
-  } else if (pauseDetected || simConnectInterface.getSimData().cameraState >= 10.0) {
+  } else if (context.pauseDetected || context.simData.cameraState >= 10.0) {
+    LocalVariable::writeAll();
+    frameTimeProfiler.endFrame(sampleTime);
+    Logger::flush();
     return result;
   }
 
-  // update altimeter setting
-  result &= updateAltimeterSetting(calculatedSampleTime);
-
-  // update autopilot state machine
-  result &= updateAutopilotStateMachine(calculatedSampleTime);
-
-  // update autopilot laws
-  result &= updateAutopilotLaws(calculatedSampleTime);
-
-  // update fly-by-wire
-  result &= updateFlyByWire(calculatedSampleTime);
+  // determine which scheduled tasks are due in this frame
+  rateScheduler.beginFrame(context.calculatedSampleTime);
 
-  // get throttle data and process it
-  result &= updateThrustLimits(calculatedSampleTime);
+  // update altimeter setting
+  if (rateScheduler.isDue(RateScheduler::ALTIMETER_SETTING)) {
+    result &= updateAltimeterSetting(context);
+    rateScheduler.setExecuted(RateScheduler::ALTIMETER_SETTING);
+  }
 
-  // get throttle data and process it
-  result &= updateAutothrust(calculatedSampleTime);
+  // step the models, either once per frame or at a fixed rate
+  if (fixedRateEnabled) {
+    result &= updateModelsFixedRate(context);
+  } else {
+    result &= updateModels(context);
+  }
 
   // update additional recording data
-  result &= updateAdditionalData(calculatedSampleTime);
+  if (rateScheduler.isDue(RateScheduler::ADDITIONAL_DATA)) {
+    result &= updateAdditionalData(context);
+    rateScheduler.setExecuted(RateScheduler::ADDITIONAL_DATA);
+  }
 
   // update engine data
-  result &= updateEngineData(calculatedSampleTime);
+  if (rateScheduler.isDue(RateScheduler::ENGINE_DATA)) {
+    result &= updateEngineData(context);
+    rateScheduler.setExecuted(RateScheduler::ENGINE_DATA);
+  }
 
   // update spoilers
-  result &= updateSpoilers(calculatedSampleTime);
+  frameTimeProfiler.begin(FrameTimeProfiler::SPOILERS);
+  result &= updateSpoilers(context);
+  frameTimeProfiler.end(FrameTimeProfiler::SPOILERS);
 
-  // update flight data recorder
-  flightDataRecorder.update(&autopilotStateMachine, &autopilotLaws, &autoThrust, &flyByWire, engineData, additionalData);
+  // update flight data recorder (in fixed rate mode every model step is recorded)
+  if (!fixedRateEnabled) {
+    updateFlightDataRecorder();
+  }
 
   // if default AP is on -> disconnect it
-  if (simConnectInterface.getSimData().autopilot_master_on) {
+  if (context.simData.autopilot_master_on) {
     simConnectInterface.sendEvent(SimConnectInterface::Events::AUTOPILOT_OFF);
   }
 
   // reset was in slew flag
   wasInSlew = false;
 
+  // measure load and shed optional work
+  result &= updateLoadShedding();
+
+  // write all changed local variables
+  LocalVariable::writeAll();
+
+  // finish frame time measurement
+  frameTimeProfiler.setScheduledTaskCounts(rateScheduler.getNumberOfExecutedTasks(), rateScheduler.getNumberOfSkippedTasks());
+  frameTimeProfiler.setClientDataCounts(simConnectInterface.getNumberOfClientDataBytesSentInFrame(),
+                                        simConnectInterface.getNumberOfClientDataBytesSuppressedInFrame());
+  frameTimeProfiler.endFrame(sampleTime);
+
+  // write buffered log messages
+  Logger::flush();
+
   // return result
   return result;
 }
@@ -134,17 +201,35 @@ void FlyByWireInterface::loadConfiguration() {
   autoThrustEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "AUTOTHRUST_ENABLED", true);
   flyByWireEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "FLY_BY_WIRE_ENABLED", true);
   tailstrikeProtectionEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "TAILSTRIKE_PROTECTION_ENABLED", false);
+  thrustLimitsFusedEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "THRUST_LIMITS_FUSED_ENABLED", false);
+  autopilotStateMachineIncrementalEnabled =
+      INITypeConversion::getBoolean(iniStructure, "MODEL", "AUTOPILOT_STATE_MACHINE_INCREMENTAL_ENABLED", false);
+  autopilotLawsGeodesyApproximationEnabled =
+      INITypeConversion::getBoolean(iniStructure, "MODEL", "AUTOPILOT_LAWS_GEODESY_APPROXIMATION_ENABLED", false);
+  fixedRateEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "FIXED_RATE_ENABLED", false);
+  double fixedRateFrequency = INITypeConversion::getDouble(iniStructure, "MODEL", "FIXED_RATE_FREQUENCY", 60.0);
+  fixedRateMaximumSteps = INITypeConversion::getInteger(iniStructure, "MODEL", "FIXED_RATE_MAXIMUM_STEPS", 4);
+
+  // ensure sane fixed rate parameters
+  fixedRateSampleTime = 1.0 / max(1.0, fixedRateFrequency);
+  fixedRateMaximumSteps = max(1, fixedRateMaximumSteps);
 
   // if any model is deactivated we need to enable client data
   clientDataEnabled = (!autopilotStateMachineEnabled || !autopilotLawsEnabled || !autoThrustEnabled || !flyByWireEnabled);
 
   // print configuration into console
-  cout << "WASM: MODEL     : CLIENT_DATA_ENABLED (auto)           = " << clientDataEnabled << endl;
-  cout << "WASM: MODEL     : AUTOPILOT_STATE_MACHINE_ENABLED      = " << autopilotStateMachineEnabled << endl;
-  cout << "WASM: MODEL     : AUTOPILOT_LAWS_ENABLED               = " << autopilotLawsEnabled << endl;
-  cout << "WASM: MODEL     : AUTOTHRUST_ENABLED                   = " << autoThrustEnabled << endl;
-  cout << "WASM: MODEL     : FLY_BY_WIRE_ENABLED                  = " << flyByWireEnabled << endl;
-  cout << "WASM: MODEL     : TAILSTRIKE_PROTECTION_ENABLED        = " << tailstrikeProtectionEnabled << endl;
+  cout << "WASM: MODEL     : CLIENT_DATA_ENABLED (auto)                   = " << clientDataEnabled << endl;
+  cout << "WASM: MODEL     : AUTOPILOT_STATE_MACHINE_ENABLED              = " << autopilotStateMachineEnabled << endl;
+  cout << "WASM: MODEL     : AUTOPILOT_LAWS_ENABLED                       = " << autopilotLawsEnabled << endl;
+  cout << "WASM: MODEL     : AUTOTHRUST_ENABLED                           = " << autoThrustEnabled << endl;
+  cout << "WASM: MODEL     : FLY_BY_WIRE_ENABLED                          = " << flyByWireEnabled << endl;
+  cout << "WASM: MODEL     : TAILSTRIKE_PROTECTION_ENABLED                = " << tailstrikeProtectionEnabled << endl;
+  cout << "WASM: MODEL     : THRUST_LIMITS_FUSED_ENABLED                  = " << thrustLimitsFusedEnabled << endl;
+  cout << "WASM: MODEL     : AUTOPILOT_STATE_MACHINE_INCREMENTAL_ENABLED  = " << autopilotStateMachineIncrementalEnabled << endl;
+  cout << "WASM: MODEL     : AUTOPILOT_LAWS_GEODESY_APPROXIMATION_ENABLED = " << autopilotLawsGeodesyApproximationEnabled << endl;
+  cout << "WASM: MODEL     : FIXED_RATE_ENABLED                           = " << fixedRateEnabled << endl;
+  cout << "WASM: MODEL     : FIXED_RATE_FREQUENCY                         = " << 1.0 / fixedRateSampleTime << endl;
+  cout << "WASM: MODEL     : FIXED_RATE_MAXIMUM_STEPS                     = " << fixedRateMaximumSteps << endl;
 
   // --------------------------------------------------------------------------
   // load values - autopilot
@@ -163,6 +248,19 @@ void FlyByWireInterface::loadConfiguration() {
   cout << "WASM: AUTOPILOT : LIMIT_SIMULATION_RATE_BY_PERFORMANCE = " << limitSimulationRateByPerformance << endl;
   cout << "WASM: AUTOPILOT : SIMULATION_RATE_REDUCTION_ENABLED    = " << simulationRateReductionEnabled << endl;
 
+  // --------------------------------------------------------------------------
+  // load values - sim connect
+  simDataSubscriptionEnabled = INITypeConversion::getBoolean(iniStructure, "SIMCONNECT", "DATA_SUBSCRIPTION_ENABLED", false);
+  simDataSlowChangedOnly = INITypeConversion::getBoolean(iniStructure, "SIMCONNECT", "SLOW_DATA_CHANGED_ONLY", true);
+  clientDataChangedOnly = INITypeConversion::getBoolean(iniStructure, "SIMCONNECT", "CLIENT_DATA_CHANGED_ONLY", true);
+  clientDataHeartbeatPeriod = INITypeConversion::getDouble(iniStructure, "SIMCONNECT", "CLIENT_DATA_HEARTBEAT_PERIOD", 1.0);
+
+  // print configuration into console
+  cout << "WASM: SIMCONNECT : DATA_SUBSCRIPTION_ENABLED    = " << simDataSubscriptionEnabled << endl;
+  cout << "WASM: SIMCONNECT : SLOW_DATA_CHANGED_ONLY       = " << simDataSlowChangedOnly << endl;
+  cout << "WASM: SIMCONNECT : CLIENT_DATA_CHANGED_ONLY     = " << clientDataChangedOnly << endl;
+  cout << "WASM: SIMCONNECT : CLIENT_DATA_HEARTBEAT_PERIOD = " << clientDataHeartbeatPeriod << endl;
+
   // --------------------------------------------------------------------------
   // load values - autothrust
   autothrustThrustLimitReverse = INITypeConversion::getDouble(iniStructure, "AUTOTHRUST", "THRUST_LIMIT_REVERSE", -45.0);
@@ -204,6 +302,66 @@ void FlyByWireInterface::loadConfiguration() {
   cout << "WASM: LOGGING : FLIGHT_CONTROLS_ENABLED = " << idLoggingFlightControlsEnabled->get() << endl;
   cout << "WASM: LOGGING : THROTTLES_ENABLED = " << idLoggingThrottlesEnabled->get() << endl;
 
+  // --------------------------------------------------------------------------
+  // load values - profiling
+  bool profilingEnabled = INITypeConversion::getBoolean(iniStructure, "PROFILING", "ENABLED", false);
+  bool profilingFlightDataRecorderEnabled = INITypeConversion::getBoolean(iniStructure, "PROFILING", "FLIGHT_DATA_RECORDER_ENABLED", false);
+  int profilingWindowSize = INITypeConversion::getInteger(iniStructure, "PROFILING", "WINDOW_SIZE", 600);
+  double profilingLogInterval = INITypeConversion::getDouble(iniStructure, "PROFILING", "LOG_INTERVAL", 30.0);
+
+  // initialize profiler
+  frameTimeProfiler.initialize(profilingEnabled, profilingFlightDataRecorderEnabled, profilingWindowSize, profilingLogInterval);
+
+  // print configuration into console
+  cout << "WASM: PROFILING : ENABLED = " << profilingEnabled << endl;
+  cout << "WASM: PROFILING : FLIGHT_DATA_RECORDER_ENABLED = " << profilingFlightDataRecorderEnabled << endl;
+  cout << "WASM: PROFILING : WINDOW_SIZE = " << profilingWindowSize << endl;
+  cout << "WASM: PROFILING : LOG_INTERVAL = " << profilingLogInterval << endl;
+
+  // --------------------------------------------------------------------------
+  // load values - scheduler
+  bool schedulerEnabled = INITypeConversion::getBoolean(iniStructure, "SCHEDULER", "ENABLED", false);
+  int schedulerDividers[RateScheduler::NUMBER_OF_TASKS] = {};
+  schedulerDividers[RateScheduler::ALTIMETER_SETTING] =
+      INITypeConversion::getInteger(iniStructure, "SCHEDULER", "ALTIMETER_SETTING_DIVIDER", 8);
+  schedulerDividers[RateScheduler::APPROACH_CAPABILITY] =
+      INITypeConversion::getInteger(iniStructure, "SCHEDULER", "APPROACH_CAPABILITY_DIVIDER", 4);
+  schedulerDividers[RateScheduler::THRUST_LIMITS] = INITypeConversion::getInteger(iniStructure, "SCHEDULER", "THRUST_LIMITS_DIVIDER", 4);
+  schedulerDividers[RateScheduler::ADDITIONAL_DATA] =
+      INITypeConversion::getInteger(iniStructure, "SCHEDULER", "ADDITIONAL_DATA_DIVIDER", 2);
+  schedulerDividers[RateScheduler::ENGINE_DATA] = INITypeConversion::getInteger(iniStructure, "SCHEDULER", "ENGINE_DATA_DIVIDER", 2);
+
+  // initialize scheduler
+  rateScheduler.initialize(schedulerEnabled, schedulerDividers);
+
+  // print configuration into console
+  cout << "WASM: SCHEDULER : ENABLED = " << schedulerEnabled << endl;
+  for (int i = 0; i < RateScheduler::NUMBER_OF_TASKS; i++) {
+    cout << "WASM: SCHEDULER : " << RateScheduler::TASK_NAMES[i] << "_DIVIDER = " << schedulerDividers[i] << endl;
+  }
+
+  // --------------------------------------------------------------------------
+  // load values - load shedding
+  bool loadSheddingEnabled = INITypeConversion::getBoolean(iniStructure, "LOAD_SHEDDING", "ENABLED", true);
+  double loadSheddingFrameCostBudget = INITypeConversion::getDouble(iniStructure, "LOAD_SHEDDING", "FRAME_COST_BUDGET", 4.0);
+  int loadSheddingEscalationFrames = INITypeConversion::getInteger(iniStructure, "LOAD_SHEDDING", "ESCALATION_FRAMES", 10);
+  int loadSheddingRecoveryFrames = INITypeConversion::getInteger(iniStructure, "LOAD_SHEDDING", "RECOVERY_FRAMES", 300);
+  int loadSheddingSlowStageDecimationFactor =
+      INITypeConversion::getInteger(iniStructure, "LOAD_SHEDDING", "SLOW_STAGE_DECIMATION_FACTOR", 2);
+  int loadSheddingClientDataDivider = INITypeConversion::getInteger(iniStructure, "LOAD_SHEDDING", "CLIENT_DATA_DIVIDER", 2);
+
+  // initialize load shedding
+  loadSheddingPolicy.initialize(loadSheddingEnabled, loadSheddingFrameCostBudget, loadSheddingEscalationFrames, loadSheddingRecoveryFrames,
+                                loadSheddingSlowStageDecimationFactor, loadSheddingClientDataDivider);
+
+  // print configuration into console
+  cout << "WASM: LOAD_SHEDDING : ENABLED = " << loadSheddingEnabled << endl;
+  cout << "WASM: LOAD_SHEDDING : FRAME_COST_BUDGET = " << loadSheddingFrameCostBudget << endl;
+  cout << "WASM: LOAD_SHEDDING : ESCALATION_FRAMES = " << loadSheddingEscalationFrames << endl;
+  cout << "WASM: LOAD_SHEDDING : RECOVERY_FRAMES = " << loadSheddingRecoveryFrames << endl;
+  cout << "WASM: LOAD_SHEDDING : SLOW_STAGE_DECIMATION_FACTOR = " << loadSheddingSlowStageDecimationFactor << endl;
+  cout << "WASM: LOAD_SHEDDING : CLIENT_DATA_DIVIDER = " << loadSheddingClientDataDivider << endl;
+
   // --------------------------------------------------------------------------
   // create axis and load configuration
   for (size_t i = 1; i <= 2; i++) {
@@ -214,15 +372,6 @@ void FlyByWireInterface::loadConfiguration() {
     // store axis
     throttleAxis.emplace_back(axis);
   }
-
-  // create mapping for 3D animation position
-  vector<pair<double, double>> mappingTable3d;
-  mappingTable3d.emplace_back(-20.0, 0.0);
-  mappingTable3d.emplace_back(0.0, 25.0);
-  mappingTable3d.emplace_back(25.0, 50.0);
-  mappingTable3d.emplace_back(35.0, 75.0);
-  mappingTable3d.emplace_back(45.0, 100.0);
-  idThrottlePositionLookupTable3d.initialize(mappingTable3d, 0, 100);
 }
 
 void FlyByWireInterface::setupLocalVariables() {
@@ -234,6 +383,12 @@ void FlyByWireInterface::setupLocalVariables() {
   idMinimumSimulationRate = make_unique<LocalVariable>("A32NX_SIMULATION_RATE_LIMIT_MINIMUM");
   idMaximumSimulationRate = make_unique<LocalVariable>("A32NX_SIMULATION_RATE_LIMIT_MAXIMUM");
 
+  // logging options and simulation rate limits rarely change -> refresh about once per second
+  idLoggingFlightControlsEnabled->setRefreshPolicy(LocalVariable::EVERY_N_FRAMES, 30);
+  idLoggingThrottlesEnabled->setRefreshPolicy(LocalVariable::EVERY_N_FRAMES, 30);
+  idMinimumSimulationRate->setRefreshPolicy(LocalVariable::EVERY_N_FRAMES, 30);
+  idMaximumSimulationRate->setRefreshPolicy(LocalVariable::EVERY_N_FRAMES, 30);
+
   // register L variable for performance warning
   idPerformanceWarningActive = make_unique<LocalVariable>("A32NX_PERFORMANCE_WARNING_ACTIVE");
 
@@ -436,6 +591,9 @@ void FlyByWireInterface::setupLocalVariables() {
 }
 
 bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
+  // start new frame for local variables -> values are fetched on first access
+  LocalVariable::beginFrame();
+
   // set sample time
   simConnectInterface.setSampleTime(sampleTime);
 
@@ -448,21 +606,21 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
 
   // request data
   if (!simConnectInterface.requestData()) {
-    cout << "WASM: Request data failed!" << endl;
+    LOG_ERROR("WASM: Request data failed!");
     return false;
   }
 
   // read data
   if (!simConnectInterface.readData()) {
-    cout << "WASM: Read data failed!" << endl;
+    LOG_ERROR("WASM: Read data failed!");
     return false;
   }
 
-  // get sim data
-  SimData simData = simConnectInterface.getSimData();
+  // forward event counts to profiler
+  frameTimeProfiler.setEventCounts(simConnectInterface.getNumberOfEventsInFrame(), simConnectInterface.getNumberOfCoalescedEventsInFrame());
 
-  // update all local variables
-  LocalVariable::readAll();
+  // get sim data
+  const SimData& simData = simConnectInterface.getSimData();
 
   // update simulation rate limits
   simConnectInterface.updateSimulationRateLimits(idMinimumSimulationRate->get(), idMaximumSimulationRate->get());
@@ -525,29 +683,45 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
     simConnectInterface.setClientDataLocalVariables(clientDataLocalVariables);
   }
 
+  // success
+  return true;
+}
+
+FrameContext FlyByWireInterface::createFrameContext(double sampleTime) {
+  const SimData& simData = simConnectInterface.getSimData();
+
   // detect pause
-  if ((simData.simulationTime == previousSimulationTime) || (simData.simulationTime < 0.2)) {
-    pauseDetected = true;
-  } else {
-    pauseDetected = false;
-  }
+  bool pauseDetected = (simData.simulationTime == previousSimulationTime) || (simData.simulationTime < 0.2);
 
   // calculate delta time (and ensure it does not get 0 -> max 500 fps)
-  calculatedSampleTime = max(0.002, simData.simulationTime - previousSimulationTime);
+  double calculatedSampleTime = max(0.002, simData.simulationTime - previousSimulationTime);
 
   // store previous simulation time
   previousSimulationTime = simData.simulationTime;
 
-  // success
-  return true;
+  // return context of this frame
+  return {simData,
+          simConnectInterface.getSimInput(),
+          simConnectInterface.getSimInputAutopilot(),
+          simConnectInterface.getSimInputThrottles(),
+          simConnectInterface.getClientDataAutopilotStateMachine(),
+          simConnectInterface.getClientDataAutopilotLaws(),
+          simConnectInterface.getClientDataAutothrust(),
+          simConnectInterface.getClientDataFlyByWire(),
+          sampleTime,
+          calculatedSampleTime,
+          simData.simulationTime,
+          pauseDetected,
+          simConnectInterface.getSimDataAge(),
+          simConnectInterface.getSimDataSlowAge()};
 }
 
-bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime) {
+bool FlyByWireInterface::updatePerformanceMonitoring(const FrameContext& context) {
   // check calculated delta time for performance issues (to also take sim rate into account)
-  if (calculatedSampleTime > MAX_ACCEPTABLE_SAMPLE_TIME && lowPerformanceTimer < LOW_PERFORMANCE_TIMER_THRESHOLD) {
+  if (context.calculatedSampleTime > MAX_ACCEPTABLE_SAMPLE_TIME && lowPerformanceTimer < LOW_PERFORMANCE_TIMER_THRESHOLD) {
     // performance is low -> increase counter
     lowPerformanceTimer++;
-  } else if (calculatedSampleTime < MAX_ACCEPTABLE_SAMPLE_TIME) {
+  } else if (context.calculatedSampleTime < MAX_ACCEPTABLE_SAMPLE_TIME) {
     // performance is ok -> reset counter
     lowPerformanceTimer = 0;
   }
@@ -556,10 +730,8 @@ bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime) {
   if (lowPerformanceTimer >= LOW_PERFORMANCE_TIMER_THRESHOLD) {
     if (idPerformanceWarningActive->get() <= 0) {
       idPerformanceWarningActive->set(1);
-      cout << "WASM: WARNING Performance issues detected, at least stable ";
-      cout << round(simConnectInterface.getSimData().simulation_rate / MAX_ACCEPTABLE_SAMPLE_TIME);
-      cout << " fps or more are needed at this simrate!";
-      cout << endl;
+      LOG_WARNING("WASM: WARNING Performance issues detected, at least stable %g fps or more are needed at this simrate!",
+                  round(context.simData.simulation_rate / MAX_ACCEPTABLE_SAMPLE_TIME));
     }
   } else if (idPerformanceWarningActive > 0) {
     idPerformanceWarningActive->set(0);
@@ -569,9 +741,9 @@ bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
+bool FlyByWireInterface::handleSimulationRate(const FrameContext& context) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const SimData& simData = context.simData;
 
   // check if target simulation rate was modified and there is a mismatch
   if (targetSimulationRateModified && simData.simulation_rate != targetSimulationRate) {
@@ -596,8 +768,8 @@ bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
     // sed event to reduce simulation rate
     simConnectInterface.sendEvent(SimConnectInterface::Events::SIM_RATE_DECR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
     // log event of reduction
-    cout << "WASM: WARNING Reducing simulation rate to " << simData.simulation_rate / 2;
-    cout << " (maximum allowed is " << idMaximumSimulationRate->get() << ")!" << endl;
+    LOG_WARNING("WASM: WARNING Reducing simulation rate to %g (maximum allowed is %g)!", simData.simulation_rate / 2,
+                idMaximumSimulationRate->get());
   }
 
   // check if simulation rate reduction is enabled
@@ -605,9 +777,10 @@ bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
     return true;
   }
 
-  // check if simulation rate should be reduced
-  if (idPerformanceWarningActive->get() == 1 || abs(simConnectInterface.getSimData().Phi_deg) > 33 ||
-      simConnectInterface.getSimData().Theta_deg < -20 || simConnectInterface.getSimData().Theta_deg > 10 ||
+  // check if simulation rate should be reduced (on performance issues only when no more work can be shed)
+  bool isPerformanceReductionNeeded = idPerformanceWarningActive->get() == 1 && loadSheddingPolicy.isSimulationRateReductionAllowed();
+  if (isPerformanceReductionNeeded || abs(context.simData.Phi_deg) > 33 ||
+      context.simData.Theta_deg < -20 || context.simData.Theta_deg > 10 ||
       flyByWireOutput.sim.data_computed.high_aoa_prot_active == 1 || flyByWireOutput.sim.data_computed.high_speed_prot_active == 1 ||
       autopilotStateMachineOutput.speed_protection_mode == 1) {
     // set target simulation rate
@@ -618,17 +791,29 @@ bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
     // reset low performance timer
     lowPerformanceTimer = 0;
     // log event of reduction
-    cout << "WASM: WARNING Reducing simulation rate from " << simData.simulation_rate;
-    cout << " to " << simData.simulation_rate / 2;
-    cout << " due to performance issues or abnormal situation!" << endl;
+    LOG_WARNING("WASM: WARNING Reducing simulation rate from %g to %g due to performance issues or abnormal situation!",
+                simData.simulation_rate, simData.simulation_rate / 2);
   }
 
   // success
   return true;
 }
 
-bool FlyByWireInterface::updateAdditionalData(double sampleTime) {
-  auto simData = simConnectInterface.getSimData();
+bool FlyByWireInterface::updateLoadShedding() {
+  // evaluate load of this frame
+  loadSheddingPolicy.endFrame(idPerformanceWarningActive->get() == 1);
+
+  // apply decisions for the next frame
+  flightDataRecorder.setCompressionDeferred(loadSheddingPolicy.isFlightDataRecorderCompressionDeferred());
+  Logger::setMaximumLevel(loadSheddingPolicy.isLoggingSuppressed() ? LOGGER_LEVEL_WARNING : LOGGER_LEVEL);
+  rateScheduler.setDecimationFactor(loadSheddingPolicy.getSlowStageDecimationFactor());
+
+  // success
+  return true;
+}
+
+bool FlyByWireInterface::updateAdditionalData(const FrameContext& context) {
+  const SimData& simData = context.simData;
   additionalData.master_warning_active = idMasterWarning->get();
   additionalData.master_caution_active = idMasterCaution->get();
   additionalData.park_brake_lever_pos = idParkBrakeLeverPos->get();
@@ -654,12 +839,14 @@ bool FlyByWireInterface::updateAdditionalData(double sampleTime) {
   additionalData.throttle_lever_2_pos = simData.throttle_lever_2_pos;
   additionalData.corrected_engine_N1_1_percent = simData.corrected_engine_N1_1_percent;
   additionalData.corrected_engine_N1_2_percent = simData.corrected_engine_N1_2_percent;
+  additionalData.sim_data_age = context.simDataAge;
+  additionalData.sim_data_slow_age = context.simDataSlowAge;
 
   return true;
 }
 
-bool FlyByWireInterface::updateEngineData(double sampleTime) {
-  auto simData = simConnectInterface.getSimData();
+bool FlyByWireInterface::updateEngineData(const FrameContext& context) {
+  const SimData& simData = context.simData;
   engineData.generalEngineElapsedTime_1 = simData.generalEngineElapsedTime_1;
   engineData.generalEngineElapsedTime_2 = simData.generalEngineElapsedTime_2;
   engineData.standardAtmTemperature = simData.standardAtmTemperature;
@@ -712,11 +899,102 @@ bool FlyByWireInterface::updateEngineData(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateAutopilotStateMachine(double sampleTime) {
+bool FlyByWireInterface::updateModels(const FrameContext& context) {
+  bool result = true;
+
+  // update autopilot state machine
+  frameTimeProfiler.begin(FrameTimeProfiler::AUTOPILOT_STATE_MACHINE);
+  result &= updateAutopilotStateMachine(context);
+  frameTimeProfiler.end(FrameTimeProfiler::AUTOPILOT_STATE_MACHINE);
+
+  // update autopilot laws
+  frameTimeProfiler.begin(FrameTimeProfiler::AUTOPILOT_LAWS);
+  result &= updateAutopilotLaws(context);
+  frameTimeProfiler.end(FrameTimeProfiler::AUTOPILOT_LAWS);
+
+  // update fly-by-wire
+  frameTimeProfiler.begin(FrameTimeProfiler::FLY_BY_WIRE);
+  result &= updateFlyByWire(context);
+  frameTimeProfiler.end(FrameTimeProfiler::FLY_BY_WIRE);
+
+  // update thrust limits, when scheduled at a lower rate the model is stepped with the time since its last update
+  if (rateScheduler.isDue(RateScheduler::THRUST_LIMITS)) {
+    FrameContext thrustLimitsContext = context;
+    thrustLimitsContext.calculatedSampleTime = rateScheduler.getSampleTime(RateScheduler::THRUST_LIMITS, context.calculatedSampleTime);
+    frameTimeProfiler.begin(FrameTimeProfiler::THRUST_LIMITS);
+    result &= updateThrustLimits(thrustLimitsContext);
+    frameTimeProfiler.end(FrameTimeProfiler::THRUST_LIMITS);
+    rateScheduler.setExecuted(RateScheduler::THRUST_LIMITS);
+  }
+
+  // get throttle data and process it
+  frameTimeProfiler.begin(FrameTimeProfiler::AUTOTHRUST);
+  result &= updateAutothrust(context);
+  frameTimeProfiler.end(FrameTimeProfiler::AUTOTHRUST);
+
+  return result;
+}
+
+bool FlyByWireInterface::updateModelsFixedRate(const FrameContext& context) {
+  bool result = true;
+
+  // accumulate simulation time and determine the number of model steps in this frame
+  fixedRateAccumulator += context.calculatedSampleTime;
+  int numberOfSteps = static_cast<int>(fixedRateAccumulator / fixedRateSampleTime);
+  double stepSampleTime = fixedRateSampleTime;
+  if (numberOfSteps > fixedRateMaximumSteps) {
+    // limit the number of steps, the time is not dropped but processed with a larger sample time
+    stepSampleTime = (numberOfSteps * fixedRateSampleTime) / fixedRateMaximumSteps;
+    numberOfSteps = fixedRateMaximumSteps;
+  }
+
+  // step the models, each step has its own simulation time
+  FrameContext stepContext = context;
+  stepContext.calculatedSampleTime = stepSampleTime;
+  for (int i = 0; i < numberOfSteps; i++) {
+    previousSurfaceOutput = {flyByWireOutput.output.eta_pos, flyByWireOutput.output.xi_pos, flyByWireOutput.output.zeta_pos};
+    fixedRateAccumulator -= stepSampleTime;
+    stepContext.simulationTime = context.simulationTime - fixedRateAccumulator;
+    result &= updateModels(stepContext);
+    updateFlightDataRecorder();
+    if (!fixedRateHasPreviousStep) {
+      previousSurfaceOutput = {flyByWireOutput.output.eta_pos, flyByWireOutput.output.xi_pos, flyByWireOutput.output.zeta_pos};
+      fixedRateHasPreviousStep = true;
+    }
+  }
+
+  // nothing to write before the first step or in tracking mode
+  if (!fixedRateHasPreviousStep || flyByWireOutput.sim.data_computed.tracking_mode_on) {
+    return result;
+  }
+
+  // interpolate surface positions between the last two steps by the remaining time
+  double fraction = min(1.0, fixedRateAccumulator / fixedRateSampleTime);
+  SimOutput output = {
+      previousSurfaceOutput.eta + fraction * (flyByWireOutput.output.eta_pos - previousSurfaceOutput.eta),
+      previousSurfaceOutput.xi + fraction * (flyByWireOutput.output.xi_pos - previousSurfaceOutput.xi),
+      previousSurfaceOutput.zeta + fraction * (flyByWireOutput.output.zeta_pos - previousSurfaceOutput.zeta),
+  };
+  if (!simConnectInterface.sendData(output)) {
+    LOG_ERROR("WASM: Write data failed!");
+    return false;
+  }
+
+  return result;
+}
+
+void FlyByWireInterface::updateFlightDataRecorder() {
+  frameTimeProfiler.begin(FrameTimeProfiler::FLIGHT_DATA_RECORDER);
+  flightDataRecorder.update(&autopilotStateMachine, &autopilotLaws, &autoThrust, &flyByWire, engineData, additionalData,
+                            frameTimeProfiler.getPerformanceData());
+  frameTimeProfiler.end(FrameTimeProfiler::FLIGHT_DATA_RECORDER);
+}
+
+bool FlyByWireInterface::updateAutopilotStateMachine(const FrameContext& context) {
   // get data from interface ------------------------------------------------------------------------------------------
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
-  SimInputAutopilot simInputAutopilot = simConnectInterface.getSimInputAutopilot();
+  const SimData& simData = context.simData;
+  const SimInput& simInput = context.simInput;
+  const SimInputAutopilot& simInputAutopilot = context.simInputAutopilot;
 
   // determine disconnection conditions -------------------------------------------------------------------------------
 
@@ -729,50 +1007,11 @@ bool FlyByWireInterface::updateAutopilotStateMachine(double sampleTime) {
   // update state machine ---------------------------------------------------------------------------------------------
   if (autopilotStateMachineEnabled) {
     // time -----------------------------------------------------------------------------------------------------------
-    autopilotStateMachineInput.in.time.dt = sampleTime;
-    autopilotStateMachineInput.in.time.simulation_time = simData.simulationTime;
+    autopilotStateMachineInput.in.time.dt = context.calculatedSampleTime;
+    autopilotStateMachineInput.in.time.simulation_time = context.simulationTime;
 
     // data -----------------------------------------------------------------------------------------------------------
-    autopilotStateMachineInput.in.data.aircraft_position.lat = simData.latitude_deg;
-    autopilotStateMachineInput.in.data.aircraft_position.lon = simData.longitude_deg;
-    autopilotStateMachineInput.in.data.aircraft_position.alt = simData.altitude_m;
-    autopilotStateMachineInput.in.data.Theta_deg = simData.Theta_deg;
-    autopilotStateMachineInput.in.data.Phi_deg = simData.Phi_deg;
-    autopilotStateMachineInput.in.data.q_rad_s = simData.bodyRotationVelocity.x;
-    autopilotStateMachineInput.in.data.r_rad_s = simData.bodyRotationVelocity.y;
-    autopilotStateMachineInput.in.data.p_rad_s = simData.bodyRotationVelocity.z;
-    autopilotStateMachineInput.in.data.V_ias_kn = simData.V_ias_kn;
-    autopilotStateMachineInput.in.data.V_tas_kn = simData.V_tas_kn;
-    autopilotStateMachineInput.in.data.V_mach = simData.V_mach;
-    autopilotStateMachineInput.in.data.V_gnd_kn = simData.V_gnd_kn;
-    autopilotStateMachineInput.in.data.alpha_deg = simData.alpha_deg;
-    autopilotStateMachineInput.in.data.beta_deg = simData.beta_deg;
-    autopilotStateMachineInput.in.data.H_ft = simData.H_ft;
-    autopilotStateMachineInput.in.data.H_ind_ft = simData.H_ind_ft;
-    autopilotStateMachineInput.in.data.H_radio_ft = simData.H_radio_ft;
-    autopilotStateMachineInput.in.data.H_dot_ft_min = simData.H_dot_fpm;
-    autopilotStateMachineInput.in.data.Psi_magnetic_deg = simData.Psi_magnetic_deg;
-    autopilotStateMachineInput.in.data.Psi_magnetic_track_deg = simData.Psi_magnetic_track_deg;
-    autopilotStateMachineInput.in.data.Psi_true_deg = simData.Psi_true_deg;
-    autopilotStateMachineInput.in.data.bx_m_s2 = simData.bx_m_s2;
-    autopilotStateMachineInput.in.data.by_m_s2 = simData.by_m_s2;
-    autopilotStateMachineInput.in.data.bz_m_s2 = simData.bz_m_s2;
-    autopilotStateMachineInput.in.data.nav_valid = (simData.nav_valid != 0);
-    autopilotStateMachineInput.in.data.nav_loc_deg = simData.nav_loc_deg;
-    autopilotStateMachineInput.in.data.nav_gs_deg = simData.nav_gs_deg;
-    autopilotStateMachineInput.in.data.nav_dme_valid = (simData.nav_dme_valid != 0);
-    autopilotStateMachineInput.in.data.nav_dme_nmi = simData.nav_dme_nmi;
-    autopilotStateMachineInput.in.data.nav_loc_valid = (simData.nav_loc_valid != 0);
-    autopilotStateMachineInput.in.data.nav_loc_magvar_deg = simData.nav_loc_magvar_deg;
-    autopilotStateMachineInput.in.data.nav_loc_error_deg = simData.nav_loc_error_deg;
-    autopilotStateMachineInput.in.data.nav_loc_position.lat = simData.nav_loc_pos.Latitude;
-    autopilotStateMachineInput.in.data.nav_loc_position.lon = simData.nav_loc_pos.Longitude;
-    autopilotStateMachineInput.in.data.nav_loc_position.alt = simData.nav_loc_pos.Altitude;
-    autopilotStateMachineInput.in.data.nav_gs_valid = (simData.nav_gs_valid != 0);
-    autopilotStateMachineInput.in.data.nav_gs_error_deg = simData.nav_gs_error_deg;
-    autopilotStateMachineInput.in.data.nav_gs_position.lat = simData.nav_gs_pos.Latitude;
-    autopilotStateMachineInput.in.data.nav_gs_position.lon = simData.nav_gs_pos.Longitude;
-    autopilotStateMachineInput.in.data.nav_gs_position.alt = simData.nav_gs_pos.Altitude;
+    copySimDataToAutopilot(simData, autopilotStateMachineInput.in.data);
     autopilotStateMachineInput.in.data.flight_guidance_xtk_nmi = flightGuidanceCrossTrackError;
     autopilotStateMachineInput.in.data.flight_guidance_tae_deg = flightGuidanceTrackAngleError;
     autopilotStateMachineInput.in.data.flight_guidance_phi_deg = flightGuidancePhiPreCommand;
@@ -794,14 +1033,7 @@ bool FlyByWireInterface::updateAutopilotStateMachine(double sampleTime) {
     autopilotStateMachineInput.in.data.cruise_altitude = idFmgcCruiseAltitude->get();
     autopilotStateMachineInput.in.data.throttle_lever_1_pos = thrustLeverAngle_1->get();
     autopilotStateMachineInput.in.data.throttle_lever_2_pos = thrustLeverAngle_2->get();
-    autopilotStateMachineInput.in.data.gear_strut_compression_1 = simData.gear_animation_pos_1;
-    autopilotStateMachineInput.in.data.gear_strut_compression_2 = simData.gear_animation_pos_2;
-    autopilotStateMachineInput.in.data.zeta_pos = simData.zeta_pos;
     autopilotStateMachineInput.in.data.flaps_handle_index = flapsHandleIndexFlapConf->get();
-    autopilotStateMachineInput.in.data.is_engine_operative_1 = simData.engine_combustion_1;
-    autopilotStateMachineInput.in.data.is_engine_operative_2 = simData.engine_combustion_2;
-    autopilotStateMachineInput.in.data.altimeter_setting_left_mbar = simData.kohlsmanSetting_0;
-    autopilotStateMachineInput.in.data.altimeter_setting_right_mbar = simData.kohlsmanSetting_1;
 
     // input ----------------------------------------------------------------------------------------------------------
     autopilotStateMachineInput.in.input.FD_active = simData.ap_fd_1_active || simData.ap_fd_2_active;
@@ -859,7 +1091,7 @@ bool FlyByWireInterface::updateAutopilotStateMachine(double sampleTime) {
     idRadioReceiverGlideSlopeDeviation->set(autopilotStateMachine.getExternalOutputs().out.data.nav_e_gs_error_deg);
   } else {
     // read client data written by simulink
-    ClientDataAutopilotStateMachine clientData = simConnectInterface.getClientDataAutopilotStateMachine();
+    const ClientDataAutopilotStateMachine& clientData = context.clientDataAutopilotStateMachine;
     autopilotStateMachineOutput.enabled_AP1 = clientData.enabled_AP1;
     autopilotStateMachineOutput.enabled_AP2 = clientData.enabled_AP2;
     autopilotStateMachineOutput.lateral_law = clientData.lateral_law;
@@ -974,6 +1206,52 @@ bool FlyByWireInterface::updateAutopilotStateMachine(double sampleTime) {
   idFmaSoftAltModeActive->set(autopilotStateMachineOutput.ALT_soft_mode_active);
   idFmaCruiseAltModeActive->set(autopilotStateMachineOutput.ALT_cruise_mode_active);
 
+  // update approach capability
+  if (rateScheduler.isDue(RateScheduler::APPROACH_CAPABILITY)) {
+    updateApproachCapability(context);
+    rateScheduler.setExecuted(RateScheduler::APPROACH_CAPABILITY);
+  }
+
+  // autoland warning -------------------------------------------------------------------------------------------------
+  int numberOfAutopilotsEngaged = autopilotStateMachineOutput.enabled_AP1 + autopilotStateMachineOutput.enabled_AP2;
+  // if at least one AP engaged and LAND or FLARE mode -> latch
+  if (simData.H_radio_ft < 200 && numberOfAutopilotsEngaged > 0 &&
+      (autopilotStateMachineOutput.vertical_mode == 32 || autopilotStateMachineOutput.vertical_mode == 33)) {
+    autolandWarningLatch = true;
+  } else if (simData.H_radio_ft >= 200 ||
+             (autopilotStateMachineOutput.vertical_mode != 32 && autopilotStateMachineOutput.vertical_mode != 33)) {
+    autolandWarningLatch = false;
+    autolandWarningTriggered = false;
+    idAutopilotAutolandWarning->set(0);
+  }
+
+  if (autolandWarningLatch && !autolandWarningTriggered) {
+    if (numberOfAutopilotsEngaged == 0 ||
+        (simData.H_radio_ft > 15 && (abs(simData.nav_loc_error_deg) > 0.2 || simData.nav_loc_valid == false)) ||
+        (simData.H_radio_ft > 100 && (abs(simData.nav_gs_error_deg) > 0.4 || simData.nav_gs_valid == false))) {
+      autolandWarningTriggered = true;
+      idAutopilotAutolandWarning->set(1);
+    }
+  }
+
+  // FMA triple click and mode reversion ------------------------------------------------------------------------------
+  idFmaTripleClick->set(autopilotStateMachineOutput.mode_reversion_triple_click);
+  idFmaModeReversion->set(autopilotStateMachineOutput.mode_reversion_fma);
+
+  // return result ----------------------------------------------------------------------------------------------------
+  return true;
+}
+
+bool FlyByWireInterface::updateApproachCapability(const FrameContext& context) {
+  // get sim data
+  const SimData& simData = context.simData;
+
+  // get autopilot modes
+  bool isLocArmed = static_cast<unsigned long long>(autopilotStateMachineOutput.lateral_mode_armed) >> 1 & 0x01;
+  bool isLocEngaged = autopilotStateMachineOutput.lateral_mode >= 30 && autopilotStateMachineOutput.lateral_mode <= 34;
+  bool isGsArmed = static_cast<unsigned long long>(autopilotStateMachineOutput.vertical_mode_armed) >> 4 & 0x01;
+  bool isGsEngaged = autopilotStateMachineOutput.vertical_mode >= 30 && autopilotStateMachineOutput.vertical_mode <= 34;
+
   // calculate and set approach capability
   // when no RA is available at all -> CAT1, at least one RA is needed to get into CAT2 or higher
   // CAT3 requires two valid RA which are not simulated yet
@@ -1029,103 +1307,39 @@ bool FlyByWireInterface::updateAutopilotStateMachine(double sampleTime) {
   }
 
   bool doUpdate = false;
-  bool canDowngrade = (simData.simulationTime - previousApproachCapabilityUpdateTime) > 3.0;
-  bool canUpgrade = (simData.simulationTime - previousApproachCapabilityUpdateTime) > 1.5;
+  bool canDowngrade = (context.simulationTime - previousApproachCapabilityUpdateTime) > 3.0;
+  bool canUpgrade = (context.simulationTime - previousApproachCapabilityUpdateTime) > 1.5;
   if (newApproachCapability != currentApproachCapability) {
     doUpdate = (newApproachCapability == 0 && currentApproachCapability == 1) ||
                (newApproachCapability == 1 && currentApproachCapability == 0) ||
                (newApproachCapability > currentApproachCapability && canUpgrade) ||
                (newApproachCapability < currentApproachCapability && canDowngrade);
   } else {
-    previousApproachCapabilityUpdateTime = simData.simulationTime;
+    previousApproachCapabilityUpdateTime = context.simulationTime;
   }
 
   if (doUpdate) {
     currentApproachCapability = newApproachCapability;
     idFmaApproachCapability->set(currentApproachCapability);
-    previousApproachCapabilityUpdateTime = simData.simulationTime;
-  }
-
-  // autoland warning -------------------------------------------------------------------------------------------------
-  // if at least one AP engaged and LAND or FLARE mode -> latch
-  if (simData.H_radio_ft < 200 && numberOfAutopilotsEngaged > 0 &&
-      (autopilotStateMachineOutput.vertical_mode == 32 || autopilotStateMachineOutput.vertical_mode == 33)) {
-    autolandWarningLatch = true;
-  } else if (simData.H_radio_ft >= 200 ||
-             (autopilotStateMachineOutput.vertical_mode != 32 && autopilotStateMachineOutput.vertical_mode != 33)) {
-    autolandWarningLatch = false;
-    autolandWarningTriggered = false;
-    idAutopilotAutolandWarning->set(0);
+    previousApproachCapabilityUpdateTime = context.simulationTime;
   }
 
-  if (autolandWarningLatch && !autolandWarningTriggered) {
-    if (numberOfAutopilotsEngaged == 0 ||
-        (simData.H_radio_ft > 15 && (abs(simData.nav_loc_error_deg) > 0.2 || simData.nav_loc_valid == false)) ||
-        (simData.H_radio_ft > 100 && (abs(simData.nav_gs_error_deg) > 0.4 || simData.nav_gs_valid == false))) {
-      autolandWarningTriggered = true;
-      idAutopilotAutolandWarning->set(1);
-    }
-  }
-
-  // FMA triple click and mode reversion ------------------------------------------------------------------------------
-  idFmaTripleClick->set(autopilotStateMachineOutput.mode_reversion_triple_click);
-  idFmaModeReversion->set(autopilotStateMachineOutput.mode_reversion_fma);
-
-  // return result ----------------------------------------------------------------------------------------------------
+  // result
   return true;
 }
 
-bool FlyByWireInterface::updateAutopilotLaws(double sampleTime) {
+bool FlyByWireInterface::updateAutopilotLaws(const FrameContext& context) {
   // get data from interface ------------------------------------------------------------------------------------------
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = context.simData;
 
   // update laws ------------------------------------------------------------------------------------------------------
   if (autopilotLawsEnabled) {
     // time -----------------------------------------------------------------------------------------------------------
-    autopilotLawsInput.in.time.dt = sampleTime;
-    autopilotLawsInput.in.time.simulation_time = simData.simulationTime;
+    autopilotLawsInput.in.time.dt = context.calculatedSampleTime;
+    autopilotLawsInput.in.time.simulation_time = context.simulationTime;
 
     // data -----------------------------------------------------------------------------------------------------------
-    autopilotLawsInput.in.data.aircraft_position.lat = simData.latitude_deg;
-    autopilotLawsInput.in.data.aircraft_position.lon = simData.longitude_deg;
-    autopilotLawsInput.in.data.aircraft_position.alt = simData.altitude_m;
-    autopilotLawsInput.in.data.Theta_deg = simData.Theta_deg;
-    autopilotLawsInput.in.data.Phi_deg = simData.Phi_deg;
-    autopilotLawsInput.in.data.q_rad_s = simData.bodyRotationVelocity.x;
-    autopilotLawsInput.in.data.r_rad_s = simData.bodyRotationVelocity.y;
-    autopilotLawsInput.in.data.p_rad_s = simData.bodyRotationVelocity.z;
-    autopilotLawsInput.in.data.V_ias_kn = simData.V_ias_kn;
-    autopilotLawsInput.in.data.V_tas_kn = simData.V_tas_kn;
-    autopilotLawsInput.in.data.V_mach = simData.V_mach;
-    autopilotLawsInput.in.data.V_gnd_kn = simData.V_gnd_kn;
-    autopilotLawsInput.in.data.alpha_deg = simData.alpha_deg;
-    autopilotLawsInput.in.data.beta_deg = simData.beta_deg;
-    autopilotLawsInput.in.data.H_ft = simData.H_ft;
-    autopilotLawsInput.in.data.H_ind_ft = simData.H_ind_ft;
-    autopilotLawsInput.in.data.H_radio_ft = simData.H_radio_ft;
-    autopilotLawsInput.in.data.H_dot_ft_min = simData.H_dot_fpm;
-    autopilotLawsInput.in.data.Psi_magnetic_deg = simData.Psi_magnetic_deg;
-    autopilotLawsInput.in.data.Psi_magnetic_track_deg = simData.Psi_magnetic_track_deg;
-    autopilotLawsInput.in.data.Psi_true_deg = simData.Psi_true_deg;
-    autopilotLawsInput.in.data.bx_m_s2 = simData.bx_m_s2;
-    autopilotLawsInput.in.data.by_m_s2 = simData.by_m_s2;
-    autopilotLawsInput.in.data.bz_m_s2 = simData.bz_m_s2;
-    autopilotLawsInput.in.data.nav_valid = (simData.nav_valid != 0);
-    autopilotLawsInput.in.data.nav_loc_deg = simData.nav_loc_deg;
-    autopilotLawsInput.in.data.nav_gs_deg = simData.nav_gs_deg;
-    autopilotLawsInput.in.data.nav_dme_valid = (simData.nav_dme_valid != 0);
-    autopilotLawsInput.in.data.nav_dme_nmi = simData.nav_dme_nmi;
-    autopilotLawsInput.in.data.nav_loc_valid = (simData.nav_loc_valid != 0);
-    autopilotLawsInput.in.data.nav_loc_magvar_deg = simData.nav_loc_magvar_deg;
-    autopilotLawsInput.in.data.nav_loc_error_deg = simData.nav_loc_error_deg;
-    autopilotLawsInput.in.data.nav_loc_position.lat = simData.nav_loc_pos.Latitude;
-    autopilotLawsInput.in.data.nav_loc_position.lon = simData.nav_loc_pos.Longitude;
-    autopilotLawsInput.in.data.nav_loc_position.alt = simData.nav_loc_pos.Altitude;
-    autopilotLawsInput.in.data.nav_gs_valid = (simData.nav_gs_valid != 0);
-    autopilotLawsInput.in.data.nav_gs_error_deg = simData.nav_gs_error_deg;
-    autopilotLawsInput.in.data.nav_gs_position.lat = simData.nav_gs_pos.Latitude;
-    autopilotLawsInput.in.data.nav_gs_position.lon = simData.nav_gs_pos.Longitude;
-    autopilotLawsInput.in.data.nav_gs_position.alt = simData.nav_gs_pos.Altitude;
+    copySimDataToAutopilot(simData, autopilotLawsInput.in.data);
     autopilotLawsInput.in.data.flight_guidance_xtk_nmi = flightGuidanceCrossTrackError;
     autopilotLawsInput.in.data.flight_guidance_tae_deg = flightGuidanceTrackAngleError;
     autopilotLawsInput.in.data.flight_guidance_phi_deg = flightGuidancePhiPreCommand;
@@ -1146,14 +1360,7 @@ bool FlyByWireInterface::updateAutopilotLaws(double sampleTime) {
     autopilotLawsInput.in.data.acceleration_altitude_go_around_engine_out = idFmgcAccelerationAltitudeGoAroundEngineOut->get();
     autopilotLawsInput.in.data.throttle_lever_1_pos = thrustLeverAngle_1->get();
     autopilotLawsInput.in.data.throttle_lever_2_pos = thrustLeverAngle_2->get();
-    autopilotLawsInput.in.data.gear_strut_compression_1 = simData.gear_animation_pos_1;
-    autopilotLawsInput.in.data.gear_strut_compression_2 = simData.gear_animation_pos_2;
-    autopilotLawsInput.in.data.zeta_pos = simData.zeta_pos;
     autopilotLawsInput.in.data.flaps_handle_index = flapsHandleIndexFlapConf->get();
-    autopilotLawsInput.in.data.is_engine_operative_1 = simData.engine_combustion_1;
-    autopilotLawsInput.in.data.is_engine_operative_2 = simData.engine_combustion_2;
-    autopilotLawsInput.in.data.altimeter_setting_left_mbar = simData.kohlsmanSetting_0;
-    autopilotLawsInput.in.data.altimeter_setting_right_mbar = simData.kohlsmanSetting_1;
 
     // input ----------------------------------------------------------------------------------------------------------
     autopilotLawsInput.in.input = autopilotStateMachineOutput;
@@ -1205,7 +1412,7 @@ bool FlyByWireInterface::updateAutopilotLaws(double sampleTime) {
       simConnectInterface.setClientDataAutopilotStateMachine(clientDataStateMachine);
     }
     // read client data written by simulink
-    ClientDataAutopilotLaws clientDataLaws = simConnectInterface.getClientDataAutopilotLaws();
+    const ClientDataAutopilotLaws& clientDataLaws = context.clientDataAutopilotLaws;
     autopilotLawsOutput.ap_on = clientDataLaws.enableAutopilot;
     autopilotLawsOutput.flight_director.Theta_c_deg = clientDataLaws.flightDirectorTheta;
     autopilotLawsOutput.autopilot.Theta_c_deg = clientDataLaws.autopilotTheta;
@@ -1226,77 +1433,26 @@ bool FlyByWireInterface::updateAutopilotLaws(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
+bool FlyByWireInterface::updateFlyByWire(const FrameContext& context) {
   // get data from interface ------------------------------------------------------------------------------------------
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
+  const SimData& simData = context.simData;
+  const SimInput& simInput = context.simInput;
 
   // update fly-by-wire -----------------------------------------------------------------------------------------------
   if (flyByWireEnabled) {
     // fill time into model -------------------------------------------------------------------------------------------
-    flyByWireInput.in.time.dt = sampleTime;
-    flyByWireInput.in.time.simulation_time = simData.simulationTime;
+    flyByWireInput.in.time.dt = context.calculatedSampleTime;
+    flyByWireInput.in.time.simulation_time = context.simulationTime;
 
     // fill data into model -------------------------------------------------------------------------------------------
-    flyByWireInput.in.data.nz_g = simData.nz_g;
-    flyByWireInput.in.data.Theta_deg = simData.Theta_deg;
-    flyByWireInput.in.data.Phi_deg = simData.Phi_deg;
-    flyByWireInput.in.data.q_rad_s = simData.bodyRotationVelocity.x;
-    flyByWireInput.in.data.r_rad_s = simData.bodyRotationVelocity.y;
-    flyByWireInput.in.data.p_rad_s = simData.bodyRotationVelocity.z;
-    flyByWireInput.in.data.q_dot_rad_s2 = simData.bodyRotationAcceleration.x;
-    flyByWireInput.in.data.r_dot_rad_s2 = simData.bodyRotationAcceleration.y;
-    flyByWireInput.in.data.p_dot_rad_s2 = simData.bodyRotationAcceleration.z;
-    flyByWireInput.in.data.psi_magnetic_deg = simData.Psi_magnetic_deg;
-    flyByWireInput.in.data.psi_true_deg = simData.Psi_true_deg;
-    flyByWireInput.in.data.eta_pos = simData.eta_pos;
-    flyByWireInput.in.data.eta_trim_deg = simData.eta_trim_deg;
-    flyByWireInput.in.data.xi_pos = simData.xi_pos;
-    flyByWireInput.in.data.zeta_pos = simData.zeta_pos;
-    flyByWireInput.in.data.zeta_trim_pos = simData.zeta_trim_pos;
-    flyByWireInput.in.data.alpha_deg = simData.alpha_deg;
-    flyByWireInput.in.data.beta_deg = simData.beta_deg;
-    flyByWireInput.in.data.beta_dot_deg_s = simData.beta_dot_deg_s;
-    flyByWireInput.in.data.V_ias_kn = simData.V_ias_kn;
-    flyByWireInput.in.data.V_tas_kn = simData.V_tas_kn;
-    flyByWireInput.in.data.V_mach = simData.V_mach;
-    flyByWireInput.in.data.H_ft = simData.H_ft;
-    flyByWireInput.in.data.H_ind_ft = simData.H_ind_ft;
-    flyByWireInput.in.data.H_radio_ft = simData.H_radio_ft;
-    flyByWireInput.in.data.CG_percent_MAC = simData.CG_percent_MAC;
-    flyByWireInput.in.data.total_weight_kg = simData.total_weight_kg;
-    flyByWireInput.in.data.gear_animation_pos_0 = simData.gear_animation_pos_0;
-    flyByWireInput.in.data.gear_animation_pos_1 = simData.gear_animation_pos_1;
-    flyByWireInput.in.data.gear_animation_pos_2 = simData.gear_animation_pos_2;
+    copySimDataToFlyByWire(simData, flyByWireInput.in.data);
     flyByWireInput.in.data.flaps_handle_index = flapsHandleIndexFlapConf->get();
-    flyByWireInput.in.data.spoilers_left_pos = simData.spoilers_left_pos;
-    flyByWireInput.in.data.spoilers_right_pos = simData.spoilers_right_pos;
-    flyByWireInput.in.data.autopilot_master_on = simData.autopilot_master_on;
-    flyByWireInput.in.data.slew_on = simData.slew_on;
-    flyByWireInput.in.data.pause_on = pauseDetected;
+    flyByWireInput.in.data.pause_on = context.pauseDetected;
     flyByWireInput.in.data.autopilot_custom_on = autopilotLawsOutput.ap_on;
     flyByWireInput.in.data.autopilot_custom_Theta_c_deg = autopilotLawsOutput.autopilot.Theta_c_deg;
     flyByWireInput.in.data.autopilot_custom_Phi_c_deg = autopilotLawsOutput.autopilot.Phi_c_deg;
     flyByWireInput.in.data.autopilot_custom_Beta_c_deg = autopilotLawsOutput.autopilot.Beta_c_deg;
     flyByWireInput.in.data.tracking_mode_on_override = idExternalOverride->get() == 1;
-    flyByWireInput.in.data.simulation_rate = simData.simulation_rate;
-    flyByWireInput.in.data.ice_structure_percent = simData.ice_structure_percent;
-    flyByWireInput.in.data.linear_cl_alpha_per_deg = simData.linear_cl_alpha_per_deg;
-    flyByWireInput.in.data.alpha_stall_deg = simData.alpha_stall_deg;
-    flyByWireInput.in.data.alpha_zero_lift_deg = simData.alpha_zero_lift_deg;
-    flyByWireInput.in.data.ambient_density_kg_per_m3 = simData.ambient_density_kg_per_m3;
-    flyByWireInput.in.data.ambient_pressure_mbar = simData.ambient_pressure_mbar;
-    flyByWireInput.in.data.ambient_temperature_celsius = simData.ambient_temperature_celsius;
-    flyByWireInput.in.data.ambient_wind_x_kn = simData.ambient_wind_x_kn;
-    flyByWireInput.in.data.ambient_wind_y_kn = simData.ambient_wind_y_kn;
-    flyByWireInput.in.data.ambient_wind_z_kn = simData.ambient_wind_z_kn;
-    flyByWireInput.in.data.ambient_wind_velocity_kn = simData.ambient_wind_velocity_kn;
-    flyByWireInput.in.data.ambient_wind_direction_deg = simData.ambient_wind_direction_deg;
-    flyByWireInput.in.data.total_air_temperature_celsius = simData.total_air_temperature_celsius;
-    flyByWireInput.in.data.latitude_deg = simData.latitude_deg;
-    flyByWireInput.in.data.longitude_deg = simData.longitude_deg;
-    flyByWireInput.in.data.engine_1_thrust_lbf = simData.engine_1_thrust_lbf;
-    flyByWireInput.in.data.engine_2_thrust_lbf = simData.engine_2_thrust_lbf;
     flyByWireInput.in.data.thrust_lever_1_pos = thrustLeverAngle_1->get();
     flyByWireInput.in.data.thrust_lever_2_pos = thrustLeverAngle_2->get();
     flyByWireInput.in.data.tailstrike_protection_on = tailstrikeProtectionEnabled;
@@ -1349,7 +1505,7 @@ bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
     simConnectInterface.setClientDataAutopilotLaws(clientDataLaws);
 
     // read data
-    auto clientDataFlyByWire = simConnectInterface.getClientDataFlyByWire();
+    const ClientDataFlyByWire& clientDataFlyByWire = context.clientDataFlyByWire;
     flyByWireOutput.output.eta_pos = clientDataFlyByWire.eta_pos;
     flyByWireOutput.output.xi_pos = clientDataFlyByWire.xi_pos;
     flyByWireOutput.output.zeta_pos = clientDataFlyByWire.zeta_pos;
@@ -1357,7 +1513,7 @@ bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
     flyByWireOutput.output.eta_trim_deg = clientDataFlyByWire.eta_trim_deg;
     flyByWireOutput.output.zeta_trim_pos_should_write = clientDataFlyByWire.zeta_trim_pos_should_write;
     flyByWireOutput.output.zeta_trim_pos = clientDataFlyByWire.zeta_trim_pos;
-    flyByWireOutput.sim.data_computed.tracking_mode_on = simData.slew_on || pauseDetected || idExternalOverride->get() == 1;
+    flyByWireOutput.sim.data_computed.tracking_mode_on = simData.slew_on || context.pauseDetected || idExternalOverride->get() == 1;
     flyByWireOutput.sim.data_computed.alpha_floor_command = clientDataFlyByWire.alpha_floor_command;
     flyByWireOutput.sim.data_computed.protection_ap_disc = clientDataFlyByWire.protection_ap_disc;
     flyByWireOutput.sim.data_speeds_aoa.v_alpha_prot_kn = clientDataFlyByWire.v_alpha_prot_kn;
@@ -1373,14 +1529,14 @@ bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
   idRudderPedalPosition->set(max(-100, min(100, (-100.0 * simInput.inputs[2]))));
   idRudderPedalAnimationPosition->set(max(-100, min(100, (-100.0 * simInput.inputs[2]) + (100.0 * simData.zeta_trim_pos))));
 
-  // set outputs
-  if (!flyByWireOutput.sim.data_computed.tracking_mode_on) {
+  // set outputs (in fixed rate mode they are interpolated and written once per frame)
+  if (!fixedRateEnabled && !flyByWireOutput.sim.data_computed.tracking_mode_on) {
     // object to write with trim
     SimOutput output = {flyByWireOutput.output.eta_pos, flyByWireOutput.output.xi_pos, flyByWireOutput.output.zeta_pos};
 
     // send data via sim connect
     if (!simConnectInterface.sendData(output)) {
-      cout << "WASM: Write data failed!" << endl;
+      LOG_ERROR("WASM: Write data failed!");
       return false;
     }
   }
@@ -1402,13 +1558,13 @@ bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
   }
   if (!flyByWireOutput.sim.data_computed.tracking_mode_on) {
     if (!simConnectInterface.sendData(outputEtaTrim)) {
-      cout << "WASM: Write data failed!" << endl;
+      LOG_ERROR("WASM: Write data failed!");
       return false;
     }
   }
 
   SimOutputZetaTrim outputZetaTrim = {};
-  rudderTrimHandler->update(sampleTime);
+  rudderTrimHandler->update(context.calculatedSampleTime);
   if (flyByWireOutput.output.zeta_trim_pos_should_write) {
     outputZetaTrim.zeta_trim_pos = flyByWireOutput.output.zeta_trim_pos;
     rudderTrimHandler->synchronizeValue(outputZetaTrim.zeta_trim_pos);
@@ -1417,7 +1573,7 @@ bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
   }
   if (!flyByWireOutput.sim.data_computed.tracking_mode_on) {
     if (!simConnectInterface.sendData(outputZetaTrim)) {
-      cout << "WASM: Write data failed!" << endl;
+      LOG_ERROR("WASM: Write data failed!");
       return false;
     }
   }
@@ -1434,9 +1590,10 @@ bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
   idSpeedAlphaMax->set(flyByWireOutput.sim.data_speeds_aoa.v_alpha_max_kn);
 
   // update aileron positions
-  animationAileronHandler->update(idAutopilotActiveAny->get(), spoilersHandler->getIsGroundSpoilersActive(), simData.simulationTime,
+  animationAileronHandler->update(idAutopilotActiveAny->get(), spoilersHandler->getIsGroundSpoilersActive(), context.simulationTime,
                                   simData.Theta_deg, flapsHandleIndexFlapConf->get(), flapsPosition->get(),
-                                  idExternalOverride->get() == 1 ? simData.xi_pos : flyByWireOutput.output.xi_pos, sampleTime);
+                                  idExternalOverride->get() == 1 ? simData.xi_pos : flyByWireOutput.output.xi_pos,
+                                  context.calculatedSampleTime);
   idAileronPositionLeft->set(animationAileronHandler->getPositionLeft());
   idAileronPositionRight->set(animationAileronHandler->getPositionRight());
 
@@ -1461,18 +1618,18 @@ bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateThrustLimits(double sampleTime) {
+bool FlyByWireInterface::updateThrustLimits(const FrameContext& context) {
   // if only external limits are used we can skip processing
   if (autothrustThrustLimitUseExternal && autothrustThrustLimitUseExternalFlex) {
     return true;
   }
 
   // get sim data
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = context.simData;
 
   // fill input data
-  thrustLimitsInput.in.dt = sampleTime;
-  thrustLimitsInput.in.simulation_time_s = simData.simulationTime;
+  thrustLimitsInput.in.dt = context.calculatedSampleTime;
+  thrustLimitsInput.in.simulation_time_s = context.simulationTime;
   thrustLimitsInput.in.H_ft = simData.H_ft;
   thrustLimitsInput.in.V_mach = simData.V_mach;
   thrustLimitsInput.in.OAT_degC = simData.ambient_temperature_celsius;
@@ -1494,12 +1651,17 @@ bool FlyByWireInterface::updateThrustLimits(double sampleTime) {
   }
   thrustLimitsInput.in.thrust_limit_type = autoThrustOutput.thrust_limit_type;
 
-  // set input data
-  thrustLimits.setExternalInputs(&thrustLimitsInput);
-  thrustLimits.step();
-
-  // get results
-  auto output = thrustLimits.getExternalOutputs().out;
+  // step the generated model or the fused evaluator (bit-identical results)
+  thrust_limits_out output;
+  if (thrustLimitsFusedEnabled) {
+    thrustLimitsFused.setExternalInputs(&thrustLimitsInput);
+    thrustLimitsFused.step();
+    output = thrustLimitsFused.getExternalOutputs().out;
+  } else {
+    thrustLimits.setExternalInputs(&thrustLimitsInput);
+    thrustLimits.step();
+    output = thrustLimits.getExternalOutputs().out;
+  }
 
   // update local variables
   if (!autothrustThrustLimitUseExternal) {
@@ -1516,9 +1678,9 @@ bool FlyByWireInterface::updateThrustLimits(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateAutothrust(double sampleTime) {
+bool FlyByWireInterface::updateAutothrust(const FrameContext& context) {
   // get sim data
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = context.simData;
 
   // set ground / flight for throttle handling
   if (flyByWireOutput.sim.data_computed.on_ground) {
@@ -1530,14 +1692,14 @@ bool FlyByWireInterface::updateAutothrust(double sampleTime) {
   }
 
   // set position for 3D animation
-  idThrottlePosition3d_1->set(idThrottlePositionLookupTable3d.get(thrustLeverAngle_1->get()));
-  idThrottlePosition3d_2->set(idThrottlePositionLookupTable3d.get(thrustLeverAngle_2->get()));
+  idThrottlePosition3d_1->set(throttlePositionLookupTable3d.get(thrustLeverAngle_1->get()));
+  idThrottlePosition3d_2->set(throttlePositionLookupTable3d.get(thrustLeverAngle_2->get()));
 
   // set client data if needed
   if (!autoThrustEnabled || !autopilotStateMachineEnabled || !flyByWireEnabled) {
     ClientDataLocalVariablesAutothrust ClientDataLocalVariablesAutothrust = {
-        simConnectInterface.getSimInputThrottles().ATHR_push,
-        simConnectInterface.getSimInputThrottles().ATHR_disconnect || idAutothrustDisconnect->get() == 1,
+        context.simInputThrottles.ATHR_push,
+        context.simInputThrottles.ATHR_disconnect || idAutothrustDisconnect->get() == 1,
         thrustLeverAngle_1->get(),
         thrustLeverAngle_2->get(),
         simData.ap_V_c_kn,
@@ -1568,41 +1730,15 @@ bool FlyByWireInterface::updateAutothrust(double sampleTime) {
   }
 
   if (autoThrustEnabled) {
-    autoThrustInput.in.time.dt = sampleTime;
-    autoThrustInput.in.time.simulation_time = simData.simulationTime;
-
-    autoThrustInput.in.data.nz_g = simData.nz_g;
-    autoThrustInput.in.data.Theta_deg = simData.Theta_deg;
-    autoThrustInput.in.data.Phi_deg = simData.Phi_deg;
-    autoThrustInput.in.data.V_ias_kn = simData.V_ias_kn;
-    autoThrustInput.in.data.V_tas_kn = simData.V_tas_kn;
-    autoThrustInput.in.data.V_mach = simData.V_mach;
-    autoThrustInput.in.data.V_gnd_kn = simData.V_gnd_kn;
-    autoThrustInput.in.data.alpha_deg = simData.alpha_deg;
-    autoThrustInput.in.data.H_ft = simData.H_ft;
-    autoThrustInput.in.data.H_ind_ft = simData.H_ind_ft;
-    autoThrustInput.in.data.H_radio_ft = simData.H_radio_ft;
-    autoThrustInput.in.data.H_dot_fpm = simData.H_dot_fpm;
-    autoThrustInput.in.data.bx_m_s2 = simData.bx_m_s2;
-    autoThrustInput.in.data.by_m_s2 = simData.by_m_s2;
-    autoThrustInput.in.data.bz_m_s2 = simData.bz_m_s2;
-    autoThrustInput.in.data.gear_strut_compression_1 = simData.gear_animation_pos_1;
-    autoThrustInput.in.data.gear_strut_compression_2 = simData.gear_animation_pos_2;
+    autoThrustInput.in.time.dt = context.calculatedSampleTime;
+    autoThrustInput.in.time.simulation_time = context.simulationTime;
+
+    copySimDataToAutothrust(simData, autoThrustInput.in.data);
     autoThrustInput.in.data.flap_handle_index = flapsHandleIndexFlapConf->get();
-    autoThrustInput.in.data.is_engine_operative_1 = simData.engine_combustion_1;
-    autoThrustInput.in.data.is_engine_operative_2 = simData.engine_combustion_2;
-    autoThrustInput.in.data.commanded_engine_N1_1_percent = simData.commanded_engine_N1_1_percent;
-    autoThrustInput.in.data.commanded_engine_N1_2_percent = simData.commanded_engine_N1_2_percent;
-    autoThrustInput.in.data.engine_N1_1_percent = simData.engine_N1_1_percent;
-    autoThrustInput.in.data.engine_N1_2_percent = simData.engine_N1_2_percent;
-    autoThrustInput.in.data.corrected_engine_N1_1_percent = simData.corrected_engine_N1_1_percent;
-    autoThrustInput.in.data.corrected_engine_N1_2_percent = simData.corrected_engine_N1_2_percent;
-    autoThrustInput.in.data.TAT_degC = simData.total_air_temperature_celsius;
-    autoThrustInput.in.data.OAT_degC = simData.ambient_temperature_celsius;
-
-    autoThrustInput.in.input.ATHR_push = simConnectInterface.getSimInputThrottles().ATHR_push;
+
+    autoThrustInput.in.input.ATHR_push = context.simInputThrottles.ATHR_push;
     autoThrustInput.in.input.ATHR_disconnect =
-        simConnectInterface.getSimInputThrottles().ATHR_disconnect || idAutothrustDisconnect->get() == 1;
+        context.simInputThrottles.ATHR_disconnect || idAutothrustDisconnect->get() == 1;
     autoThrustInput.in.input.TLA_1_deg = thrustLeverAngle_1->get();
     autoThrustInput.in.input.TLA_2_deg = thrustLeverAngle_2->get();
     autoThrustInput.in.input.V_c_kn = simData.ap_V_c_kn;
@@ -1634,7 +1770,7 @@ bool FlyByWireInterface::updateAutothrust(double sampleTime) {
     autoThrustInput.in.input.is_air_conditioning_1_active = idAirConditioningPack_1->get();
     autoThrustInput.in.input.is_air_conditioning_2_active = idAirConditioningPack_2->get();
     autoThrustInput.in.input.FD_active = simData.ap_fd_1_active || simData.ap_fd_2_active;
-    autoThrustInput.in.input.ATHR_reset_disable = simConnectInterface.getSimInputThrottles().ATHR_reset_disable == 1;
+    autoThrustInput.in.input.ATHR_reset_disable = context.simInputThrottles.ATHR_reset_disable == 1;
     autoThrustInput.in.input.is_TCAS_active = getTcasAdvisoryState() > 1;
     autoThrustInput.in.input.target_TCAS_RA_rate_fpm = autopilotStateMachineOutput.H_dot_c_fpm;
 
@@ -1665,12 +1801,12 @@ bool FlyByWireInterface::updateAutothrust(double sampleTime) {
     SimOutputThrottles simOutputThrottles = {autoThrustOutput.sim_throttle_lever_1_pos, autoThrustOutput.sim_throttle_lever_2_pos,
                                              autoThrustOutput.sim_thrust_mode_1, autoThrustOutput.sim_thrust_mode_2};
     if (!simConnectInterface.sendData(simOutputThrottles)) {
-      cout << "WASM: Write data failed!" << endl;
+      LOG_ERROR("WASM: Write data failed!");
       return false;
     }
   } else {
     // read data from client data
-    ClientDataAutothrust clientData = simConnectInterface.getClientDataAutothrust();
+    const ClientDataAutothrust& clientData = context.clientDataAutothrust;
     autoThrustOutput.N1_TLA_1_percent = clientData.N1_TLA_1_percent;
     autoThrustOutput.N1_TLA_2_percent = clientData.N1_TLA_2_percent;
     autoThrustOutput.is_in_reverse_1 = clientData.is_in_reverse_1;
@@ -1721,9 +1857,9 @@ bool FlyByWireInterface::updateAutothrust(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateSpoilers(double sampleTime) {
+bool FlyByWireInterface::updateSpoilers(const FrameContext& context) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const SimData& simData = context.simData;
 
   // initialize position if needed
   if (!spoilersHandler->getIsInitialized()) {
@@ -1751,9 +1887,9 @@ bool FlyByWireInterface::updateSpoilers(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateAltimeterSetting(double sampleTime) {
+bool FlyByWireInterface::updateAltimeterSetting(const FrameContext& context) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const SimData& simData = context.simData;
 
   // determine if change is needed
   if (simData.kohlsmanSettingStd_3 == 0) {
@@ -12,14 +12,18 @@
 #include "EngineData.h"
 #include "FlightDataRecorder.h"
 #include "FlyByWire.h"
+#include "FrameContext.h"
+#include "FrameTimeProfiler.h"
 #include "InterpolatingLookupTable.h"
+#include "LoadSheddingPolicy.h"
 #include "LocalVariable.h"
-#include "RateLimiter.h"
+#include "RateScheduler.h"
 #include "RudderTrimHandler.h"
 #include "SimConnectInterface.h"
 #include "SpoilersHandler.h"
 #include "ThrottleAxisMapping.h"
 #include "ThrustLimits.h"
+#include "ThrustLimitsFused.h"
 
 class FlyByWireInterface {
  public:
@@ -37,7 +41,6 @@ class FlyByWireInterface {
   uint32_t lowPerformanceTimer = 0;
 
   double previousSimulationTime = 0;
-  double calculatedSampleTime = 0;
 
   int currentApproachCapability = 0;
   double previousApproachCapabilityUpdateTime = 0;
@@ -45,6 +48,18 @@ class FlyByWireInterface {
   bool simulationRateReductionEnabled = true;
   bool limitSimulationRateByPerformance = true;
 
+  bool simDataSubscriptionEnabled = false;
+  bool simDataSlowChangedOnly = true;
+  bool clientDataChangedOnly = true;
+  double clientDataHeartbeatPeriod = 1.0;
+
+  bool fixedRateEnabled = false;
+  double fixedRateSampleTime = 1.0 / 60.0;
+  int fixedRateMaximumSteps = 4;
+  double fixedRateAccumulator = 0.0;
+  bool fixedRateHasPreviousStep = false;
+  SimOutput previousSurfaceOutput = {};
+
   double targetSimulationRate = 1;
   bool targetSimulationRateModified = false;
 
@@ -55,10 +70,12 @@ class FlyByWireInterface {
   bool flyByWireEnabled = false;
   bool autoThrustEnabled = false;
   bool tailstrikeProtectionEnabled = true;
+  bool thrustLimitsFusedEnabled = false;
+  bool autopilotStateMachineIncrementalEnabled = false;
+  bool autopilotLawsGeodesyApproximationEnabled = false;
 
   bool wasTcasEngaged = false;
 
-  bool pauseDetected = false;
   bool wasInSlew = false;
 
   double autothrustThrustLimitReverse = -45;
@@ -87,6 +104,12 @@ class FlyByWireInterface {
 
   FlightDataRecorder flightDataRecorder;
 
+  FrameTimeProfiler frameTimeProfiler;
+
+  RateScheduler rateScheduler;
+
+  LoadSheddingPolicy loadSheddingPolicy;
+
   SimConnectInterface simConnectInterface;
 
   FlyByWireModelClass flyByWire;
@@ -107,6 +130,7 @@ class FlyByWireInterface {
 
   ThrustLimitsModelClass thrustLimits;
   ThrustLimitsModelClass::ExternalInputs_ThrustLimits_T thrustLimitsInput = {};
+  ThrustLimitsFused thrustLimitsFused;
 
   InterpolatingLookupTable throttleLookupTable;
 
@@ -242,7 +266,6 @@ class FlyByWireInterface {
   std::unique_ptr<LocalVariable> idAutothrustDisconnect;
   std::unique_ptr<LocalVariable> idThrottlePosition3d_1;
   std::unique_ptr<LocalVariable> idThrottlePosition3d_2;
-  InterpolatingLookupTable idThrottlePositionLookupTable3d;
 
   std::vector<std::shared_ptr<ThrottleAxisMapping>> throttleAxis;
 
@@ -320,21 +343,29 @@ class FlyByWireInterface {
 
   bool readDataAndLocalVariables(double sampleTime);
 
-  bool updatePerformanceMonitoring(double sampleTime);
-  bool handleSimulationRate(double sampleTime);
+  FrameContext createFrameContext(double sampleTime);
+
+  bool updatePerformanceMonitoring(const FrameContext& context);
+  bool handleSimulationRate(const FrameContext& context);
+  bool updateLoadShedding();
+
+  bool updateModels(const FrameContext& context);
+  bool updateModelsFixedRate(const FrameContext& context);
+  void updateFlightDataRecorder();
 
-  bool updateEngineData(double sampleTime);
-  bool updateAdditionalData(double sampleTime);
+  bool updateEngineData(const FrameContext& context);
+  bool updateAdditionalData(const FrameContext& context);
 
-  bool updateAutopilotStateMachine(double sampleTime);
-  bool updateAutopilotLaws(double sampleTime);
-  bool updateFlyByWire(double sampleTime);
-  bool updateThrustLimits(double sampleTime);
-  bool updateAutothrust(double sampleTime);
+  bool updateAutopilotStateMachine(const FrameContext& context);
+  bool updateApproachCapability(const FrameContext& context);
+  bool updateAutopilotLaws(const FrameContext& context);
+  bool updateFlyByWire(const FrameContext& context);
+  bool updateThrustLimits(const FrameContext& context);
+  bool updateAutothrust(const FrameContext& context);
 
-  bool updateSpoilers(double sampleTime);
+  bool updateSpoilers(const FrameContext& context);
 
-  bool updateAltimeterSetting(double sampleTime);
+  bool updateAltimeterSetting(const FrameContext& context);
 
   double getHeadingAngleError(double u1, double u2);
 
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+#include "SimConnectData.h"
+
+// Immutable view on the data of one frame. It is created once after the sim data has been read and passed by
+// reference to all update stages, so that the large SimConnect structs are no longer copied per stage.
+// The references point into the buffers of SimConnectInterface which are only changed by readData().
+struct FrameContext {
+  const SimData& simData;
+  const SimInput& simInput;
+  const SimInputAutopilot& simInputAutopilot;
+  const SimInputThrottles& simInputThrottles;
+  const ClientDataAutopilotStateMachine& clientDataAutopilotStateMachine;
+  const ClientDataAutopilotLaws& clientDataAutopilotLaws;
+  const ClientDataAutothrust& clientDataAutothrust;
+  const ClientDataFlyByWire& clientDataFlyByWire;
+
+  // sample time as given by the gauge callback
+  double sampleTime;
+  // sample time calculated from the simulation time (includes simulation rate)
+  double calculatedSampleTime;
+  // simulation time of the model step (differs from the sim data when the models run at a fixed rate)
+  double simulationTime;
+  bool pauseDetected;
+  // frames since the sim data and its slow moving part were received (0 = current frame)
+  uint32_t simDataAge;
+  uint32_t simDataSlowAge;
+};
@@ -0,0 +1,328 @@
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+#include "AllocationCounter.h"
+#include "FrameTimeProfiler.h"
+#include "Logger.h"
+
+using namespace std;
+
+// Collects the items of the profiling line and emits them through the logger, the line is split into several messages
+// when it exceeds the maximum message length of the logger.
+class ProfilingLogLine {
+ public:
+  ProfilingLogLine() { clear(); }
+
+  __attribute__((format(printf, 2, 3))) void append(const char* format, ...) {
+    char item[MAXIMUM_LENGTH];
+    va_list arguments;
+    va_start(arguments, format);
+    int itemLength = vsnprintf(item, sizeof(item), format, arguments);
+    va_end(arguments);
+    if (itemLength < 0) {
+      return;
+    }
+    size_t length = min(static_cast<size_t>(itemLength), sizeof(item) - 1);
+    if (lineLength + length >= MAXIMUM_LENGTH) {
+      flush();
+    }
+    memcpy(line + lineLength, item, length);
+    lineLength += length;
+    line[lineLength] = '\0';
+  }
+
+  void flush() {
+    if (lineLength > PREFIX_LENGTH) {
+      LOG_INFO("%s", line);
+    }
+    clear();
+  }
+
+ private:
+  static constexpr const char* PREFIX = "WASM: PROFILING :";
+  static constexpr size_t PREFIX_LENGTH = 17;
+  static constexpr size_t MAXIMUM_LENGTH = Logger::MAXIMUM_MESSAGE_LENGTH - 2;
+
+  char line[MAXIMUM_LENGTH] = {};
+  size_t lineLength = 0;
+
+  void clear() {
+    memcpy(line, PREFIX, PREFIX_LENGTH);
+    lineLength = PREFIX_LENGTH;
+    line[lineLength] = '\0';
+  }
+};
+
+const char* FrameTimeProfiler::STAGE_NAMES[NUMBER_OF_STAGES] = {
+    "READ_DATA", "AUTOPILOT_STATE_MACHINE", "AUTOPILOT_LAWS", "FLY_BY_WIRE", "THRUST_LIMITS",
+    "AUTOTHRUST", "SPOILERS", "FLIGHT_DATA_RECORDER", "FRAME",
+};
+
+void FrameTimeProfiler::initialize(bool isEnabled, bool isRecordingEnabled, int windowSize, double logInterval) {
+  this->isEnabled = isEnabled;
+  this->isRecordingEnabled = isEnabled && isRecordingEnabled;
+  this->windowSize = max(1, windowSize);
+  this->logInterval = logInterval;
+
+  if (!isEnabled) {
+    return;
+  }
+
+  // register L variables for percentiles in milliseconds
+  for (int i = 0; i < NUMBER_OF_STAGES; i++) {
+    idPercentile50[i] = make_unique<LocalVariable>(string("A32NX_PERFORMANCE_") + STAGE_NAMES[i] + "_P50");
+    idPercentile99[i] = make_unique<LocalVariable>(string("A32NX_PERFORMANCE_") + STAGE_NAMES[i] + "_P99");
+  }
+  idNativeCalls = make_unique<LocalVariable>("A32NX_PERFORMANCE_LVAR_CALLS");
+  idEvents = make_unique<LocalVariable>("A32NX_PERFORMANCE_EVENTS");
+  idCoalescedEvents = make_unique<LocalVariable>("A32NX_PERFORMANCE_EVENTS_COALESCED");
+  idScheduledTasksExecuted = make_unique<LocalVariable>("A32NX_PERFORMANCE_SCHEDULED_TASKS_EXECUTED");
+  idScheduledTasksSkipped = make_unique<LocalVariable>("A32NX_PERFORMANCE_SCHEDULED_TASKS_SKIPPED");
+  idAllocations = make_unique<LocalVariable>("A32NX_PERFORMANCE_ALLOCATIONS");
+  idClientDataBytesSent = make_unique<LocalVariable>("A32NX_PERFORMANCE_CLIENT_DATA_BYTES_SENT");
+  idClientDataBytesSuppressed = make_unique<LocalVariable>("A32NX_PERFORMANCE_CLIENT_DATA_BYTES_SUPPRESSED");
+}
+
+bool FrameTimeProfiler::getIsEnabled() const {
+  return isEnabled;
+}
+
+void FrameTimeProfiler::beginFrame() {
+  if (!isEnabled) {
+    return;
+  }
+
+  // stages which are skipped in this frame (e.g. pause) report zero
+  for (double& value : duration) {
+    value = 0;
+  }
+  for (uint32_t& value : allocations) {
+    value = 0;
+  }
+  for (uint32_t& value : executions) {
+    value = 0;
+  }
+  eventsInFrame = 0;
+  coalescedEventsInFrame = 0;
+  executedTasksInFrame = 0;
+  skippedTasksInFrame = 0;
+  clientDataBytesSentInFrame = 0;
+  clientDataBytesSuppressedInFrame = 0;
+
+  begin(FRAME);
+}
+
+void FrameTimeProfiler::endFrame(double sampleTime) {
+  if (!isEnabled) {
+    return;
+  }
+
+  end(FRAME);
+
+  // add one sample per executed stage to the histogram, a stage that ran several times counts with its total duration
+  for (int i = 0; i < NUMBER_OF_STAGES; i++) {
+    if (executions[i] > 0) {
+      currentWindow[i].bins[getBinIndex(duration[i])]++;
+      currentWindow[i].count++;
+    }
+  }
+
+  // store data for flight data recorder
+  if (isRecordingEnabled) {
+    performanceData.read_data_us = duration[READ_DATA];
+    performanceData.autopilot_state_machine_us = duration[AUTOPILOT_STATE_MACHINE];
+    performanceData.autopilot_laws_us = duration[AUTOPILOT_LAWS];
+    performanceData.fly_by_wire_us = duration[FLY_BY_WIRE];
+    performanceData.thrust_limits_us = duration[THRUST_LIMITS];
+    performanceData.autothrust_us = duration[AUTOTHRUST];
+    performanceData.spoilers_us = duration[SPOILERS];
+    performanceData.flight_data_recorder_us = duration[FLIGHT_DATA_RECORDER];
+    performanceData.frame_us = duration[FRAME];
+  }
+
+  // count native calls of local variables
+  uint32_t nativeCalls = LocalVariable::getNumberOfNativeCallsInFrame();
+  nativeCallsInWindow += nativeCalls;
+  nativeCallsSinceLastLog += nativeCalls;
+  nativeCallsMaximumSinceLastLog = max(nativeCallsMaximumSinceLastLog, nativeCalls);
+  framesSinceLastLog++;
+
+  // count SimConnect events
+  eventsInWindow += eventsInFrame;
+  coalescedEventsInWindow += coalescedEventsInFrame;
+  eventsSinceLastLog += eventsInFrame;
+  coalescedEventsSinceLastLog += coalescedEventsInFrame;
+
+  // count heap allocations
+  allocationsInWindow += allocations[FRAME];
+  for (int i = 0; i < NUMBER_OF_STAGES; i++) {
+    allocationsSinceLastLog[i] += allocations[i];
+  }
+
+  // count scheduled tasks
+  executedTasksInWindow += executedTasksInFrame;
+  skippedTasksInWindow += skippedTasksInFrame;
+  executedTasksSinceLastLog += executedTasksInFrame;
+  skippedTasksSinceLastLog += skippedTasksInFrame;
+
+  // count client data bytes
+  clientDataBytesSentInWindow += clientDataBytesSentInFrame;
+  clientDataBytesSuppressedInWindow += clientDataBytesSuppressedInFrame;
+  clientDataBytesSentSinceLastLog += clientDataBytesSentInFrame;
+  clientDataBytesSuppressedSinceLastLog += clientDataBytesSuppressedInFrame;
+
+  // rotate window when full and publish percentiles
+  if (++frameCounter >= windowSize) {
+    frameCounter = 0;
+    for (int i = 0; i < NUMBER_OF_STAGES; i++) {
+      previousWindow[i] = currentWindow[i];
+      currentWindow[i] = {};
+    }
+    publishPercentiles();
+    idNativeCalls->set(static_cast<double>(nativeCallsInWindow) / windowSize);
+    nativeCallsInWindow = 0;
+    idEvents->set(static_cast<double>(eventsInWindow) / windowSize);
+    idCoalescedEvents->set(static_cast<double>(coalescedEventsInWindow) / windowSize);
+    eventsInWindow = 0;
+    coalescedEventsInWindow = 0;
+    idScheduledTasksExecuted->set(static_cast<double>(executedTasksInWindow) / windowSize);
+    idScheduledTasksSkipped->set(static_cast<double>(skippedTasksInWindow) / windowSize);
+    executedTasksInWindow = 0;
+    skippedTasksInWindow = 0;
+    idAllocations->set(static_cast<double>(allocationsInWindow) / windowSize);
+    allocationsInWindow = 0;
+    idClientDataBytesSent->set(static_cast<double>(clientDataBytesSentInWindow) / windowSize);
+    idClientDataBytesSuppressed->set(static_cast<double>(clientDataBytesSuppressedInWindow) / windowSize);
+    clientDataBytesSentInWindow = 0;
+    clientDataBytesSuppressedInWindow = 0;
+  }
+
+  // periodic log line
+  if (logInterval > 0) {
+    timeSinceLastLog += sampleTime;
+    if (timeSinceLastLog >= logInterval) {
+      timeSinceLastLog = 0;
+      logPercentiles();
+      nativeCallsSinceLastLog = 0;
+      nativeCallsMaximumSinceLastLog = 0;
+      eventsSinceLastLog = 0;
+      coalescedEventsSinceLastLog = 0;
+      executedTasksSinceLastLog = 0;
+      skippedTasksSinceLastLog = 0;
+      clientDataBytesSentSinceLastLog = 0;
+      clientDataBytesSuppressedSinceLastLog = 0;
+      for (uint64_t& value : allocationsSinceLastLog) {
+        value = 0;
+      }
+      framesSinceLastLog = 0;
+    }
+  }
+}
+
+void FrameTimeProfiler::begin(Stage stage) {
+  if (!isEnabled) {
+    return;
+  }
+
+  startAllocations[stage] = AllocationCounter::getNumberOfAllocations();
+  startTime[stage] = chrono::steady_clock::now();
+}
+
+void FrameTimeProfiler::end(Stage stage) {
+  if (!isEnabled) {
+    return;
+  }
+
+  // accumulate duration in microseconds (a stage can run multiple times per frame, e.g. in fixed rate mode)
+  duration[stage] += chrono::duration<double, micro>(chrono::steady_clock::now() - startTime[stage]).count();
+  executions[stage]++;
+
+  // count heap allocations of stage
+  allocations[stage] += static_cast<uint32_t>(AllocationCounter::getNumberOfAllocations() - startAllocations[stage]);
+}
+
+double FrameTimeProfiler::getPercentile(Stage stage, double percentile) const {
+  // number of samples in rolling window
+  uint32_t count = currentWindow[stage].count + previousWindow[stage].count;
+  if (count == 0) {
+    return 0;
+  }
+
+  // find first bin where cumulated count reaches the requested rank
+  double rank = ceil(percentile / 100.0 * count);
+  uint32_t cumulatedCount = 0;
+  for (int i = 0; i < NUMBER_OF_BINS; i++) {
+    cumulatedCount += currentWindow[stage].bins[i] + previousWindow[stage].bins[i];
+    if (cumulatedCount >= rank) {
+      return getBinUpperLimit(i);
+    }
+  }
+
+  return getBinUpperLimit(NUMBER_OF_BINS - 1);
+}
+
+uint32_t FrameTimeProfiler::getNumberOfAllocations(Stage stage) const {
+  return allocations[stage];
+}
+
+void FrameTimeProfiler::setEventCounts(uint32_t events, uint32_t coalescedEvents) {
+  eventsInFrame = events;
+  coalescedEventsInFrame = coalescedEvents;
+}
+
+void FrameTimeProfiler::setScheduledTaskCounts(uint32_t executedTasks, uint32_t skippedTasks) {
+  executedTasksInFrame = executedTasks;
+  skippedTasksInFrame = skippedTasks;
+}
+
+void FrameTimeProfiler::setClientDataCounts(uint32_t bytesSent, uint32_t bytesSuppressed) {
+  clientDataBytesSentInFrame = bytesSent;
+  clientDataBytesSuppressedInFrame = bytesSuppressed;
+}
+
+const PerformanceData& FrameTimeProfiler::getPerformanceData() const {
+  return performanceData;
+}
+
+void FrameTimeProfiler::publishPercentiles() {
+  for (int i = 0; i < NUMBER_OF_STAGES; i++) {
+    idPercentile50[i]->set(getPercentile(static_cast<Stage>(i), 50) / 1000.0);
+    idPercentile99[i]->set(getPercentile(static_cast<Stage>(i), 99) / 1000.0);
+  }
+}
+
+void FrameTimeProfiler::logPercentiles() {
+  const double frames = static_cast<double>(max(1u, framesSinceLastLog));
+  ProfilingLogLine line;
+  line.append(" p50/p99 [ms]");
+  for (int i = 0; i < NUMBER_OF_STAGES; i++) {
+    line.append(" %s=%.3f/%.3f", STAGE_NAMES[i], getPercentile(static_cast<Stage>(i), 50) / 1000.0,
+                getPercentile(static_cast<Stage>(i), 99) / 1000.0);
+  }
+  line.append(" LVAR_CALLS_AVG/MAX=%.3f/%u", nativeCallsSinceLastLog / frames, nativeCallsMaximumSinceLastLog);
+  line.append(" EVENTS/COALESCED_AVG=%.3f/%.3f", eventsSinceLastLog / frames, coalescedEventsSinceLastLog / frames);
+  line.append(" TASKS_EXECUTED/SKIPPED_AVG=%.3f/%.3f", executedTasksSinceLastLog / frames, skippedTasksSinceLastLog / frames);
+  line.append(" CLIENT_DATA_SENT/SUPPRESSED_AVG=%.3f/%.3f", clientDataBytesSentSinceLastLog / frames,
+              clientDataBytesSuppressedSinceLastLog / frames);
+  line.append(" ALLOCATIONS_AVG=%.3f", allocationsSinceLastLog[FRAME] / frames);
+  for (int i = 0; i < FRAME; i++) {
+    if (allocationsSinceLastLog[i] > 0) {
+      line.append(" ALLOCATIONS_%s=%llu", STAGE_NAMES[i], static_cast<unsigned long long>(allocationsSinceLastLog[i]));
+    }
+  }
+  line.flush();
+}
+
+int FrameTimeProfiler::getBinIndex(double durationInMicroseconds) {
+  if (durationInMicroseconds < 1.0) {
+    return 0;
+  }
+  int index = 1 + static_cast<int>(floor(BINS_PER_OCTAVE * log2(durationInMicroseconds)));
+  return min(index, NUMBER_OF_BINS - 1);
+}
+
+double FrameTimeProfiler::getBinUpperLimit(int binIndex) {
+  return pow(2.0, static_cast<double>(binIndex) / BINS_PER_OCTAVE);
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "LocalVariable.h"
+#include "PerformanceData.h"
+
+class FrameTimeProfiler {
+ public:
+  enum Stage {
+    READ_DATA,
+    AUTOPILOT_STATE_MACHINE,
+    AUTOPILOT_LAWS,
+    FLY_BY_WIRE,
+    THRUST_LIMITS,
+    AUTOTHRUST,
+    SPOILERS,
+    FLIGHT_DATA_RECORDER,
+    FRAME,
+    NUMBER_OF_STAGES
+  };
+
+  void initialize(bool isEnabled, bool isRecordingEnabled, int windowSize, double logInterval);
+
+  bool getIsEnabled() const;
+
+  void beginFrame();
+  void endFrame(double sampleTime);
+
+  void begin(Stage stage);
+  void end(Stage stage);
+
+  double getPercentile(Stage stage, double percentile) const;
+
+  // number of heap allocations of a stage in the last frame
+  uint32_t getNumberOfAllocations(Stage stage) const;
+
+  // number of SimConnect events received in this frame and how many of them were coalesced
+  void setEventCounts(uint32_t events, uint32_t coalescedEvents);
+
+  // number of scheduled tasks executed and skipped by the rate scheduler in this frame
+  void setScheduledTaskCounts(uint32_t executedTasks, uint32_t skippedTasks);
+
+  // number of client data bytes written and suppressed (unchanged) in this frame
+  void setClientDataCounts(uint32_t bytesSent, uint32_t bytesSuppressed);
+
+  // total duration of each stage of the last completed frame in microseconds (all zero when recording is disabled)
+  const PerformanceData& getPerformanceData() const;
+
+ private:
+  // logarithmic bins with four bins per octave starting at 1 us, the last bin collects everything above ~46 ms
+  static constexpr int NUMBER_OF_BINS = 64;
+  static constexpr int BINS_PER_OCTAVE = 4;
+
+  static const char* STAGE_NAMES[NUMBER_OF_STAGES];
+
+  struct Histogram {
+    uint32_t bins[NUMBER_OF_BINS];
+    uint32_t count;
+  };
+
+  bool isEnabled = false;
+  bool isRecordingEnabled = false;
+  int windowSize = 0;
+  double logInterval = 0;
+
+  int frameCounter = 0;
+  double timeSinceLastLog = 0;
+
+  // native calls of local variables per frame
+  uint64_t nativeCallsInWindow = 0;
+  uint64_t nativeCallsSinceLastLog = 0;
+  uint32_t nativeCallsMaximumSinceLastLog = 0;
+  uint32_t framesSinceLastLog = 0;
+
+  // SimConnect events per frame
+  uint32_t eventsInFrame = 0;
+  uint32_t coalescedEventsInFrame = 0;
+  uint64_t eventsInWindow = 0;
+  uint64_t coalescedEventsInWindow = 0;
+  uint64_t eventsSinceLastLog = 0;
+  uint64_t coalescedEventsSinceLastLog = 0;
+
+  // scheduled tasks per frame
+  uint32_t executedTasksInFrame = 0;
+  uint32_t skippedTasksInFrame = 0;
+  uint64_t executedTasksInWindow = 0;
+  uint64_t skippedTasksInWindow = 0;
+  uint64_t executedTasksSinceLastLog = 0;
+  uint64_t skippedTasksSinceLastLog = 0;
+
+  // client data bytes per frame
+  uint32_t clientDataBytesSentInFrame = 0;
+  uint32_t clientDataBytesSuppressedInFrame = 0;
+  uint64_t clientDataBytesSentInWindow = 0;
+  uint64_t clientDataBytesSuppressedInWindow = 0;
+  uint64_t clientDataBytesSentSinceLastLog = 0;
+  uint64_t clientDataBytesSuppressedSinceLastLog = 0;
+
+  // percentiles are calculated over the current and the previous window -> rolling histogram
+  Histogram currentWindow[NUMBER_OF_STAGES] = {};
+  Histogram previousWindow[NUMBER_OF_STAGES] = {};
+
+  // duration and number of executions per stage in the current frame
+  std::chrono::steady_clock::time_point startTime[NUMBER_OF_STAGES];
+  double duration[NUMBER_OF_STAGES] = {};
+  uint32_t executions[NUMBER_OF_STAGES] = {};
+
+  // heap allocations per stage (a stage can run multiple times per frame)
+  uint64_t startAllocations[NUMBER_OF_STAGES] = {};
+  uint32_t allocations[NUMBER_OF_STAGES] = {};
+  uint64_t allocationsInWindow = 0;
+  uint64_t allocationsSinceLastLog[NUMBER_OF_STAGES] = {};
+
+  PerformanceData performanceData = {};
+
+  std::unique_ptr<LocalVariable> idPercentile50[NUMBER_OF_STAGES];
+  std::unique_ptr<LocalVariable> idPercentile99[NUMBER_OF_STAGES];
+  std::unique_ptr<LocalVariable> idNativeCalls;
+  std::unique_ptr<LocalVariable> idEvents;
+  std::unique_ptr<LocalVariable> idCoalescedEvents;
+  std::unique_ptr<LocalVariable> idScheduledTasksExecuted;
+  std::unique_ptr<LocalVariable> idScheduledTasksSkipped;
+  std::unique_ptr<LocalVariable> idClientDataBytesSent;
+  std::unique_ptr<LocalVariable> idClientDataBytesSuppressed;
+  std::unique_ptr<LocalVariable> idAllocations;
+
+  void publishPercentiles();
+  void logPercentiles();
+
+  static int getBinIndex(double durationInMicroseconds);
+  static double getBinUpperLimit(int binIndex);
+};
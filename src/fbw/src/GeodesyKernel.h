@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// Great-circle kernels of the radio navigation geometry of the generated autopilot laws (haversine distance, initial
+// bearing and elevation angle). The trigonometric terms of a position are cached in a point and only computed again
+// when the position changes, so the terms of a tuned station are computed once and the terms of the aircraft once per
+// frame for all stations. The exact kernels use the operations of the generated model in the same order, the results
+// are bit-identical (see geodesy-check).
+//
+// The approximate kernels replace the remaining sin, cos, atan2 and asin calls by truncated series within the ranges
+// below and fall back to the library functions outside of them. Within the ranges the truncation error is below 3e-15
+// for sin, cos and asin and below 7e-11 rad for atan2, i.e. below 1e-6 m in distance and 1e-8 deg in bearing.
+
+struct GeodesyPoint {
+  double lat = 0.0;
+  double lon = 0.0;
+  double phi = 0.0;
+  double lambda = 0.0;
+  double sinPhi = 0.0;
+  double cosPhi = 1.0;
+  bool isInitialized = false;
+};
+
+class GeodesyKernel {
+ public:
+  static constexpr double DEG_TO_RAD = 0.017453292519943295;
+  static constexpr double RAD_TO_DEG = 57.295779513082323;
+  static constexpr double EARTH_RADIUS_M = 6.371E+6;
+
+  // largest argument of the sin, cos and asin series
+  static constexpr double SERIES_LIMIT = 0.1;
+
+  void setApproximation(bool enabled) { isApproximation = enabled; }
+
+  bool getApproximation() const { return isApproximation; }
+
+  // returns true when the terms of the point were computed again
+  static bool update(double lat, double lon, GeodesyPoint& point) {
+    if (point.isInitialized && isSame(lat, point.lat) && isSame(lon, point.lon)) {
+      return false;
+    }
+    point.lat = lat;
+    point.lon = lon;
+    point.phi = DEG_TO_RAD * lat;
+    point.lambda = DEG_TO_RAD * lon;
+    point.sinPhi = std::sin(point.phi);
+    point.cosPhi = std::cos(point.phi);
+    point.isInitialized = true;
+    return true;
+  }
+
+  // ground distance in m
+  double distance(const GeodesyPoint& from, const GeodesyPoint& to) const {
+    const double dPhi = (to.lat - from.lat) * DEG_TO_RAD / 2.0;
+    const double dLambda = (to.lon - from.lon) * DEG_TO_RAD / 2.0;
+    if (!isApproximation) {
+      const double sinDPhi = std::sin(dPhi);
+      const double sinDLambda = std::sin(dLambda);
+      const double a = from.cosPhi * to.cosPhi * sinDLambda * sinDLambda + sinDPhi * sinDPhi;
+      return std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * EARTH_RADIUS_M;
+    }
+    const double sinDPhi = sinApproximation(dPhi);
+    const double sinDLambda = sinApproximation(dLambda);
+    const double a = from.cosPhi * to.cosPhi * sinDLambda * sinDLambda + sinDPhi * sinDPhi;
+    const double sqrtA = std::sqrt(a);
+    if (sqrtA <= SERIES_LIMIT) {
+      // atan2(sqrt(a), sqrt(1 - a)) = asin(sqrt(a)) for 0 <= a <= 1
+      return asinSeries(sqrtA) * 2.0 * EARTH_RADIUS_M;
+    }
+    return std::atan2(sqrtA, std::sqrt(1.0 - a)) * 2.0 * EARTH_RADIUS_M;
+  }
+
+  // initial bearing in deg (-180 to 180)
+  double bearing(const GeodesyPoint& from, const GeodesyPoint& to) const {
+    const double L = to.lambda - from.lambda;
+    if (!isApproximation) {
+      return std::atan2(std::sin(L) * to.cosPhi, from.cosPhi * to.sinPhi - from.sinPhi * to.cosPhi * std::cos(L)) * RAD_TO_DEG;
+    }
+    return atan2Approximation(sinApproximation(L) * to.cosPhi,
+                              from.cosPhi * to.sinPhi - from.sinPhi * to.cosPhi * cosApproximation(L)) *
+           RAD_TO_DEG;
+  }
+
+  // elevation angle in deg of a height above a slant distance
+  double elevation(double height, double distance) const {
+    const double x = height / distance;
+    if (!isApproximation || !(std::abs(x) <= SERIES_LIMIT)) {
+      return std::asin(x) * RAD_TO_DEG;
+    }
+    return asinSeries(x) * RAD_TO_DEG;
+  }
+
+  static double sinApproximation(double x) {
+    if (!(std::abs(x) <= SERIES_LIMIT)) {
+      return std::sin(x);
+    }
+    const double x2 = x * x;
+    return x + x * x2 * (-1.0 / 6.0 + x2 * (1.0 / 120.0 + x2 * (-1.0 / 5040.0)));
+  }
+
+  static double cosApproximation(double x) {
+    if (!(std::abs(x) <= SERIES_LIMIT)) {
+      return std::cos(x);
+    }
+    const double x2 = x * x;
+    return 1.0 + x2 * (-1.0 / 2.0 + x2 * (1.0 / 24.0 + x2 * (-1.0 / 720.0 + x2 * (1.0 / 40320.0))));
+  }
+
+  static double atan2Approximation(double y, double x) {
+    const double ax = std::abs(x);
+    const double ay = std::abs(y);
+    if (!(ax > 0.0 || ay > 0.0) || !std::isfinite(ax) || !std::isfinite(ay)) {
+      return std::atan2(y, x);
+    }
+    // reduction to an argument in [0, 1] and then to [-tan(pi/8), tan(pi/8)]
+    const bool isSwapped = ay > ax;
+    const double t = isSwapped ? ax / ay : ay / ax;
+    double r = t > TAN_PI_8 ? PI_4 + atanSeries((t - 1.0) / (t + 1.0)) : atanSeries(t);
+    if (isSwapped) {
+      r = PI_2 - r;
+    }
+    if (x < 0.0) {
+      r = PI - r;
+    }
+    return std::copysign(r, y);
+  }
+
+ private:
+  static constexpr double PI = 3.1415926535897931;
+  static constexpr double PI_2 = 1.5707963267948966;
+  static constexpr double PI_4 = 0.78539816339744828;
+  static constexpr double TAN_PI_8 = 0.41421356237309503;
+
+  bool isApproximation = false;
+
+  // bit patterns are compared, a signed zero gives a different sine
+  static bool isSame(double a, double b) {
+    uint64_t bitsA;
+    uint64_t bitsB;
+    std::memcpy(&bitsA, &a, sizeof(bitsA));
+    std::memcpy(&bitsB, &b, sizeof(bitsB));
+    return bitsA == bitsB;
+  }
+
+  // arctangent series up to u^21 for |u| <= tan(pi/8), the error is below u^23 / 23
+  static double atanSeries(double u) {
+    const double u2 = u * u;
+    double p = -1.0 / 21.0;
+    p = 1.0 / 19.0 + u2 * p;
+    p = -1.0 / 17.0 + u2 * p;
+    p = 1.0 / 15.0 + u2 * p;
+    p = -1.0 / 13.0 + u2 * p;
+    p = 1.0 / 11.0 + u2 * p;
+    p = -1.0 / 9.0 + u2 * p;
+    p = 1.0 / 7.0 + u2 * p;
+    p = -1.0 / 5.0 + u2 * p;
+    p = 1.0 / 3.0 + u2 * p;
+    return u - u * u2 * p;
+  }
+
+  // arcsine series up to x^11 for |x| <= SERIES_LIMIT
+  static double asinSeries(double x) {
+    const double x2 = x * x;
+    return x + x * x2 * (1.0 / 6.0 + x2 * (3.0 / 40.0 + x2 * (5.0 / 112.0 + x2 * (35.0 / 1152.0 + x2 * (63.0 / 2816.0)))));
+  }
+};
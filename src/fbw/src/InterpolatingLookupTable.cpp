@@ -1,44 +1,70 @@
+#include <algorithm>
+
 #include "InterpolatingLookupTable.h"
 
 using namespace std;
 
 void InterpolatingLookupTable::initialize(vector<pair<double, double>> mapping, double minimum, double maximum) {
-  mappingTable = std::move(mapping);
+  stable_sort(mapping.begin(), mapping.end(), [](const pair<double, double>& a, const pair<double, double>& b) {
+    return a.first < b.first;
+  });
+
+  mappingX.resize(mapping.size());
+  mappingY.resize(mapping.size());
+  mappingSlope.assign(mapping.size(), 0.0);
+  for (size_t i = 0; i < mapping.size(); i++) {
+    mappingX[i] = mapping[i].first;
+    mappingY[i] = mapping[i].second;
+  }
+
+  // slope of every segment, segments without width are never selected
+  for (size_t i = 0; i + 1 < mapping.size(); i++) {
+    if (mappingX[i + 1] > mappingX[i]) {
+      mappingSlope[i] = (mappingY[i + 1] - mappingY[i]) / (mappingX[i + 1] - mappingX[i]);
+    }
+  }
+
   mappingMinimum = minimum;
   mappingMaximum = maximum;
 }
 
-double InterpolatingLookupTable::get(double value) {
-  if (mappingTable.empty()) {
+double InterpolatingLookupTable::get(double value) const {
+  if (mappingX.empty()) {
     // not initialized yet
     return 0;
   }
 
-  // iterate over values and do interpolation
-  for (std::size_t i = 0; i < mappingTable.size() - 1; ++i) {
-    if (mappingTable[i].first <= value && mappingTable[i + 1].first >= value) {
-      // calculate differences
-      double diff_x = value - mappingTable[i].first;
-      double diff_n = mappingTable[i + 1].first - mappingTable[i].first;
-
-      // interpolation
-      double result = mappingTable[i].first;
-      if (diff_n != 0) {
-        result = mappingTable[i].second + (mappingTable[i + 1].second - mappingTable[i].second) * diff_x / diff_n;
+  // outside of the table the value of the first or last point is used
+  double result;
+  const size_t lastIndex = mappingX.size() - 1;
+  if (!(value > mappingX[0])) {
+    result = mappingY[0];
+  } else if (value >= mappingX[lastIndex]) {
+    result = mappingY[lastIndex];
+  } else {
+    // bisection for the last point with x <= value
+    size_t left = 0;
+    size_t right = lastIndex;
+    while (right - left > 1) {
+      size_t middle = (left + right) >> 1;
+      if (value < mappingX[middle]) {
+        right = middle;
+      } else {
+        left = middle;
       }
+    }
 
-      // clip the result to minimum and maximum
-      if (result < mappingMinimum) {
-        return mappingMinimum;
-      } else if (result > mappingMaximum) {
-        return mappingMaximum;
-      }
+    // interpolation
+    result = mappingY[left] + mappingSlope[left] * (value - mappingX[left]);
+  }
 
-      // no clipping needed -> return result
-      return result;
-    }
+  // clip the result to minimum and maximum
+  if (result < mappingMinimum) {
+    return mappingMinimum;
+  } else if (result > mappingMaximum) {
+    return mappingMaximum;
   }
 
-  // not in range
-  return 0;
+  // no clipping needed -> return result
+  return result;
 }
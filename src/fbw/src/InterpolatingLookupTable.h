@@ -1,18 +1,82 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+// Piecewise linear mapping. The segment of a value is found by bisection and every segment holds its precomputed slope,
+// a lookup needs no division. Values below the first or above the last point take the value of that point (NaN takes
+// the first one), points with equal x define a step and the value at the step is the one of the right side. The result
+// is clipped to minimum and maximum.
 class InterpolatingLookupTable {
  public:
   InterpolatingLookupTable() = default;
 
+  // the mapping is sorted by x (points with equal x keep their order)
   void initialize(std::vector<std::pair<double, double>> mapping, double minimum, double maximum);
 
-  double get(double value);
+  double get(double value) const;
 
  private:
-  std::vector<std::pair<double, double>> mappingTable;
+  std::vector<double> mappingX;
+  std::vector<double> mappingY;
+  std::vector<double> mappingSlope;
   double mappingMinimum = 0;
   double mappingMaximum = 0;
 };
+
+// Same mapping for tables known at compile time, the points must be sorted by x. Construction and lookup are constexpr.
+template <size_t N>
+class FixedInterpolatingLookupTable {
+  static_assert(N > 0, "table needs at least one point");
+
+ public:
+  constexpr FixedInterpolatingLookupTable(const double (&x)[N], const double (&y)[N], double minimum, double maximum)
+      : mappingMinimum(minimum), mappingMaximum(maximum) {
+    for (size_t i = 0; i < N; i++) {
+      mappingX[i] = x[i];
+      mappingY[i] = y[i];
+    }
+    for (size_t i = 0; i + 1 < N; i++) {
+      mappingSlope[i] = x[i + 1] > x[i] ? (y[i + 1] - y[i]) / (x[i + 1] - x[i]) : 0.0;
+    }
+  }
+
+  constexpr double get(double value) const {
+    if (!(value > mappingX[0])) {
+      return clip(mappingY[0]);
+    }
+    if (value >= mappingX[N - 1]) {
+      return clip(mappingY[N - 1]);
+    }
+
+    // last point with x <= value, the search range always holds it
+    size_t left = 0;
+    size_t right = N - 1;
+    while (right - left > 1) {
+      size_t middle = (left + right) >> 1;
+      if (value < mappingX[middle]) {
+        right = middle;
+      } else {
+        left = middle;
+      }
+    }
+    return clip(mappingY[left] + mappingSlope[left] * (value - mappingX[left]));
+  }
+
+ private:
+  double mappingX[N] = {};
+  double mappingY[N] = {};
+  double mappingSlope[N] = {};
+  double mappingMinimum = 0;
+  double mappingMaximum = 0;
+
+  constexpr double clip(double result) const {
+    if (result < mappingMinimum) {
+      return mappingMinimum;
+    } else if (result > mappingMaximum) {
+      return mappingMaximum;
+    }
+    return result;
+  }
+};
@@ -0,0 +1,116 @@
+#include <algorithm>
+
+#include "LoadSheddingPolicy.h"
+#include "Logger.h"
+
+using namespace std;
+
+const char* LoadSheddingPolicy::LEVEL_NAMES[NUMBER_OF_LEVELS] = {
+    "NONE", "DEFER_RECORDER_COMPRESSION", "SUPPRESS_LOGGING", "DECIMATE_SLOW_STAGES", "THROTTLE_CLIENT_DATA", "REDUCE_SIMULATION_RATE",
+};
+
+void LoadSheddingPolicy::initialize(bool isEnabled,
+                                    double frameCostBudget,
+                                    int escalationFrames,
+                                    int recoveryFrames,
+                                    int slowStageDecimationFactor,
+                                    int clientDataDivider) {
+  this->isEnabled = isEnabled;
+  this->frameCostBudget = frameCostBudget;
+  this->escalationFrames = max(1, escalationFrames);
+  this->recoveryFrames = max(1, recoveryFrames);
+  this->slowStageDecimationFactor = max(1, slowStageDecimationFactor);
+  this->clientDataDivider = max(1, clientDataDivider);
+
+  if (!isEnabled) {
+    return;
+  }
+
+  // register L variables to report the decisions
+  idLevel = make_unique<LocalVariable>("A32NX_LOAD_SHEDDING_LEVEL");
+  idRecorderCompressionDeferred = make_unique<LocalVariable>("A32NX_LOAD_SHEDDING_FDR_COMPRESSION_DEFERRED");
+  idLoggingSuppressed = make_unique<LocalVariable>("A32NX_LOAD_SHEDDING_LOGGING_SUPPRESSED");
+  idSlowStagesDecimated = make_unique<LocalVariable>("A32NX_LOAD_SHEDDING_SLOW_STAGES_DECIMATED");
+  idClientDataThrottled = make_unique<LocalVariable>("A32NX_LOAD_SHEDDING_CLIENT_DATA_THROTTLED");
+  idSimulationRateReductionAllowed = make_unique<LocalVariable>("A32NX_LOAD_SHEDDING_SIMULATION_RATE_REDUCTION_ALLOWED");
+  setLevel(NONE);
+}
+
+bool LoadSheddingPolicy::getIsEnabled() const {
+  return isEnabled;
+}
+
+void LoadSheddingPolicy::beginFrame() {
+  if (!isEnabled) {
+    return;
+  }
+
+  startTime = chrono::steady_clock::now();
+}
+
+void LoadSheddingPolicy::endFrame(bool isPerformanceWarningActive) {
+  if (!isEnabled) {
+    return;
+  }
+
+  // measure cost of this frame in milliseconds
+  double frameCost = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+  frameCounter++;
+
+  // count consecutive frames with and without load
+  if (frameCost > frameCostBudget || isPerformanceWarningActive) {
+    framesUnderLoad++;
+    framesWithoutLoad = 0;
+  } else {
+    framesWithoutLoad++;
+    framesUnderLoad = 0;
+  }
+
+  // escalate or recover one level at a time
+  if (framesUnderLoad >= escalationFrames && level < REDUCE_SIMULATION_RATE) {
+    framesUnderLoad = 0;
+    setLevel(static_cast<Level>(level + 1));
+    LOG_WARNING("WASM: Load shedding escalated to %s (frame cost %.2f ms, budget %.2f ms)", LEVEL_NAMES[level], frameCost,
+                frameCostBudget);
+  } else if (framesWithoutLoad >= recoveryFrames && level > NONE) {
+    framesWithoutLoad = 0;
+    setLevel(static_cast<Level>(level - 1));
+    LOG_WARNING("WASM: Load shedding recovered to %s", LEVEL_NAMES[level]);
+  }
+}
+
+LoadSheddingPolicy::Level LoadSheddingPolicy::getLevel() const {
+  return level;
+}
+
+bool LoadSheddingPolicy::isFlightDataRecorderCompressionDeferred() const {
+  return level >= DEFER_RECORDER_COMPRESSION;
+}
+
+bool LoadSheddingPolicy::isLoggingSuppressed() const {
+  return level >= SUPPRESS_LOGGING;
+}
+
+int LoadSheddingPolicy::getSlowStageDecimationFactor() const {
+  return level >= DECIMATE_SLOW_STAGES ? slowStageDecimationFactor : 1;
+}
+
+bool LoadSheddingPolicy::isClientDataPublishingDue() const {
+  return level < THROTTLE_CLIENT_DATA || (frameCounter % clientDataDivider) == 0;
+}
+
+bool LoadSheddingPolicy::isSimulationRateReductionAllowed() const {
+  return !isEnabled || level >= REDUCE_SIMULATION_RATE;
+}
+
+void LoadSheddingPolicy::setLevel(Level newLevel) {
+  level = newLevel;
+
+  // report decisions
+  idLevel->set(level);
+  idRecorderCompressionDeferred->set(isFlightDataRecorderCompressionDeferred());
+  idLoggingSuppressed->set(isLoggingSuppressed());
+  idSlowStagesDecimated->set(level >= DECIMATE_SLOW_STAGES);
+  idClientDataThrottled->set(level >= THROTTLE_CLIENT_DATA);
+  idSimulationRateReductionAllowed->set(isSimulationRateReductionAllowed());
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "LocalVariable.h"
+
+// Responds to load by shedding optional work step by step before the simulation rate is reduced. The cost of each frame
+// is measured, when it exceeds the budget (or the sim reports low performance) for a number of consecutive frames the
+// policy escalates to the next level, after a longer period without load it recovers one level at a time. Each level
+// includes the measures of the levels below. When disabled only the simulation rate reduction is allowed.
+class LoadSheddingPolicy {
+ public:
+  enum Level {
+    NONE,
+    DEFER_RECORDER_COMPRESSION,
+    SUPPRESS_LOGGING,
+    DECIMATE_SLOW_STAGES,
+    THROTTLE_CLIENT_DATA,
+    REDUCE_SIMULATION_RATE,
+    NUMBER_OF_LEVELS
+  };
+
+  static const char* LEVEL_NAMES[NUMBER_OF_LEVELS];
+
+  void initialize(bool isEnabled,
+                  double frameCostBudget,
+                  int escalationFrames,
+                  int recoveryFrames,
+                  int slowStageDecimationFactor,
+                  int clientDataDivider);
+
+  bool getIsEnabled() const;
+
+  void beginFrame();
+
+  // measures the cost of the frame and escalates or recovers, decisions apply from the next frame on
+  void endFrame(bool isPerformanceWarningActive);
+
+  Level getLevel() const;
+
+  bool isFlightDataRecorderCompressionDeferred() const;
+
+  bool isLoggingSuppressed() const;
+
+  // factor for the dividers of the rate scheduler (1 = no decimation)
+  int getSlowStageDecimationFactor() const;
+
+  // false in frames where publishing of client data is skipped
+  bool isClientDataPublishingDue() const;
+
+  bool isSimulationRateReductionAllowed() const;
+
+ private:
+  bool isEnabled = false;
+  double frameCostBudget = 0;
+  int escalationFrames = 0;
+  int recoveryFrames = 0;
+  int slowStageDecimationFactor = 1;
+  int clientDataDivider = 1;
+
+  Level level = NONE;
+  int framesUnderLoad = 0;
+  int framesWithoutLoad = 0;
+  uint64_t frameCounter = 0;
+
+  std::chrono::steady_clock::time_point startTime;
+
+  std::unique_ptr<LocalVariable> idLevel;
+  std::unique_ptr<LocalVariable> idRecorderCompressionDeferred;
+  std::unique_ptr<LocalVariable> idLoggingSuppressed;
+  std::unique_ptr<LocalVariable> idSlowStagesDecimated;
+  std::unique_ptr<LocalVariable> idClientDataThrottled;
+  std::unique_ptr<LocalVariable> idSimulationRateReductionAllowed;
+
+  void setLevel(Level newLevel);
+};
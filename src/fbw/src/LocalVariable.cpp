@@ -1,69 +1,171 @@
 #include "LocalVariable.h"
 
-using std::cout;
-using std::endl;
-using std::set;
 using std::string;
+using std::vector;
 
-set<LocalVariable*> LocalVariable::LOCAL_VARIABLES;
+LocalVariable::Registry LocalVariable::REGISTRY;
+uint32_t LocalVariable::GENERATION = 1;
+uint32_t LocalVariable::NATIVE_CALLS_IN_FRAME = 0;
+
+static constexpr size_t BITS_PER_WORD = 64;
+
+static bool testBit(const vector<uint64_t>& bitmap, size_t index) {
+  return (bitmap[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1;
+}
+
+static void setBit(vector<uint64_t>& bitmap, size_t index) {
+  bitmap[index / BITS_PER_WORD] |= uint64_t(1) << (index % BITS_PER_WORD);
+}
+
+static void clearBit(vector<uint64_t>& bitmap, size_t index) {
+  bitmap[index / BITS_PER_WORD] &= ~(uint64_t(1) << (index % BITS_PER_WORD));
+}
+
+template <typename Function>
+static void forEachBit(uint64_t word, size_t wordIndex, Function function) {
+  while (word != 0) {
+    function(wordIndex * BITS_PER_WORD + __builtin_ctzll(word));
+    word &= word - 1;
+  }
+}
 
 LocalVariable::LocalVariable(const string& variable, bool shouldUseDirtyState) {
+  // get free slot in registry or append a new one
+  if (!REGISTRY.freeIndices.empty()) {
+    index = REGISTRY.freeIndices.back();
+    REGISTRY.freeIndices.pop_back();
+  } else {
+    index = REGISTRY.ids.size();
+    REGISTRY.ids.push_back(0);
+    REGISTRY.values.push_back(0.0);
+    REGISTRY.generations.push_back(0);
+    REGISTRY.refreshIntervals.push_back(1);
+    REGISTRY.names.emplace_back();
+    // grow bitmaps if needed
+    size_t numberOfWords = (REGISTRY.ids.size() + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    for (auto bitmap : {&REGISTRY.isUsed, &REGISTRY.isDirtyStateUsed, &REGISTRY.isDirty}) {
+      bitmap->resize(numberOfWords, 0);
+    }
+  }
+
   // initialize variables
-  useDirtyState = shouldUseDirtyState;
-  isDirty = false;
-  value = 0.0;
-  name = variable;
+  REGISTRY.names[index] = variable;
+  REGISTRY.values[index] = 0.0;
+  REGISTRY.refreshIntervals[index] = 1;
+  setBit(REGISTRY.isUsed, index);
+  if (shouldUseDirtyState) {
+    setBit(REGISTRY.isDirtyStateUsed, index);
+  } else {
+    clearBit(REGISTRY.isDirtyStateUsed, index);
+  }
+  clearBit(REGISTRY.isDirty, index);
+
   // register variable
-  id = register_named_variable(name.c_str());
+  REGISTRY.ids[index] = register_named_variable(variable.c_str());
+
   // read current value
   read();
-  // remember in global list (for readAll)
-  LOCAL_VARIABLES.insert(this);
 }
 
 LocalVariable::~LocalVariable() {
-  LOCAL_VARIABLES.erase(this);
+  clearBit(REGISTRY.isUsed, index);
+  clearBit(REGISTRY.isDirty, index);
+  REGISTRY.names[index].clear();
+  REGISTRY.freeIndices.push_back(index);
 }
 
 string LocalVariable::getName() {
-  return name;
+  return REGISTRY.names[index];
+}
+
+void LocalVariable::setRefreshPolicy(RefreshPolicy policy, uint32_t numberOfFrames) {
+  switch (policy) {
+    case EVERY_FRAME:
+      REGISTRY.refreshIntervals[index] = 1;
+      break;
+    case EVERY_N_FRAMES:
+      REGISTRY.refreshIntervals[index] = numberOfFrames > 0 ? numberOfFrames : 1;
+      break;
+    case ON_DEMAND:
+      REGISTRY.refreshIntervals[index] = 0;
+      break;
+  }
 }
 
 double LocalVariable::get(bool shouldRead) {
   if (shouldRead) {
+    // a pending write is written out first, otherwise the read would discard it
+    if (testBit(REGISTRY.isDirty, index)) {
+      write();
+    }
     read();
+  } else {
+    // fetch when value is older than allowed by the refresh policy (interval 0 -> only on demand)
+    // a pending write is the most recent value and must not be overwritten
+    uint32_t interval = REGISTRY.refreshIntervals[index];
+    if (interval != 0 && GENERATION - REGISTRY.generations[index] >= interval && !testBit(REGISTRY.isDirty, index)) {
+      read();
+    }
   }
-  return value;
+  return REGISTRY.values[index];
 }
 
 void LocalVariable::set(double newValue, bool shouldWrite) {
-  value = newValue;
-  isDirty = true;
+  REGISTRY.values[index] = newValue;
+  REGISTRY.generations[index] = GENERATION;
+  setBit(REGISTRY.isDirty, index);
   if (shouldWrite) {
     write();
   }
 }
 
 void LocalVariable::read() {
-  value = get_named_variable_value(id);
+  REGISTRY.values[index] = get_named_variable_value(REGISTRY.ids[index]);
+  REGISTRY.generations[index] = GENERATION;
+  NATIVE_CALLS_IN_FRAME++;
 }
 
 void LocalVariable::write() {
-  if (useDirtyState && !isDirty) {
+  if (testBit(REGISTRY.isDirtyStateUsed, index) && !testBit(REGISTRY.isDirty, index)) {
     return;
   }
-  set_named_variable_value(id, value);
-  isDirty = false;
+  set_named_variable_value(REGISTRY.ids[index], REGISTRY.values[index]);
+  clearBit(REGISTRY.isDirty, index);
+  NATIVE_CALLS_IN_FRAME++;
+}
+
+void LocalVariable::beginFrame() {
+  // all values fetched so far become one frame older
+  GENERATION++;
+  NATIVE_CALLS_IN_FRAME = 0;
 }
 
 void LocalVariable::readAll() {
-  for (auto variable : LOCAL_VARIABLES) {
-    variable->read();
+  for (size_t w = 0; w < REGISTRY.isUsed.size(); w++) {
+    // pending writes keep their value
+    forEachBit(REGISTRY.isUsed[w] & ~REGISTRY.isDirty[w], w, [](size_t i) {
+      REGISTRY.values[i] = get_named_variable_value(REGISTRY.ids[i]);
+      REGISTRY.generations[i] = GENERATION;
+      NATIVE_CALLS_IN_FRAME++;
+    });
   }
 }
 
 void LocalVariable::writeAll() {
-  for (auto variable : LOCAL_VARIABLES) {
-    variable->write();
+  for (size_t w = 0; w < REGISTRY.isUsed.size(); w++) {
+    // variables without dirty state are always written
+    forEachBit((REGISTRY.isDirty[w] | ~REGISTRY.isDirtyStateUsed[w]) & REGISTRY.isUsed[w], w, [](size_t i) {
+      set_named_variable_value(REGISTRY.ids[i], REGISTRY.values[i]);
+      NATIVE_CALLS_IN_FRAME++;
+    });
+    REGISTRY.isDirty[w] = 0;
   }
 }
+
+size_t LocalVariable::getNumberOfVariables() {
+  return REGISTRY.ids.size() - REGISTRY.freeIndices.size();
+}
+
+uint32_t LocalVariable::getNumberOfNativeCallsInFrame() {
+  return NATIVE_CALLS_IN_FRAME;
+}
@@ -1,34 +1,67 @@
 #pragma once
 
+#include <cstdint>
 #include <iostream>
-#include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <MSFS/Legacy/gauges.h>
 
+// Thin handle to an entry of the local variable registry. IDs and values of all variables are stored in contiguous
+// arrays, the dirty state is kept as bitmap with one bit per variable:
+//  - get() fetches the value lazily on first access in a frame, a global generation counter is increased by
+//    beginFrame() and every value is stamped with the generation it was fetched in
+//  - the refresh policy defines how old a value may become before it is fetched again
+//  - set() only marks the variable dirty, writeAll() writes all dirty variables in one pass
 class LocalVariable {
  public:
+  enum RefreshPolicy {
+    EVERY_FRAME,
+    EVERY_N_FRAMES,
+    ON_DEMAND,
+  };
+
   explicit LocalVariable(const std::string& name, bool shouldUseDirtyState = true);
   ~LocalVariable();
 
+  LocalVariable(const LocalVariable&) = delete;
+  LocalVariable& operator=(const LocalVariable&) = delete;
+
   std::string getName();
 
+  void setRefreshPolicy(RefreshPolicy policy, uint32_t numberOfFrames = 1);
+
   double get(bool shouldRead = false);
-  void set(double newValue, bool shouldWrite = true);
+  void set(double newValue, bool shouldWrite = false);
 
   void read();
   void write();
 
+  static void beginFrame();
+
   static void readAll();
   static void writeAll();
 
+  static size_t getNumberOfVariables();
+  static uint32_t getNumberOfNativeCallsInFrame();
+
  private:
-  static std::set<LocalVariable*> LOCAL_VARIABLES;
+  struct Registry {
+    std::vector<ID> ids;
+    std::vector<double> values;
+    std::vector<uint32_t> generations;
+    std::vector<uint32_t> refreshIntervals;
+    std::vector<std::string> names;
+    std::vector<size_t> freeIndices;
+    std::vector<uint64_t> isUsed;
+    std::vector<uint64_t> isDirtyStateUsed;
+    std::vector<uint64_t> isDirty;
+  };
+
+  static Registry REGISTRY;
+  static uint32_t GENERATION;
+  static uint32_t NATIVE_CALLS_IN_FRAME;
 
-  ID id;
-  std::string name;
-  bool useDirtyState;
-  bool isDirty;
-  double value;
+  size_t index;
 };
@@ -0,0 +1,13 @@
+#pragma once
+
+struct PerformanceData {
+  double read_data_us;
+  double autopilot_state_machine_us;
+  double autopilot_laws_us;
+  double fly_by_wire_us;
+  double thrust_limits_us;
+  double autothrust_us;
+  double spoilers_us;
+  double flight_data_recorder_us;
+  double frame_us;
+};
@@ -0,0 +1,104 @@
+#include <algorithm>
+
+#include "RateScheduler.h"
+
+using namespace std;
+
+const char* RateScheduler::TASK_NAMES[NUMBER_OF_TASKS] = {
+    "ALTIMETER_SETTING", "APPROACH_CAPABILITY", "THRUST_LIMITS", "ADDITIONAL_DATA", "ENGINE_DATA",
+};
+
+void RateScheduler::initialize(bool isEnabled, const int dividers[NUMBER_OF_TASKS]) {
+  this->isEnabled = isEnabled;
+  decimationFactor = 1;
+  frameCounter = 0;
+
+  for (int i = 0; i < NUMBER_OF_TASKS; i++) {
+    configuredDivider[i] = max(1, dividers[i]);
+    due[i] = false;
+    elapsedTime[i] = 0;
+  }
+
+  updateSchedule();
+}
+
+bool RateScheduler::getIsEnabled() const {
+  return isEnabled;
+}
+
+int RateScheduler::getDivider(Task task) const {
+  return divider[task];
+}
+
+void RateScheduler::setDecimationFactor(int factor) {
+  factor = max(1, factor);
+  if (factor != decimationFactor) {
+    decimationFactor = factor;
+    updateSchedule();
+  }
+}
+
+void RateScheduler::beginFrame(double sampleTime) {
+  executedTasksInFrame = 0;
+  skippedTasksInFrame = 0;
+
+  for (int i = 0; i < NUMBER_OF_TASKS; i++) {
+    elapsedTime[i] += sampleTime;
+    // a due task stays pending until it is executed, e.g. a task of the fixed rate model steps in a frame without a step
+    due[i] = due[i] || (frameCounter % divider[i]) == static_cast<uint64_t>(phase[i]);
+    if (!due[i]) {
+      skippedTasksInFrame++;
+    }
+  }
+
+  frameCounter++;
+}
+
+bool RateScheduler::isDue(Task task) const {
+  return !isActive() || due[task];
+}
+
+void RateScheduler::setExecuted(Task task) {
+  if (due[task]) {
+    executedTasksInFrame++;
+  }
+  due[task] = false;
+  elapsedTime[task] = 0;
+}
+
+double RateScheduler::getSampleTime(Task task, double sampleTime) const {
+  return isActive() ? elapsedTime[task] : sampleTime;
+}
+
+uint32_t RateScheduler::getNumberOfExecutedTasks() const {
+  return executedTasksInFrame;
+}
+
+uint32_t RateScheduler::getNumberOfSkippedTasks() const {
+  return skippedTasksInFrame;
+}
+
+bool RateScheduler::isActive() const {
+  return isEnabled || decimationFactor > 1;
+}
+
+void RateScheduler::updateSchedule() {
+  for (int i = 0; i < NUMBER_OF_TASKS; i++) {
+    divider[i] = (isEnabled ? configuredDivider[i] : 1) * decimationFactor;
+  }
+
+  // spread the tasks of each rate group evenly over the frames of the group
+  for (int i = 0; i < NUMBER_OF_TASKS; i++) {
+    int numberOfTasksInGroup = 0;
+    int indexInGroup = 0;
+    for (int j = 0; j < NUMBER_OF_TASKS; j++) {
+      if (divider[j] == divider[i]) {
+        if (j < i) {
+          indexInGroup++;
+        }
+        numberOfTasksInGroup++;
+      }
+    }
+    phase[i] = (indexInGroup * divider[i]) / numberOfTasksInGroup;
+  }
+}
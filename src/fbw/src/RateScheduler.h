@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+
+// Schedules slowly changing update tasks at a fraction of the frame rate. Each task runs every n-th frame (its divider),
+// tasks with the same divider form a rate group and are spread evenly across the frames of that group so that the cost
+// per frame stays flat. When disabled every task is due in every frame. Under load all dividers can be multiplied by a
+// decimation factor, this also applies when the scheduler itself is disabled.
+class RateScheduler {
+ public:
+  enum Task {
+    ALTIMETER_SETTING,
+    APPROACH_CAPABILITY,
+    THRUST_LIMITS,
+    ADDITIONAL_DATA,
+    ENGINE_DATA,
+    NUMBER_OF_TASKS
+  };
+
+  static const char* TASK_NAMES[NUMBER_OF_TASKS];
+
+  void initialize(bool isEnabled, const int dividers[NUMBER_OF_TASKS]);
+
+  bool getIsEnabled() const;
+
+  int getDivider(Task task) const;
+
+  // multiplies all dividers by the given factor (1 = no decimation)
+  void setDecimationFactor(int factor);
+
+  // determines which tasks are due in this frame, has to be called once per frame before the tasks are processed
+  // (tasks that were due but not executed in a previous frame remain due)
+  void beginFrame(double sampleTime);
+
+  // true when the task is due and was not executed yet
+  bool isDue(Task task) const;
+
+  // marks the task as executed, it is not due again before its next frame
+  void setExecuted(Task task);
+
+  // time since the last execution of the task (or the given sample time when the scheduler is inactive)
+  double getSampleTime(Task task, double sampleTime) const;
+
+  uint32_t getNumberOfExecutedTasks() const;
+  uint32_t getNumberOfSkippedTasks() const;
+
+ private:
+  bool isEnabled = false;
+  int decimationFactor = 1;
+
+  uint64_t frameCounter = 0;
+
+  int configuredDivider[NUMBER_OF_TASKS] = {};
+  int divider[NUMBER_OF_TASKS] = {};
+  int phase[NUMBER_OF_TASKS] = {};
+
+  bool due[NUMBER_OF_TASKS] = {};
+  double elapsedTime[NUMBER_OF_TASKS] = {};
+
+  uint32_t executedTasksInFrame = 0;
+  uint32_t skippedTasksInFrame = 0;
+
+  bool isActive() const;
+
+  void updateSchedule();
+};
@@ -2,46 +2,46 @@
 #include <cmath>
 
 RudderTrimHandler::RudderTrimHandler() {
-  rateLimiter.setRate(RATE_LEFT_RIGHT);
+  DiscreteFilters::reset(0.0, rateLimiter);
 }
 
 void RudderTrimHandler::synchronizeValue(double value) {
   targetValue = value;
-  rateLimiter.reset(value);
+  DiscreteFilters::reset(value, rateLimiter);
 }
 
 void RudderTrimHandler::onEventRudderTrimLeft(double dt) {
-  rateLimiter.setRate(RATE_LEFT_RIGHT);
+  rate = RATE_LEFT_RIGHT;
   if (targetValue == POSITION_RESET) {
-    targetValue = rateLimiter.getValue();
+    targetValue = rateLimiter.pY;
   }
   targetValue = fmax(POSITION_MAX_LEFT, targetValue - (RATE_LEFT_RIGHT * dt));
 }
 
 void RudderTrimHandler::onEventRudderTrimReset() {
-  rateLimiter.setRate(RATE_RESET);
+  rate = RATE_RESET;
   targetValue = POSITION_RESET;
 }
 
 void RudderTrimHandler::onEventRudderTrimRight(double dt) {
-  rateLimiter.setRate(RATE_LEFT_RIGHT);
+  rate = RATE_LEFT_RIGHT;
   if (targetValue == POSITION_RESET) {
-    targetValue = rateLimiter.getValue();
+    targetValue = rateLimiter.pY;
   }
   targetValue = fmin(POSITION_MAX_RIGHT, targetValue + (RATE_LEFT_RIGHT * dt));
 }
 
 void RudderTrimHandler::onEventRudderTrimSet(double value) {
-  rateLimiter.setRate(RATE_LEFT_RIGHT);
+  rate = RATE_LEFT_RIGHT;
   targetValue = fmin(POSITION_MAX_RIGHT, fmax(POSITION_MAX_LEFT, value / SET_EVENT_DIVIDER));
 }
 
 void RudderTrimHandler::update(double dt) {
-  rateLimiter.update(targetValue, dt);
+  DiscreteFilters::rateLimiter(targetValue, rate, rate, dt, 0.0, rateLimiter);
 }
 
 double RudderTrimHandler::getPosition() {
-  return rateLimiter.getValue();
+  return rateLimiter.pY;
 }
 
 double RudderTrimHandler::getTargetPosition() {
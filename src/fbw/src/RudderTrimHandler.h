@@ -1,6 +1,6 @@
 #pragma once
 
-#include "RateLimiter.h"
+#include "DiscreteFilters.h"
 
 class RudderTrimHandler {
  public:
@@ -26,5 +26,6 @@ class RudderTrimHandler {
   static constexpr double RATE_RESET = 0.075;
 
   double targetValue = 0;
-  RateLimiter rateLimiter;
+  double rate = RATE_LEFT_RIGHT;
+  RateLimiterState rateLimiter = {};
 };
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "AutopilotLaws_types.h"
+#include "Autothrust_types.h"
+#include "FlyByWire_types.h"
+#include "SimConnectData.h"
+
+// Mappings of sim data into the data inputs of the models. COPY(destination, source) is used for members of the same
+// type, FLAG(destination, source) for boolean sim variables which are stored as (source != 0). Copies of members that are adjacent in
+// both structs are merged at compile time into a single block copy, so the order of a mapping should follow the
+// destination struct.
+
+#define AUTOPILOT_SIM_DATA_MAPPING(COPY, FLAG)          \
+  COPY(aircraft_position.lat, latitude_deg)             \
+  COPY(aircraft_position.lon, longitude_deg)            \
+  COPY(aircraft_position.alt, altitude_m)               \
+  COPY(Theta_deg, Theta_deg)                            \
+  COPY(Phi_deg, Phi_deg)                                \
+  COPY(q_rad_s, bodyRotationVelocity.x)                 \
+  COPY(r_rad_s, bodyRotationVelocity.y)                 \
+  COPY(p_rad_s, bodyRotationVelocity.z)                 \
+  COPY(V_ias_kn, V_ias_kn)                              \
+  COPY(V_tas_kn, V_tas_kn)                              \
+  COPY(V_mach, V_mach)                                  \
+  COPY(V_gnd_kn, V_gnd_kn)                              \
+  COPY(alpha_deg, alpha_deg)                            \
+  COPY(beta_deg, beta_deg)                              \
+  COPY(H_ft, H_ft)                                      \
+  COPY(H_ind_ft, H_ind_ft)                              \
+  COPY(H_radio_ft, H_radio_ft)                          \
+  COPY(H_dot_ft_min, H_dot_fpm)                         \
+  COPY(Psi_magnetic_deg, Psi_magnetic_deg)              \
+  COPY(Psi_magnetic_track_deg, Psi_magnetic_track_deg)  \
+  COPY(Psi_true_deg, Psi_true_deg)                      \
+  COPY(bx_m_s2, bx_m_s2)                                \
+  COPY(by_m_s2, by_m_s2)                                \
+  COPY(bz_m_s2, bz_m_s2)                                \
+  FLAG(nav_valid, nav_valid)                            \
+  COPY(nav_loc_deg, nav_loc_deg)                        \
+  COPY(nav_gs_deg, nav_gs_deg)                          \
+  FLAG(nav_dme_valid, nav_dme_valid)                    \
+  COPY(nav_dme_nmi, nav_dme_nmi)                        \
+  FLAG(nav_loc_valid, nav_loc_valid)                    \
+  COPY(nav_loc_magvar_deg, nav_loc_magvar_deg)          \
+  COPY(nav_loc_error_deg, nav_loc_error_deg)            \
+  COPY(nav_loc_position.lat, nav_loc_pos.Latitude)      \
+  COPY(nav_loc_position.lon, nav_loc_pos.Longitude)     \
+  COPY(nav_loc_position.alt, nav_loc_pos.Altitude)      \
+  FLAG(nav_gs_valid, nav_gs_valid)                      \
+  COPY(nav_gs_error_deg, nav_gs_error_deg)              \
+  COPY(nav_gs_position.lat, nav_gs_pos.Latitude)        \
+  COPY(nav_gs_position.lon, nav_gs_pos.Longitude)       \
+  COPY(nav_gs_position.alt, nav_gs_pos.Altitude)        \
+  COPY(gear_strut_compression_1, gear_animation_pos_1)  \
+  COPY(gear_strut_compression_2, gear_animation_pos_2)  \
+  COPY(zeta_pos, zeta_pos)                              \
+  FLAG(is_engine_operative_1, engine_combustion_1)      \
+  FLAG(is_engine_operative_2, engine_combustion_2)      \
+  COPY(altimeter_setting_left_mbar, kohlsmanSetting_0)  \
+  COPY(altimeter_setting_right_mbar, kohlsmanSetting_1)
+
+#define FLY_BY_WIRE_SIM_DATA_MAPPING(COPY, FLAG)                     \
+  COPY(nz_g, nz_g)                                                   \
+  COPY(Theta_deg, Theta_deg)                                         \
+  COPY(Phi_deg, Phi_deg)                                             \
+  COPY(q_rad_s, bodyRotationVelocity.x)                              \
+  COPY(r_rad_s, bodyRotationVelocity.y)                              \
+  COPY(p_rad_s, bodyRotationVelocity.z)                              \
+  COPY(q_dot_rad_s2, bodyRotationAcceleration.x)                     \
+  COPY(r_dot_rad_s2, bodyRotationAcceleration.y)                     \
+  COPY(p_dot_rad_s2, bodyRotationAcceleration.z)                     \
+  COPY(psi_magnetic_deg, Psi_magnetic_deg)                           \
+  COPY(psi_true_deg, Psi_true_deg)                                   \
+  COPY(eta_pos, eta_pos)                                             \
+  COPY(eta_trim_deg, eta_trim_deg)                                   \
+  COPY(xi_pos, xi_pos)                                               \
+  COPY(zeta_pos, zeta_pos)                                           \
+  COPY(zeta_trim_pos, zeta_trim_pos)                                 \
+  COPY(alpha_deg, alpha_deg)                                         \
+  COPY(beta_deg, beta_deg)                                           \
+  COPY(beta_dot_deg_s, beta_dot_deg_s)                               \
+  COPY(V_ias_kn, V_ias_kn)                                           \
+  COPY(V_tas_kn, V_tas_kn)                                           \
+  COPY(V_mach, V_mach)                                               \
+  COPY(H_ft, H_ft)                                                   \
+  COPY(H_ind_ft, H_ind_ft)                                           \
+  COPY(H_radio_ft, H_radio_ft)                                       \
+  COPY(CG_percent_MAC, CG_percent_MAC)                               \
+  COPY(total_weight_kg, total_weight_kg)                             \
+  COPY(gear_animation_pos_0, gear_animation_pos_0)                   \
+  COPY(gear_animation_pos_1, gear_animation_pos_1)                   \
+  COPY(gear_animation_pos_2, gear_animation_pos_2)                   \
+  COPY(spoilers_left_pos, spoilers_left_pos)                         \
+  COPY(spoilers_right_pos, spoilers_right_pos)                       \
+  FLAG(autopilot_master_on, autopilot_master_on)                     \
+  FLAG(slew_on, slew_on)                                             \
+  COPY(simulation_rate, simulation_rate)                             \
+  COPY(ice_structure_percent, ice_structure_percent)                 \
+  COPY(linear_cl_alpha_per_deg, linear_cl_alpha_per_deg)             \
+  COPY(alpha_stall_deg, alpha_stall_deg)                             \
+  COPY(alpha_zero_lift_deg, alpha_zero_lift_deg)                     \
+  COPY(ambient_density_kg_per_m3, ambient_density_kg_per_m3)         \
+  COPY(ambient_pressure_mbar, ambient_pressure_mbar)                 \
+  COPY(ambient_temperature_celsius, ambient_temperature_celsius)     \
+  COPY(ambient_wind_x_kn, ambient_wind_x_kn)                         \
+  COPY(ambient_wind_y_kn, ambient_wind_y_kn)                         \
+  COPY(ambient_wind_z_kn, ambient_wind_z_kn)                         \
+  COPY(ambient_wind_velocity_kn, ambient_wind_velocity_kn)           \
+  COPY(ambient_wind_direction_deg, ambient_wind_direction_deg)       \
+  COPY(total_air_temperature_celsius, total_air_temperature_celsius) \
+  COPY(latitude_deg, latitude_deg)                                   \
+  COPY(longitude_deg, longitude_deg)                                 \
+  COPY(engine_1_thrust_lbf, engine_1_thrust_lbf)                     \
+  COPY(engine_2_thrust_lbf, engine_2_thrust_lbf)
+
+#define AUTOTHRUST_SIM_DATA_MAPPING(COPY, FLAG)                      \
+  COPY(nz_g, nz_g)                                                   \
+  COPY(Theta_deg, Theta_deg)                                         \
+  COPY(Phi_deg, Phi_deg)                                             \
+  COPY(V_ias_kn, V_ias_kn)                                           \
+  COPY(V_tas_kn, V_tas_kn)                                           \
+  COPY(V_mach, V_mach)                                               \
+  COPY(V_gnd_kn, V_gnd_kn)                                           \
+  COPY(alpha_deg, alpha_deg)                                         \
+  COPY(H_ft, H_ft)                                                   \
+  COPY(H_ind_ft, H_ind_ft)                                           \
+  COPY(H_radio_ft, H_radio_ft)                                       \
+  COPY(H_dot_fpm, H_dot_fpm)                                         \
+  COPY(bx_m_s2, bx_m_s2)                                             \
+  COPY(by_m_s2, by_m_s2)                                             \
+  COPY(bz_m_s2, bz_m_s2)                                             \
+  COPY(gear_strut_compression_1, gear_animation_pos_1)               \
+  COPY(gear_strut_compression_2, gear_animation_pos_2)               \
+  FLAG(is_engine_operative_1, engine_combustion_1)                   \
+  FLAG(is_engine_operative_2, engine_combustion_2)                   \
+  COPY(commanded_engine_N1_1_percent, commanded_engine_N1_1_percent) \
+  COPY(commanded_engine_N1_2_percent, commanded_engine_N1_2_percent) \
+  COPY(engine_N1_1_percent, engine_N1_1_percent)                     \
+  COPY(engine_N1_2_percent, engine_N1_2_percent)                     \
+  COPY(corrected_engine_N1_1_percent, corrected_engine_N1_1_percent) \
+  COPY(corrected_engine_N1_2_percent, corrected_engine_N1_2_percent) \
+  COPY(TAT_degC, total_air_temperature_celsius)                      \
+  COPY(OAT_degC, ambient_temperature_celsius)
+
+struct SimDataCopy {
+  size_t source;
+  size_t destination;
+  size_t size;
+};
+
+template <size_t N>
+struct SimDataCopyList {
+  SimDataCopy copies[N] = {};
+  size_t count = 0;
+};
+
+// merges copies that are contiguous in source and destination
+template <size_t N>
+constexpr SimDataCopyList<N> mergeSimDataCopies(const SimDataCopy (&copies)[N]) {
+  SimDataCopyList<N> list;
+  for (size_t i = 0; i < N; i++) {
+    if (list.count > 0) {
+      SimDataCopy& last = list.copies[list.count - 1];
+      if (last.source + last.size == copies[i].source && last.destination + last.size == copies[i].destination) {
+        last.size += copies[i].size;
+        continue;
+      }
+    }
+    list.copies[list.count++] = copies[i];
+  }
+  return list;
+}
+
+template <size_t N>
+inline void applySimDataCopies(const SimDataCopyList<N>& list, const SimData& source, void* destination) {
+  for (size_t i = 0; i < list.count; i++) {
+    memcpy(static_cast<char*>(destination) + list.copies[i].destination,
+           reinterpret_cast<const char*>(&source) + list.copies[i].source, list.copies[i].size);
+  }
+}
+
+// expansions of a mapping, the destination type has to be available as Destination
+#define SIM_DATA_MAPPING_IGNORE(destination, source)
+#define SIM_DATA_MAPPING_CHECK(destination, source)                                                  \
+  static_assert(std::is_same<decltype(SimData::source), decltype(Destination::destination)>::value, \
+                "sim data copy requires identical types: " #destination);
+#define SIM_DATA_MAPPING_COPY(destination, source)                                          \
+  {offsetof(SimData, source), offsetof(Destination, destination), sizeof(SimData::source)},
+#define SIM_DATA_MAPPING_FLAG(destination, source) data.destination = (simData.source != 0);
+
+#define SIM_DATA_MAPPING_FUNCTION(function, DestinationType, MAPPING)                                  \
+  inline void function(const SimData& simData, DestinationType& data) {                                \
+    using Destination = DestinationType;                                                               \
+    MAPPING(SIM_DATA_MAPPING_CHECK, SIM_DATA_MAPPING_IGNORE)                                           \
+    static constexpr SimDataCopy copies[] = {MAPPING(SIM_DATA_MAPPING_COPY, SIM_DATA_MAPPING_IGNORE)}; \
+    static constexpr auto list = mergeSimDataCopies(copies);                                           \
+    applySimDataCopies(list, simData, &data);                                                          \
+    MAPPING(SIM_DATA_MAPPING_IGNORE, SIM_DATA_MAPPING_FLAG)                                            \
+  }
+
+SIM_DATA_MAPPING_FUNCTION(copySimDataToAutopilot, ap_raw_data, AUTOPILOT_SIM_DATA_MAPPING)
+SIM_DATA_MAPPING_FUNCTION(copySimDataToFlyByWire, base_raw_data, FLY_BY_WIRE_SIM_DATA_MAPPING)
+SIM_DATA_MAPPING_FUNCTION(copySimDataToAutothrust, athr_raw_data, AUTOTHRUST_SIM_DATA_MAPPING)
+
+#undef SIM_DATA_MAPPING_FUNCTION
@@ -1,6 +1,7 @@
 #include "ThrottleAxisMapping.h"
 
 #include <cmath>
+#include "Logger.h"
 #include "ini_type_conversion.h"
 
 using namespace std;
@@ -47,6 +48,13 @@ ThrottleAxisMapping::ThrottleAxisMapping(unsigned int id) {
   idDetentFlexMctHigh = make_unique<LocalVariable>(LVAR_DETENT_FLEXMCT_HIGH.c_str());
   idDetentTogaLow = make_unique<LocalVariable>(LVAR_DETENT_TOGA_LOW.c_str());
   idDetentTogaHigh = make_unique<LocalVariable>(LVAR_DETENT_TOGA_HIGH.c_str());
+
+  // configuration is only fetched when it is loaded from the local variables
+  for (auto& variable : {&idUseReverseOnAxis, &idDetentReverseLow, &idDetentReverseHigh, &idDetentReverseIdleLow, &idDetentReverseIdleHigh,
+                         &idDetentIdleLow, &idDetentIdleHigh, &idDetentClimbLow, &idDetentClimbHigh, &idDetentFlexMctLow,
+                         &idDetentFlexMctHigh, &idDetentTogaLow, &idDetentTogaHigh}) {
+    (*variable)->setRefreshPolicy(LocalVariable::ON_DEMAND);
+  }
 }
 
 void ThrottleAxisMapping::setInFlight() {
@@ -79,7 +87,7 @@ bool ThrottleAxisMapping::loadFromLocalVariables() {
 
 bool ThrottleAxisMapping::applyDefaults() {
   Configuration configuration;
-  cout << "WASM: Throttle configuration set to use default" << endl;
+  LOG_INFO("WASM: Throttle configuration set to use default");
   configuration = getDefaultConfiguration();
 
   // save values to local variables
@@ -100,7 +108,7 @@ bool ThrottleAxisMapping::loadFromFile() {
   // read configuration from file or use default
   Configuration configuration;
   if (!iniFile.read(iniStructure)) {
-    cout << "WASM: failed to read throttle configuration from disk -> create and use default" << endl;
+    LOG_ERROR("WASM: failed to read throttle configuration from disk -> create and use default");
     configuration = getDefaultConfiguration();
   } else {
     configuration = loadConfigurationFromIniStructure(iniStructure);
@@ -136,7 +144,7 @@ void ThrottleAxisMapping::onEventThrottleSet(long value) {
   if (!useReverseOnAxis && !isReverseToggleActive) {
     isReverseToggleKeyActive = false;
   }
-  setCurrentValue(value / 16384.0);
+  setCurrentValue(value / ThrustLeverAngleTable::RAW_SCALE, thrustLeverAngleMapping.getRaw(value));
 }
 
 void ThrottleAxisMapping::onEventThrottleFull() {
@@ -220,12 +228,16 @@ void ThrottleAxisMapping::setThrottlePercent(double value) {
 }
 
 void ThrottleAxisMapping::setCurrentValue(double value) {
+  setCurrentValue(value, thrustLeverAngleMapping.get(value));
+}
+
+void ThrottleAxisMapping::setCurrentValue(double value, double mappedTLA) {
   // calculate new TLA
   double newTLA = 0;
   if (!useReverseOnAxis && (isReverseToggleActive || isReverseToggleKeyActive)) {
     newTLA = (TLA_REVERSE / 2.0) * (value + 1.0);
   } else {
-    newTLA = thrustLeverAngleMapping.get(value);
+    newTLA = mappedTLA;
   }
 
   // ensure not in reverse when in flight
@@ -290,10 +302,19 @@ ThrottleAxisMapping::Configuration ThrottleAxisMapping::getDefaultConfiguration(
 
 ThrottleAxisMapping::Configuration ThrottleAxisMapping::loadConfigurationFromLocalVariables() {
   idUsingConfig->set(true);
-  return {idUseReverseOnAxis->get() == 1, idDetentReverseLow->get(), idDetentReverseHigh->get(), idDetentReverseIdleLow->get(),
-          idDetentReverseIdleHigh->get(), idDetentIdleLow->get(),    idDetentIdleHigh->get(),    idDetentClimbLow->get(),
-          idDetentClimbHigh->get(),       idDetentFlexMctLow->get(), idDetentFlexMctHigh->get(), idDetentTogaLow->get(),
-          idDetentTogaHigh->get()};
+  return {idUseReverseOnAxis->get(true) == 1,
+          idDetentReverseLow->get(true),
+          idDetentReverseHigh->get(true),
+          idDetentReverseIdleLow->get(true),
+          idDetentReverseIdleHigh->get(true),
+          idDetentIdleLow->get(true),
+          idDetentIdleHigh->get(true),
+          idDetentClimbLow->get(true),
+          idDetentClimbHigh->get(true),
+          idDetentFlexMctLow->get(true),
+          idDetentFlexMctHigh->get(true),
+          idDetentTogaLow->get(true),
+          idDetentTogaHigh->get(true)};
 }
 
 void ThrottleAxisMapping::storeConfigurationInLocalVariables(const Configuration& configuration) {
@@ -382,8 +403,8 @@ void ThrottleAxisMapping::updateMappingFromConfiguration(const Configuration& co
   mappingTable.emplace_back(configuration.togaLow, TLA_TOGA);
   mappingTable.emplace_back(configuration.togaHigh, TLA_TOGA);
 
-  // update interpolation lookup table
-  thrustLeverAngleMapping.initialize(mappingTable, useReverseOnAxis ? TLA_REVERSE : TLA_IDLE, TLA_TOGA);
+  // update interpolation lookup table and the thrust lever angles of the raw axis values in the changed range
+  thrustLeverAngleMapping.update(mappingTable, useReverseOnAxis ? TLA_REVERSE : TLA_IDLE, TLA_TOGA);
 
   // remember idle setting
   idleValue = configuration.idleLow;
@@ -9,8 +9,8 @@
 #include <memory>
 #include <string>
 
-#include "InterpolatingLookupTable.h"
 #include "LocalVariable.h"
+#include "ThrustLeverAngleTable.h"
 
 class ThrottleAxisMapping {
  public:
@@ -77,6 +77,7 @@ class ThrottleAxisMapping {
   void updateMappingFromConfiguration(const Configuration& configuration);
 
   void setCurrentValue(double value);
+  void setCurrentValue(double value, double mappedTLA);
 
   void setThrottlePercent(double value);
   void increaseThrottleBy(double value);
@@ -92,7 +93,7 @@ class ThrottleAxisMapping {
   double currentValue = 0.0;
   double currentTLA = 0.0;
 
-  InterpolatingLookupTable thrustLeverAngleMapping;
+  ThrustLeverAngleTable thrustLeverAngleMapping;
 
   std::unique_ptr<LocalVariable> idInputValue;
   std::unique_ptr<LocalVariable> idThrustLeverAngle;
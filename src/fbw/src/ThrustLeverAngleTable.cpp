@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <cmath>
+
+#include "ThrustLeverAngleTable.h"
+
+using namespace std;
+
+ThrustLeverAngleTable::ThrustLeverAngleTable() : rawTable(NUMBER_OF_ENTRIES, 0.0) {}
+
+size_t ThrustLeverAngleTable::update(vector<pair<double, double>> mapping, double minimum, double maximum) {
+  // same order as the interpolating table
+  stable_sort(mapping.begin(), mapping.end(), [](const pair<double, double>& a, const pair<double, double>& b) {
+    return a.first < b.first;
+  });
+  interpolatingTable.initialize(mapping, minimum, maximum);
+
+  // range of the raw values that can be affected by the changed points, the mapping is unchanged before the point
+  // preceding the first change and after the point following the last change
+  int32_t firstRaw = RAW_MINIMUM;
+  int32_t lastRaw = RAW_MAXIMUM;
+  if (mapping.size() == mappingTable.size() && minimum == mappingMinimum && maximum == mappingMaximum && !mapping.empty()) {
+    size_t first = 0;
+    while (first < mapping.size() && mapping[first] == mappingTable[first]) {
+      first++;
+    }
+    if (first == mapping.size()) {
+      return 0;
+    }
+    size_t last = mapping.size() - 1;
+    while (mapping[last] == mappingTable[last]) {
+      last--;
+    }
+
+    if (first > 0) {
+      double x = fmin(mapping[first - 1].first, mappingTable[first - 1].first);
+      firstRaw = static_cast<int32_t>(fmax(floor(x * RAW_SCALE) - 1.0, RAW_MINIMUM));
+    }
+    if (last + 1 < mapping.size()) {
+      double x = fmax(mapping[last + 1].first, mappingTable[last + 1].first);
+      lastRaw = static_cast<int32_t>(fmin(ceil(x * RAW_SCALE) + 1.0, RAW_MAXIMUM));
+    }
+  }
+
+  mappingTable = std::move(mapping);
+  mappingMinimum = minimum;
+  mappingMaximum = maximum;
+
+  if (firstRaw > lastRaw) {
+    return 0;
+  }
+  mapRange(firstRaw, lastRaw);
+  return static_cast<size_t>(lastRaw - firstRaw + 1);
+}
+
+double ThrustLeverAngleTable::getRaw(long raw) const {
+  if (raw < RAW_MINIMUM || raw > RAW_MAXIMUM) {
+    return interpolatingTable.get(raw / RAW_SCALE);
+  }
+  return rawTable[raw - RAW_MINIMUM];
+}
+
+double ThrustLeverAngleTable::get(double value) const {
+  return interpolatingTable.get(value);
+}
+
+void ThrustLeverAngleTable::mapRange(int32_t firstRaw, int32_t lastRaw) {
+  for (int32_t raw = firstRaw; raw <= lastRaw; raw++) {
+    rawTable[raw - RAW_MINIMUM] = interpolatingTable.get(raw / RAW_SCALE);
+  }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "InterpolatingLookupTable.h"
+
+// Mapping of a throttle axis to the thrust lever angle. Raw axis events are integers in a fixed range, the thrust lever
+// angle of every raw value is precomputed and an event needs one array load. Other values (e.g. from throttle
+// increase events) are interpolated. On a configuration change only the raw values in the range of the changed points
+// are mapped again.
+class ThrustLeverAngleTable {
+ public:
+  static constexpr int32_t RAW_MINIMUM = -16384;
+  static constexpr int32_t RAW_MAXIMUM = 16384;
+  static constexpr double RAW_SCALE = 16384.0;
+  static constexpr size_t NUMBER_OF_ENTRIES = RAW_MAXIMUM - RAW_MINIMUM + 1;
+
+  ThrustLeverAngleTable();
+
+  // returns the number of entries that were mapped again
+  size_t update(std::vector<std::pair<double, double>> mapping, double minimum, double maximum);
+
+  // thrust lever angle of a raw axis value (raw / RAW_SCALE)
+  double getRaw(long raw) const;
+
+  double get(double value) const;
+
+ private:
+  std::vector<std::pair<double, double>> mappingTable;
+  double mappingMinimum = 0;
+  double mappingMaximum = 0;
+  InterpolatingLookupTable interpolatingTable;
+  std::vector<double> rawTable;
+
+  void mapRange(int32_t firstRaw, int32_t lastRaw);
+};
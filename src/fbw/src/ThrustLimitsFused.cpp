@@ -0,0 +1,339 @@
+#include <cmath>
+#include <cstring>
+
+#include "ThrustLimitsFused.h"
+#include "look1_binlxpw.h"
+#include "look2_binlxpw.h"
+
+void ThrustLimitsFused::initialize(const Parameters& parameters) {
+  this->parameters = &parameters;
+  const Parameters& P = parameters;
+
+  // tables over total air temperature and altitude, the take-off tables use the saturated altitude
+  numberOfAxes = 0;
+  setupTable(MAXIMUM_CLIMB, P.MaximumClimb_tableData, 30U, false, P.MaximumClimb_bp01Data, P.MaximumClimb_bp02Data,
+             P.MaximumClimb_maxIndex, ALTITUDE);
+  setupTable(OAT_CORNER_POINT_CLIMB, P.OATCornerPoint_tableData, 30U, true, P.OATCornerPoint_bp01Data, P.OATCornerPoint_bp02Data,
+             P.OATCornerPoint_maxIndex, ALTITUDE);
+  setupTable(MAXIMUM_CONTINUOUS, P.MaximumContinuous_tableData, 30U, false, P.MaximumContinuous_bp01Data,
+             P.MaximumContinuous_bp02Data, P.MaximumContinuous_maxIndex, ALTITUDE);
+  setupTable(OAT_CORNER_POINT_CONTINUOUS, P.OATCornerPoint_tableData_f, 30U, true, P.OATCornerPoint_bp01Data_k,
+             P.OATCornerPoint_bp02Data_b, P.OATCornerPoint_maxIndex_l, ALTITUDE);
+  setupTable(MAXIMUM_TAKE_OFF, P.MaximumTakeOff_tableData, 36U, false, P.MaximumTakeOff_bp01Data, P.MaximumTakeOff_bp02Data,
+             P.MaximumTakeOff_maxIndex, ALTITUDE_SATURATED);
+  setupTable(OAT_CORNER_POINT_TAKE_OFF, P.OATCornerPoint_tableData_fa, 36U, true, P.OATCornerPoint_bp01Data_j,
+             P.OATCornerPoint_bp02Data_d, P.OATCornerPoint_maxIndex_d, ALTITUDE_SATURATED);
+
+  // flex table over altitude and flex temperature
+  flexGrid0.initialize(P.Right_bp01Data, P.Right_maxIndex[0U]);
+  flexGrid1.initialize(P.Right_bp02Data, P.Right_maxIndex[1U]);
+
+  // fold the tables indexed only by booleans, the generated kernels provide the result of every combination
+  for (uint32_T i = 0; i < 4U; i++) {
+    idleBleed[i] = look2_binlxpw(static_cast<real_T>(i & 1U), static_cast<real_T>((i >> 1U) & 1U), P.uDLookupTable_bp01Data,
+                                 P.uDLookupTable_bp02Data, P.uDLookupTable_tableData, P.uDLookupTable_maxIndex, 2U);
+  }
+  for (uint32_T i = 0; i < 8U; i++) {
+    flexBleed[i] = (look1_binlxpw(static_cast<real_T>(i & 1U), P.AntiIceEngine_bp01Data, P.AntiIceEngine_tableData, 1U) +
+                    look1_binlxpw(static_cast<real_T>((i >> 1U) & 1U), P.AntiIceWing_bp01Data, P.AntiIceWing_tableData, 1U)) +
+                   look1_binlxpw(static_cast<real_T>((i >> 2U) & 1U), P.AirConditioning_bp01Data, P.AirConditioning_tableData, 1U);
+  }
+
+  // tables indexed by a boolean and an OAT corner point
+  setupBooleanRowTable(climbAntiIceEngine, P.AntiIceEngine_bp01Data_i, P.AntiIceEngine_bp02Data, P.AntiIceEngine_tableData_o);
+  setupBooleanRowTable(climbAntiIceWing, P.AntiIceWing_bp01Data_o, P.AntiIceWing_bp02Data, P.AntiIceWing_tableData_k);
+  setupBooleanRowTable(climbAirConditioning, P.AirConditioning_bp01Data_e, P.AirConditioning_bp02Data, P.AirConditioning_tableData_g);
+  setupBooleanRowTable(continuousAntiIceEngine, P.AntiIceEngine_bp01Data_b, P.AntiIceEngine_bp02Data_k, P.AntiIceEngine_tableData_f);
+  setupBooleanRowTable(continuousAntiIceWing, P.AntiIceWing_bp01Data_c, P.AntiIceWing_bp02Data_i, P.AntiIceWing_tableData_n);
+  setupBooleanRowTable(continuousAirConditioning, P.AirConditioning_bp01Data_p, P.AirConditioning_bp02Data_n,
+                       P.AirConditioning_tableData_f);
+  setupBooleanRowTable(takeOffAntiIceEngine[0], P.AntiIceEngine8000_bp01Data, P.AntiIceEngine8000_bp02Data,
+                       P.AntiIceEngine8000_tableData);
+  setupBooleanRowTable(takeOffAntiIceEngine[1], P.AntiIceEngine8000_bp01Data_a, P.AntiIceEngine8000_bp02Data_g,
+                       P.AntiIceEngine8000_tableData_n);
+  setupBooleanRowTable(takeOffAntiIceWing[0], P.AntiIceWing8000_bp01Data, P.AntiIceWing8000_bp02Data, P.AntiIceWing8000_tableData);
+  setupBooleanRowTable(takeOffAntiIceWing[1], P.AntiIceWing8000_bp01Data_p, P.AntiIceWing8000_bp02Data_o,
+                       P.AntiIceWing8000_tableData_n);
+  setupBooleanRowTable(takeOffAirConditioning[0], P.AirConditioning8000_bp01Data, P.AirConditioning8000_bp02Data,
+                       P.AirConditioning8000_tableData);
+  setupBooleanRowTable(takeOffAirConditioning[1], P.AirConditioning8000_bp01Data_l, P.AirConditioning8000_bp02Data_h,
+                       P.AirConditioning8000_tableData_g);
+
+  // rate limiters of the idle limit and the bleed corrections
+  setupRateLimiter(RATE_LIMITER_IDLE, P.RateLimiterThresholdVariableTs_up, P.RateLimiterThresholdVariableTs_lo,
+                   P.RateLimiterThresholdVariableTs_InitialCondition, P.RateLimiterThresholdVariableTs_Threshold);
+  setupRateLimiter(RATE_LIMITER_FLEX, P.RateLimiterThresholdVariableTs_up_p, P.RateLimiterThresholdVariableTs_lo_b,
+                   P.RateLimiterThresholdVariableTs_InitialCondition_l, P.RateLimiterThresholdVariableTs_Threshold_e);
+  setupRateLimiter(RATE_LIMITER_CLIMB, P.RateLimiterThresholdVariableTs_up_m, P.RateLimiterThresholdVariableTs_lo_d,
+                   P.RateLimiterThresholdVariableTs_InitialCondition_l0, P.RateLimiterThresholdVariableTs_Threshold_o);
+  setupRateLimiter(RATE_LIMITER_CONTINUOUS, P.RateLimiterThresholdVariableTs_up_i, P.RateLimiterThresholdVariableTs_lo_n,
+                   P.RateLimiterThresholdVariableTs_InitialCondition_a, P.RateLimiterThresholdVariableTs_Threshold_c);
+  setupRateLimiter(RATE_LIMITER_TAKE_OFF, P.RateLimiterThresholdVariableTs_up_k, P.RateLimiterThresholdVariableTs_lo_h,
+                   P.RateLimiterThresholdVariableTs_InitialCondition_lb, P.RateLimiterThresholdVariableTs_Threshold_g);
+}
+
+void ThrustLimitsFused::setExternalInputs(const ExternalInputs* externalInputs) {
+  input = *externalInputs;
+}
+
+const ThrustLimitsFused::ExternalOutputs& ThrustLimitsFused::getExternalOutputs() const {
+  return output;
+}
+
+size_t ThrustLimitsFused::getNumberOfTables() const {
+  return NUMBER_OF_TABLES;
+}
+
+size_t ThrustLimitsFused::getNumberOfAxes() const {
+  return numberOfAxes;
+}
+
+void ThrustLimitsFused::setupTable(Table table,
+                                   const real_T* data,
+                                   uint32_T stride,
+                                   bool isClipped,
+                                   const real_T bp0[],
+                                   const real_T bp1[],
+                                   const uint32_T maxIndex[],
+                                   Input input1) {
+  tableData[table] = data;
+  tableStride[table] = stride;
+  tableIsClipped[table] = isClipped;
+  tableAxis0[table] = getAxis(bp0, maxIndex[0U], TOTAL_AIR_TEMPERATURE);
+  tableAxis1[table] = getAxis(bp1, maxIndex[1U], input1);
+}
+
+uint8_t ThrustLimitsFused::getAxis(const real_T* breakpoints, uint32_T maxIndex, Input input) {
+  // breakpoints are compared by value, the generated parameters hold a separate array for every table
+  for (size_t i = 0; i < numberOfAxes; i++) {
+    if (axisInput[i] == input && axisMaxIndex[i] == maxIndex &&
+        memcmp(axisBreakpoints[i], breakpoints, (maxIndex + 1U) * sizeof(real_T)) == 0) {
+      return static_cast<uint8_t>(i);
+    }
+  }
+
+  axisBreakpoints[numberOfAxes] = breakpoints;
+  axisMaxIndex[numberOfAxes] = maxIndex;
+  axisInput[numberOfAxes] = input;
+  axisGrid[numberOfAxes].initialize(breakpoints, maxIndex);
+  return static_cast<uint8_t>(numberOfAxes++);
+}
+
+void ThrustLimitsFused::setupBooleanRowTable(BooleanRowTable& rowTable,
+                                             const real_T (&bp0)[2],
+                                             const real_T (&bp1)[2],
+                                             const real_T (&table)[4]) {
+  // with two breakpoints every branch of the generated kernel uses the first bracket, the row interpolation of both
+  // boolean states is done here with the arithmetic of the kernel
+  for (uint32_T i = 0; i < 2U; i++) {
+    const real_T fraction0 = (static_cast<real_T>(i) - bp0[0U]) / (bp0[1U] - bp0[0U]);
+    real_T yL_0d0 = table[0U];
+    yL_0d0 += (table[1U] - yL_0d0) * fraction0;
+    const real_T yL_0d1 = table[2U];
+    rowTable.yL_0d0[i] = yL_0d0;
+    rowTable.yL_0d1[i] = (table[3U] - yL_0d1) * fraction0 + yL_0d1;
+  }
+  rowTable.bp1 = bp1[0U];
+  rowTable.bp1Delta = bp1[1U] - bp1[0U];
+}
+
+real_T ThrustLimitsFused::lookupBooleanRowTable(const BooleanRowTable& rowTable, bool u0, real_T u1) {
+  const real_T frac = (u1 - rowTable.bp1) / rowTable.bp1Delta;
+  const real_T yL_0d0 = rowTable.yL_0d0[u0];
+  return (rowTable.yL_0d1[u0] - yL_0d0) * frac + yL_0d0;
+}
+
+void ThrustLimitsFused::bracket(real_T u,
+                                const real_T bp[],
+                                uint32_T maxIndex,
+                                const BreakpointGrid& grid,
+                                uint32_T& index,
+                                real_T& fraction,
+                                real_T& fractionClipped) {
+  // same branches and arithmetic as the generated kernels, only the bisection is replaced by the grid
+  if (u <= bp[0U]) {
+    index = 0U;
+    fraction = (u - bp[0U]) / (bp[1U] - bp[0U]);
+    fractionClipped = 0.0;
+  } else if (u < bp[maxIndex]) {
+    index = grid.findIndex(u);
+    fraction = (u - bp[index]) / (bp[index + 1U] - bp[index]);
+    fractionClipped = fraction;
+  } else {
+    index = maxIndex - 1U;
+    fraction = (u - bp[maxIndex - 1U]) / (bp[maxIndex] - bp[maxIndex - 1U]);
+    fractionClipped = 1.0;
+  }
+}
+
+void ThrustLimitsFused::evaluateTables(const real_T inputs[NUMBER_OF_INPUTS]) {
+  // bracket every distinct axis once
+  for (size_t i = 0; i < numberOfAxes; i++) {
+    bracket(inputs[axisInput[i]], axisBreakpoints[i], axisMaxIndex[i], axisGrid[i], axisIndex[i], axisFraction[i],
+            axisFractionClipped[i]);
+  }
+
+  // interpolate all tables, the loop body has no branches besides the fraction selection
+  for (size_t t = 0; t < NUMBER_OF_TABLES; t++) {
+    const real_T* table = tableData[t];
+    const uint8_t axis0 = tableAxis0[t];
+    const uint8_t axis1 = tableAxis1[t];
+    const real_T fraction0 = tableIsClipped[t] ? axisFractionClipped[axis0] : axisFraction[axis0];
+    const real_T frac = tableIsClipped[t] ? axisFractionClipped[axis1] : axisFraction[axis1];
+
+    uint32_T bpIdx = axisIndex[axis1] * tableStride[t] + axisIndex[axis0];
+    real_T yL_0d0 = table[bpIdx];
+    yL_0d0 += (table[bpIdx + 1U] - yL_0d0) * fraction0;
+    bpIdx += tableStride[t];
+    const real_T yL_0d1 = table[bpIdx];
+    tableResult[t] = (((table[bpIdx + 1U] - yL_0d1) * fraction0 + yL_0d1) - yL_0d0) * frac + yL_0d0;
+  }
+}
+
+real_T ThrustLimitsFused::lookupFlexTable(real_T u0, real_T u1) const {
+  const Parameters& P = *parameters;
+  uint32_T index0;
+  uint32_T index1;
+  real_T fraction0;
+  real_T frac;
+  real_T fractionClipped;
+  bracket(u0, P.Right_bp01Data, P.Right_maxIndex[0U], flexGrid0, index0, fraction0, fractionClipped);
+  bracket(u1, P.Right_bp02Data, P.Right_maxIndex[1U], flexGrid1, index1, frac, fractionClipped);
+
+  // interpolation of look2_binlxpw
+  const real_T* table = P.Right_tableData;
+  uint32_T bpIdx = index1 * 10U + index0;
+  real_T yL_0d0 = table[bpIdx];
+  yL_0d0 += (table[bpIdx + 1U] - yL_0d0) * fraction0;
+  bpIdx += 10U;
+  const real_T yL_0d1 = table[bpIdx];
+  return (((table[bpIdx + 1U] - yL_0d1) * fraction0 + yL_0d1) - yL_0d0) * frac + yL_0d0;
+}
+
+void ThrustLimitsFused::step() {
+  const Parameters& P = *parameters;
+  const thrust_limits_in& in = input.in;
+
+  // saturated altitude of the take-off tables
+  real_T altitudeSaturated;
+  if (in.H_ft > P.Saturation_UpperSat) {
+    altitudeSaturated = P.Saturation_UpperSat;
+  } else if (in.H_ft < P.Saturation_LowerSat) {
+    altitudeSaturated = P.Saturation_LowerSat;
+  } else {
+    altitudeSaturated = in.H_ft;
+  }
+
+  // evaluate all large tables in one pass
+  const real_T inputs[NUMBER_OF_INPUTS] = {in.TAT_degC, in.H_ft, altitudeSaturated};
+  evaluateTables(inputs);
+
+  const bool isAntiIceEngineActive = in.is_anti_ice_engine_1_active || in.is_anti_ice_engine_2_active;
+  const bool isAntiIceWingActive = in.is_anti_ice_wing_active;
+  const bool isAirConditioningActive = in.is_air_conditioning_1_active || in.is_air_conditioning_2_active;
+
+  // inputs of the rate limiters, the bleed corrections of climb, continuous and take-off depend on the OAT corner points
+  const real_T oatCornerPointClimb = tableResult[OAT_CORNER_POINT_CLIMB];
+  const real_T oatCornerPointContinuous = tableResult[OAT_CORNER_POINT_CONTINUOUS];
+  const real_T oatCornerPointTakeOff = tableResult[OAT_CORNER_POINT_TAKE_OFF];
+  const size_t takeOffTable = altitudeSaturated <= P.CompareToConstant_const ? 0 : 1;
+  const real_T takeOffAntiIceEngineBleed =
+      lookupBooleanRowTable(takeOffAntiIceEngine[takeOffTable], isAntiIceEngineActive, oatCornerPointTakeOff);
+  const real_T takeOffAntiIceWingBleed =
+      lookupBooleanRowTable(takeOffAntiIceWing[takeOffTable], isAntiIceWingActive, oatCornerPointTakeOff);
+  const real_T takeOffAirConditioningBleed =
+      lookupBooleanRowTable(takeOffAirConditioning[takeOffTable], isAirConditioningActive, oatCornerPointTakeOff);
+
+  real_T rateLimiterInput[NUMBER_OF_RATE_LIMITERS];
+  rateLimiterInput[RATE_LIMITER_IDLE] = in.thrust_limit_IDLE_percent + idleBleed[isAntiIceEngineActive | (isAntiIceWingActive << 1U)];
+  rateLimiterInput[RATE_LIMITER_FLEX] =
+      flexBleed[isAntiIceEngineActive | (isAntiIceWingActive << 1U) | (isAirConditioningActive << 2U)];
+  rateLimiterInput[RATE_LIMITER_CLIMB] = (lookupBooleanRowTable(climbAntiIceEngine, isAntiIceEngineActive, oatCornerPointClimb) +
+                                          lookupBooleanRowTable(climbAntiIceWing, isAntiIceWingActive, oatCornerPointClimb)) +
+                                         lookupBooleanRowTable(climbAirConditioning, isAirConditioningActive, oatCornerPointClimb);
+  rateLimiterInput[RATE_LIMITER_CONTINUOUS] =
+      (lookupBooleanRowTable(continuousAntiIceEngine, isAntiIceEngineActive, oatCornerPointContinuous) +
+       lookupBooleanRowTable(continuousAntiIceWing, isAntiIceWingActive, oatCornerPointContinuous)) +
+      lookupBooleanRowTable(continuousAirConditioning, isAirConditioningActive, oatCornerPointContinuous);
+  rateLimiterInput[RATE_LIMITER_TAKE_OFF] = (takeOffAntiIceEngineBleed + takeOffAntiIceWingBleed) + takeOffAirConditioningBleed;
+
+  real_T rateLimiterOutput[NUMBER_OF_RATE_LIMITERS];
+  rateLimiters.step(rateLimiterInput, in.dt, rateLimiterOutput);
+
+  // idle
+  output.out.thrust_limit_IDLE_percent = rateLimiterOutput[RATE_LIMITER_IDLE];
+
+  // flex
+  real_T isa = std::fmax(15.0 - 0.0019812 * in.H_ft, -56.5);
+  real_T flex = look2_binlxpw(lookupFlexTable(in.H_ft, std::fmax(std::fmax(std::fmin(in.flex_temperature_degC, isa + 55.0), isa + 29.0),
+                                                                 in.OAT_degC)),
+                              in.TAT_degC, P.Left_bp01Data, P.Left_bp02Data, P.Left_tableData, P.Left_maxIndex, 2U) +
+                rateLimiterOutput[RATE_LIMITER_FLEX];
+
+  // climb
+  real_T climb;
+  if (in.use_external_CLB_limit) {
+    climb = in.thrust_limit_CLB_percent;
+  } else {
+    climb = tableResult[MAXIMUM_CLIMB] + rateLimiterOutput[RATE_LIMITER_CLIMB];
+  }
+
+  // transition from flex to climb
+  if (!prevThrustLimitType_not_empty) {
+    prevThrustLimitType = in.thrust_limit_type;
+    prevThrustLimitType_not_empty = true;
+  }
+
+  isFlexActive = ((in.thrust_limit_type == 3.0) || ((prevFlexTemperature == 0.0) && (in.flex_temperature_degC != 0.0)) ||
+                  ((in.flex_temperature_degC != 0.0) && (in.thrust_limit_type != 2.0) && (in.thrust_limit_type != 4.0) && isFlexActive));
+  if (isFlexActive && (prevThrustLimitType == 3.0) && (in.thrust_limit_type == 1.0)) {
+    isTransitionActive = true;
+    transitionStartTime = in.simulation_time_s;
+    transitionFactor = (climb - flex) / 30.0;
+  } else if (!isFlexActive) {
+    isTransitionActive = false;
+    transitionStartTime = 0.0;
+    transitionFactor = 0.0;
+  }
+
+  real_T deltaThrust;
+  if (isTransitionActive) {
+    real_T transitionTime = std::fmax(0.0, (in.simulation_time_s - transitionStartTime) - 10.0);
+    if ((transitionTime > 0.0) && (climb > flex)) {
+      deltaThrust = std::fmin(climb - flex, transitionTime * transitionFactor);
+    } else {
+      deltaThrust = 0.0;
+    }
+
+    if (flex + deltaThrust >= climb) {
+      isFlexActive = false;
+      isTransitionActive = false;
+    }
+  } else {
+    deltaThrust = 0.0;
+  }
+
+  prevThrustLimitType = in.thrust_limit_type;
+  prevFlexTemperature = in.flex_temperature_degC;
+
+  // maximum continuous and take-off
+  real_T continuous = tableResult[MAXIMUM_CONTINUOUS] + rateLimiterOutput[RATE_LIMITER_CONTINUOUS];
+  real_T takeOffBleed = rateLimiterOutput[RATE_LIMITER_TAKE_OFF];
+
+  // outputs, the go-around limit of the generated model is not part of its outputs and is not evaluated
+  if (isFlexActive) {
+    output.out.thrust_limit_CLB_percent = std::fmin(climb, flex) + deltaThrust;
+  } else {
+    output.out.thrust_limit_CLB_percent = climb;
+  }
+  output.out.thrust_limit_FLEX_percent = flex;
+  output.out.thrust_limit_MCT_percent = continuous;
+  output.out.thrust_limit_TOGA_percent = std::fmax(continuous, tableResult[MAXIMUM_TAKE_OFF] + takeOffBleed);
+}
+
+void ThrustLimitsFused::setupRateLimiter(RateLimiter rateLimiter, real_T up, real_T lo, real_T init, real_T threshold) {
+  rateLimiters.up[rateLimiter] = up;
+  rateLimiters.lo[rateLimiter] = lo;
+  rateLimiters.init[rateLimiter] = init;
+  rateLimiters.threshold[rateLimiter] = threshold;
+}
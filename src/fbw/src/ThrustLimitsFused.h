@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "BreakpointGrid.h"
+#include "DiscreteFilters.h"
+#include "ThrustLimits.h"
+
+// Evaluation of the ThrustLimits model with fused table lookups. The model interpolates six large tables over total air
+// temperature and altitude, several of them with identical breakpoints. Every distinct axis is bracketed once per step
+// and all tables are interpolated afterwards in one pass over flat arrays. The remaining logic follows the generated
+// step() operation by operation, the outputs are bit-identical to the generated model (see thrust-limits-check).
+// The small bleed tables indexed by booleans are folded into precomputed results of their input combinations. Uniform
+// axes find their bracket without bisection (see BreakpointGrid).
+class ThrustLimitsFused {
+ public:
+  typedef ThrustLimitsModelClass::Parameters_ThrustLimits_T Parameters;
+  typedef ThrustLimitsModelClass::ExternalInputs_ThrustLimits_T ExternalInputs;
+  typedef ThrustLimitsModelClass::ExternalOutputs_ThrustLimits_T ExternalOutputs;
+
+  // parameters are referenced and must outlive the evaluator (usually the ones of the generated model)
+  void initialize(const Parameters& parameters);
+
+  void setExternalInputs(const ExternalInputs* externalInputs);
+  const ExternalOutputs& getExternalOutputs() const;
+
+  void step();
+
+  size_t getNumberOfTables() const;
+  size_t getNumberOfAxes() const;
+
+ private:
+  enum Table {
+    MAXIMUM_CLIMB,
+    OAT_CORNER_POINT_CLIMB,
+    MAXIMUM_CONTINUOUS,
+    OAT_CORNER_POINT_CONTINUOUS,
+    MAXIMUM_TAKE_OFF,
+    OAT_CORNER_POINT_TAKE_OFF,
+    NUMBER_OF_TABLES
+  };
+
+  enum Input { TOTAL_AIR_TEMPERATURE, ALTITUDE, ALTITUDE_SATURATED, NUMBER_OF_INPUTS };
+
+  enum RateLimiter {
+    RATE_LIMITER_IDLE,
+    RATE_LIMITER_FLEX,
+    RATE_LIMITER_CLIMB,
+    RATE_LIMITER_CONTINUOUS,
+    RATE_LIMITER_TAKE_OFF,
+    NUMBER_OF_RATE_LIMITERS
+  };
+
+  static constexpr size_t MAXIMUM_NUMBER_OF_AXES = 2 * NUMBER_OF_TABLES;
+
+  // 2x2 table over a boolean and a continuous input, the rows of both boolean states are interpolated in advance
+  struct BooleanRowTable {
+    real_T yL_0d0[2];
+    real_T yL_0d1[2];
+    real_T bp1;
+    real_T bp1Delta;
+  };
+
+  const Parameters* parameters = nullptr;
+
+  ExternalInputs input = {};
+  ExternalOutputs output = {};
+
+  // distinct axes, tables with equal breakpoints on the same input share an axis
+  size_t numberOfAxes = 0;
+  const real_T* axisBreakpoints[MAXIMUM_NUMBER_OF_AXES] = {};
+  uint32_T axisMaxIndex[MAXIMUM_NUMBER_OF_AXES] = {};
+  Input axisInput[MAXIMUM_NUMBER_OF_AXES] = {};
+  BreakpointGrid axisGrid[MAXIMUM_NUMBER_OF_AXES] = {};
+
+  // bracket of every axis, the clipped fraction is the one of the look2_binlcpw kernel
+  uint32_T axisIndex[MAXIMUM_NUMBER_OF_AXES] = {};
+  real_T axisFraction[MAXIMUM_NUMBER_OF_AXES] = {};
+  real_T axisFractionClipped[MAXIMUM_NUMBER_OF_AXES] = {};
+
+  // tables as structure of arrays
+  const real_T* tableData[NUMBER_OF_TABLES] = {};
+  uint32_T tableStride[NUMBER_OF_TABLES] = {};
+  uint8_t tableAxis0[NUMBER_OF_TABLES] = {};
+  uint8_t tableAxis1[NUMBER_OF_TABLES] = {};
+  bool tableIsClipped[NUMBER_OF_TABLES] = {};
+  real_T tableResult[NUMBER_OF_TABLES] = {};
+
+  // grids of the flex table
+  BreakpointGrid flexGrid0;
+  BreakpointGrid flexGrid1;
+
+  // tables indexed only by booleans hold the result of every input combination
+  real_T idleBleed[4] = {};
+  real_T flexBleed[8] = {};
+
+  // tables indexed by a boolean and the result of an OAT corner point table
+  BooleanRowTable climbAntiIceEngine = {};
+  BooleanRowTable climbAntiIceWing = {};
+  BooleanRowTable climbAirConditioning = {};
+  BooleanRowTable continuousAntiIceEngine = {};
+  BooleanRowTable continuousAntiIceWing = {};
+  BooleanRowTable continuousAirConditioning = {};
+  BooleanRowTable takeOffAntiIceEngine[2] = {};
+  BooleanRowTable takeOffAntiIceWing[2] = {};
+  BooleanRowTable takeOffAirConditioning[2] = {};
+
+  // state of the model
+  real_T prevFlexTemperature = 0.0;
+  real_T prevThrustLimitType = 0.0;
+  real_T transitionStartTime = 0.0;
+  real_T transitionFactor = 0.0;
+  bool prevThrustLimitType_not_empty = false;
+  bool isFlexActive = false;
+  bool isTransitionActive = false;
+  RateLimiterBank<NUMBER_OF_RATE_LIMITERS> rateLimiters;
+
+  void setupTable(Table table,
+                  const real_T* data,
+                  uint32_T stride,
+                  bool isClipped,
+                  const real_T bp0[],
+                  const real_T bp1[],
+                  const uint32_T maxIndex[],
+                  Input input1);
+  uint8_t getAxis(const real_T* breakpoints, uint32_T maxIndex, Input input);
+
+  void evaluateTables(const real_T inputs[NUMBER_OF_INPUTS]);
+  real_T lookupFlexTable(real_T u0, real_T u1) const;
+
+  static void bracket(real_T u,
+                      const real_T bp[],
+                      uint32_T maxIndex,
+                      const BreakpointGrid& grid,
+                      uint32_T& index,
+                      real_T& fraction,
+                      real_T& fractionClipped);
+
+  static void setupBooleanRowTable(BooleanRowTable& rowTable,
+                                   const real_T (&bp0)[2],
+                                   const real_T (&bp1)[2],
+                                   const real_T (&table)[4]);
+  static real_T lookupBooleanRowTable(const BooleanRowTable& rowTable, bool u0, real_T u1);
+
+  void setupRateLimiter(RateLimiter rateLimiter, real_T up, real_T lo, real_T init, real_T threshold);
+};
@@ -2,131 +2,202 @@
 
 #include <MSFS/Legacy/gauges.h>
 #include <SimConnect.h>
+#include <cstddef>
+
+enum SimDataGroup {
+  SIM_DATA_FAST,
+  SIM_DATA_SLOW,
+};
+
+// Registry of all sim data fields as FIELD(type, member, simvar, unit, group). The SimData struct and the SimConnect
+// data definitions are generated from this list, so order and data type of a definition always match the struct.
+// Fast fields change every frame, slow fields are only sent on change when subscribed.
+#define SIM_DATA_FIELDS(FIELD)                                                                                       \
+  FIELD(double, nz_g, "G FORCE", "GFORCE", SIM_DATA_FAST)                                                            \
+  FIELD(double, Theta_deg, "PLANE PITCH DEGREES", "DEGREE", SIM_DATA_FAST)                                           \
+  FIELD(double, Phi_deg, "PLANE BANK DEGREES", "DEGREE", SIM_DATA_FAST)                                              \
+  FIELD(SIMCONNECT_DATA_XYZ, bodyRotationVelocity, "STRUCT BODY ROTATION VELOCITY", "STRUCT", SIM_DATA_FAST)         \
+  FIELD(SIMCONNECT_DATA_XYZ, bodyRotationAcceleration, "STRUCT BODY ROTATION ACCELERATION", "STRUCT", SIM_DATA_FAST) \
+  FIELD(double, bx_m_s2, "ACCELERATION BODY Z", "METER PER SECOND SQUARED", SIM_DATA_FAST)                           \
+  FIELD(double, by_m_s2, "ACCELERATION BODY X", "METER PER SECOND SQUARED", SIM_DATA_FAST)                           \
+  FIELD(double, bz_m_s2, "ACCELERATION BODY Y", "METER PER SECOND SQUARED", SIM_DATA_FAST)                           \
+  FIELD(double, Psi_magnetic_deg, "PLANE HEADING DEGREES MAGNETIC", "DEGREES", SIM_DATA_FAST)                        \
+  FIELD(double, Psi_true_deg, "PLANE HEADING DEGREES TRUE", "DEGREES", SIM_DATA_FAST)                                \
+  FIELD(double, Psi_magnetic_track_deg, "GPS GROUND MAGNETIC TRACK", "DEGREES", SIM_DATA_FAST)                       \
+  FIELD(double, eta_pos, "ELEVATOR POSITION", "POSITION", SIM_DATA_FAST)                                             \
+  FIELD(double, eta_trim_deg, "ELEVATOR TRIM POSITION", "DEGREE", SIM_DATA_FAST)                                     \
+  FIELD(double, xi_pos, "AILERON POSITION", "POSITION", SIM_DATA_FAST)                                               \
+  FIELD(double, zeta_pos, "RUDDER POSITION", "POSITION", SIM_DATA_FAST)                                              \
+  FIELD(double, zeta_trim_pos, "RUDDER TRIM PCT", "PERCENT OVER 100", SIM_DATA_FAST)                                 \
+  FIELD(double, alpha_deg, "INCIDENCE ALPHA", "DEGREE", SIM_DATA_FAST)                                               \
+  FIELD(double, beta_deg, "INCIDENCE BETA", "DEGREE", SIM_DATA_FAST)                                                 \
+  FIELD(double, beta_dot_deg_s, "BETA DOT", "DEGREE PER SECOND", SIM_DATA_FAST)                                      \
+  FIELD(double, V_ias_kn, "AIRSPEED INDICATED", "KNOTS", SIM_DATA_FAST)                                              \
+  FIELD(double, V_tas_kn, "AIRSPEED TRUE", "KNOTS", SIM_DATA_FAST)                                                   \
+  FIELD(double, V_mach, "AIRSPEED MACH", "MACH", SIM_DATA_FAST)                                                      \
+  FIELD(double, V_gnd_kn, "GROUND VELOCITY", "KNOTS", SIM_DATA_FAST)                                                 \
+  /* workaround for altitude issues due to MSFS bug, needs to be changed to PRESSURE ALTITUDE again when solved */   \
+  FIELD(double, H_ft, "INDICATED ALTITUDE:3", "FEET", SIM_DATA_FAST)                                                 \
+  FIELD(double, H_ind_ft, "INDICATED ALTITUDE", "FEET", SIM_DATA_FAST)                                               \
+  FIELD(double, H_radio_ft, "PLANE ALT ABOVE GROUND MINUS CG", "FEET", SIM_DATA_FAST)                                \
+  FIELD(double, H_dot_fpm, "VELOCITY WORLD Y", "FEET PER MINUTE", SIM_DATA_FAST)                                     \
+  FIELD(double, CG_percent_MAC, "CG PERCENT", "PERCENT OVER 100", SIM_DATA_SLOW)                                     \
+  FIELD(double, total_weight_kg, "TOTAL WEIGHT", "KILOGRAMS", SIM_DATA_SLOW)                                         \
+  FIELD(double, gear_animation_pos_0, "GEAR ANIMATION POSITION:0", "NUMBER", SIM_DATA_FAST)                          \
+  FIELD(double, gear_animation_pos_1, "GEAR ANIMATION POSITION:1", "NUMBER", SIM_DATA_FAST)                          \
+  FIELD(double, gear_animation_pos_2, "GEAR ANIMATION POSITION:2", "NUMBER", SIM_DATA_FAST)                          \
+  FIELD(double, spoilers_handle_position, "SPOILERS HANDLE POSITION", "POSITION", SIM_DATA_FAST)                     \
+  FIELD(double, spoilers_left_pos, "SPOILERS LEFT POSITION", "PERCENT OVER 100", SIM_DATA_FAST)                      \
+  FIELD(double, spoilers_right_pos, "SPOILERS RIGHT POSITION", "PERCENT OVER 100", SIM_DATA_FAST)                    \
+  FIELD(unsigned long long, slew_on, "IS SLEW ACTIVE", "BOOL", SIM_DATA_FAST)                                        \
+  FIELD(unsigned long long, autopilot_master_on, "AUTOPILOT MASTER", "BOOL", SIM_DATA_FAST)                          \
+  FIELD(unsigned long long, ap_fd_1_active, "AUTOPILOT FLIGHT DIRECTOR ACTIVE:1", "BOOL", SIM_DATA_FAST)             \
+  FIELD(unsigned long long, ap_fd_2_active, "AUTOPILOT FLIGHT DIRECTOR ACTIVE:2", "BOOL", SIM_DATA_FAST)             \
+  FIELD(double, ap_V_c_kn, "AUTOPILOT AIRSPEED HOLD VAR", "KNOTS", SIM_DATA_FAST)                                    \
+  FIELD(double, ap_H_c_ft, "AUTOPILOT ALTITUDE LOCK VAR:3", "FEET", SIM_DATA_FAST)                                   \
+  FIELD(double, simulationTime, "SIMULATION TIME", "NUMBER", SIM_DATA_FAST)                                          \
+  FIELD(double, simulation_rate, "SIMULATION RATE", "NUMBER", SIM_DATA_FAST)                                         \
+  FIELD(double, ice_structure_percent, "STRUCTURAL ICE PCT", "PERCENT OVER 100", SIM_DATA_SLOW)                      \
+  FIELD(double, linear_cl_alpha_per_deg, "LINEAR CL ALPHA", "PER DEGREE", SIM_DATA_SLOW)                             \
+  FIELD(double, alpha_stall_deg, "STALL ALPHA", "DEGREE", SIM_DATA_SLOW)                                             \
+  FIELD(double, alpha_zero_lift_deg, "ZERO LIFT ALPHA", "DEGREE", SIM_DATA_SLOW)                                     \
+  FIELD(double, ambient_density_kg_per_m3, "AMBIENT DENSITY", "KILOGRAM PER CUBIC METER", SIM_DATA_SLOW)             \
+  FIELD(double, ambient_pressure_mbar, "AMBIENT PRESSURE", "MILLIBARS", SIM_DATA_SLOW)                               \
+  FIELD(double, ambient_temperature_celsius, "AMBIENT TEMPERATURE", "CELSIUS", SIM_DATA_SLOW)                        \
+  FIELD(double, ambient_wind_x_kn, "AMBIENT WIND X", "KNOTS", SIM_DATA_SLOW)                                         \
+  FIELD(double, ambient_wind_y_kn, "AMBIENT WIND Y", "KNOTS", SIM_DATA_SLOW)                                         \
+  FIELD(double, ambient_wind_z_kn, "AMBIENT WIND Z", "KNOTS", SIM_DATA_SLOW)                                         \
+  FIELD(double, ambient_wind_velocity_kn, "AMBIENT WIND VELOCITY", "KNOTS", SIM_DATA_SLOW)                           \
+  FIELD(double, ambient_wind_direction_deg, "AMBIENT WIND DIRECTION", "DEGREES", SIM_DATA_SLOW)                      \
+  FIELD(double, total_air_temperature_celsius, "TOTAL AIR TEMPERATURE", "CELSIUS", SIM_DATA_SLOW)                    \
+  FIELD(double, latitude_deg, "PLANE LATITUDE", "DEGREES", SIM_DATA_FAST)                                            \
+  FIELD(double, longitude_deg, "PLANE LONGITUDE", "DEGREES", SIM_DATA_FAST)                                          \
+  FIELD(double, throttle_lever_1_pos, "GENERAL ENG THROTTLE LEVER POSITION:1", "PERCENT", SIM_DATA_FAST)             \
+  FIELD(double, throttle_lever_2_pos, "GENERAL ENG THROTTLE LEVER POSITION:2", "PERCENT", SIM_DATA_FAST)             \
+  FIELD(double, engine_1_thrust_lbf, "TURB ENG JET THRUST:1", "POUNDS", SIM_DATA_FAST)                               \
+  FIELD(double, engine_2_thrust_lbf, "TURB ENG JET THRUST:2", "POUNDS", SIM_DATA_FAST)                               \
+  FIELD(unsigned long long, nav_valid, "NAV HAS NAV:3", "BOOL", SIM_DATA_FAST)                                       \
+  FIELD(double, nav_loc_deg, "NAV LOCALIZER:3", "DEGREES", SIM_DATA_FAST)                                            \
+  FIELD(double, nav_gs_deg, "NAV RAW GLIDE SLOPE:3", "DEGREES", SIM_DATA_FAST)                                       \
+  FIELD(unsigned long long, nav_dme_valid, "NAV HAS DME:3", "BOOL", SIM_DATA_FAST)                                   \
+  FIELD(double, nav_dme_nmi, "NAV DME:3", "NAUTICAL MILES", SIM_DATA_FAST)                                           \
+  FIELD(unsigned long long, nav_loc_valid, "NAV HAS LOCALIZER:3", "BOOL", SIM_DATA_FAST)                             \
+  FIELD(double, nav_loc_error_deg, "NAV RADIAL ERROR:3", "DEGREES", SIM_DATA_FAST)                                   \
+  FIELD(unsigned long long, nav_gs_valid, "NAV HAS GLIDE SLOPE:3", "BOOL", SIM_DATA_FAST)                            \
+  FIELD(double, nav_gs_error_deg, "NAV GLIDE SLOPE ERROR:3", "DEGREES", SIM_DATA_FAST)                               \
+  FIELD(unsigned long long, isAutoThrottleActive, "AUTOTHROTTLE ACTIVE", "BOOL", SIM_DATA_FAST)                      \
+  FIELD(double, engine_n1_1, "TURB ENG CORRECTED N1:1", "PERCENT", SIM_DATA_FAST)                                    \
+  FIELD(double, engine_n1_2, "TURB ENG CORRECTED N1:2", "PERCENT", SIM_DATA_FAST)                                    \
+  FIELD(unsigned long long, gpsIsFlightPlanActive, "GPS IS ACTIVE FLIGHT PLAN", "BOOL", SIM_DATA_SLOW)               \
+  FIELD(double, gpsWpCrossTrack, "GPS WP CROSS TRK", "NAUTICAL MILES", SIM_DATA_FAST)                                \
+  FIELD(double, gpsWpTrackAngleError, "GPS WP TRACK ANGLE ERROR", "DEGREES", SIM_DATA_FAST)                          \
+  FIELD(double, gpsCourseToSteer, "GPS COURSE TO STEER", "DEGREES", SIM_DATA_FAST)                                   \
+  FIELD(double, commanded_engine_N1_1_percent, "TURB ENG COMMANDED N1:1", "PERCENT", SIM_DATA_FAST)                  \
+  FIELD(double, commanded_engine_N1_2_percent, "TURB ENG COMMANDED N1:2", "PERCENT", SIM_DATA_FAST)                  \
+  FIELD(double, engine_N1_1_percent, "TURB ENG N1:1", "PERCENT", SIM_DATA_FAST)                                      \
+  FIELD(double, engine_N1_2_percent, "TURB ENG N1:2", "PERCENT", SIM_DATA_FAST)                                      \
+  FIELD(double, corrected_engine_N1_1_percent, "TURB ENG CORRECTED N1:1", "PERCENT", SIM_DATA_FAST)                  \
+  FIELD(double, corrected_engine_N1_2_percent, "TURB ENG CORRECTED N1:2", "PERCENT", SIM_DATA_FAST)                  \
+  FIELD(unsigned long long, engine_combustion_1, "ENG COMBUSTION:1", "BOOL", SIM_DATA_FAST)                          \
+  FIELD(unsigned long long, engine_combustion_2, "ENG COMBUSTION:2", "BOOL", SIM_DATA_FAST)                          \
+  FIELD(unsigned long long, is_mach_mode_active, "AUTOPILOT MANAGED SPEED IN MACH", "BOOL", SIM_DATA_FAST)           \
+  FIELD(unsigned long long, speed_slot_index, "AUTOPILOT SPEED SLOT INDEX", "NUMBER", SIM_DATA_FAST)                 \
+  FIELD(unsigned long long, wingAntiIce, "STRUCTURAL DEICE SWITCH", "BOOL", SIM_DATA_SLOW)                           \
+  FIELD(unsigned long long, engineAntiIce_1, "ENG ANTI ICE:1", "BOOL", SIM_DATA_SLOW)                                \
+  FIELD(unsigned long long, engineAntiIce_2, "ENG ANTI ICE:2", "BOOL", SIM_DATA_SLOW)                                \
+  FIELD(unsigned long long, simOnGround, "SIM ON GROUND", "BOOL", SIM_DATA_FAST)                                     \
+  FIELD(double, generalEngineElapsedTime_1, "GENERAL ENG ELAPSED TIME:1", "SECONDS", SIM_DATA_SLOW)                  \
+  FIELD(double, generalEngineElapsedTime_2, "GENERAL ENG ELAPSED TIME:2", "SECONDS", SIM_DATA_SLOW)                  \
+  FIELD(double, standardAtmTemperature, "STANDARD ATM TEMPERATURE", "CELSIUS", SIM_DATA_SLOW)                        \
+  FIELD(double, turbineEngineCorrectedFuelFlow_1, "TURB ENG CORRECTED FF:1", "POUNDS PER HOUR", SIM_DATA_FAST)       \
+  FIELD(double, turbineEngineCorrectedFuelFlow_2, "TURB ENG CORRECTED FF:2", "POUNDS PER HOUR", SIM_DATA_FAST)       \
+  FIELD(double, fuelTankCapacityAuxLeft, "FUEL TANK LEFT AUX CAPACITY", "GALLONS", SIM_DATA_SLOW)                    \
+  FIELD(double, fuelTankCapacityAuxRight, "FUEL TANK RIGHT AUX CAPACITY", "GALLONS", SIM_DATA_SLOW)                  \
+  FIELD(double, fuelTankCapacityMainLeft, "FUEL TANK LEFT MAIN CAPACITY", "GALLONS", SIM_DATA_SLOW)                  \
+  FIELD(double, fuelTankCapacityMainRight, "FUEL TANK RIGHT MAIN CAPACITY", "GALLONS", SIM_DATA_SLOW)                \
+  FIELD(double, fuelTankCapacityCenter, "FUEL TANK CENTER CAPACITY", "GALLONS", SIM_DATA_SLOW)                       \
+  FIELD(double, fuelTankQuantityAuxLeft, "FUEL TANK LEFT AUX QUANTITY", "GALLONS", SIM_DATA_SLOW)                    \
+  FIELD(double, fuelTankQuantityAuxRight, "FUEL TANK RIGHT AUX QUANTITY", "GALLONS", SIM_DATA_SLOW)                  \
+  FIELD(double, fuelTankQuantityMainLeft, "FUEL TANK LEFT MAIN QUANTITY", "GALLONS", SIM_DATA_SLOW)                  \
+  FIELD(double, fuelTankQuantityMainRight, "FUEL TANK RIGHT MAIN QUANTITY", "GALLONS", SIM_DATA_SLOW)                \
+  FIELD(double, fuelTankQuantityCenter, "FUEL TANK CENTER QUANTITY", "GALLONS", SIM_DATA_SLOW)                       \
+  FIELD(double, fuelTankQuantityTotal, "FUEL TOTAL QUANTITY", "GALLONS", SIM_DATA_SLOW)                              \
+  FIELD(double, fuelWeightPerGallon, "FUEL WEIGHT PER GALLON", "POUNDS", SIM_DATA_SLOW)                              \
+  FIELD(double, kohlsmanSetting_0, "KOHLSMAN SETTING MB:0", "MBAR", SIM_DATA_SLOW)                                   \
+  FIELD(double, kohlsmanSetting_1, "KOHLSMAN SETTING MB:1", "MBAR", SIM_DATA_SLOW)                                   \
+  FIELD(unsigned long long, kohlsmanSettingStd_3, "KOHLSMAN SETTING STD:3", "BOOL", SIM_DATA_SLOW)                   \
+  FIELD(double, cameraState, "CAMERA STATE", "NUMBER", SIM_DATA_FAST)                                                \
+  FIELD(double, altitude_m, "PLANE ALTITUDE", "METERS", SIM_DATA_FAST)                                               \
+  FIELD(double, nav_loc_magvar_deg, "NAV MAGVAR:3", "DEGREES", SIM_DATA_SLOW)                                        \
+  FIELD(SIMCONNECT_DATA_LATLONALT, nav_loc_pos, "NAV VOR LATLONALT:3", "STRUCT", SIM_DATA_SLOW)                      \
+  FIELD(SIMCONNECT_DATA_LATLONALT, nav_gs_pos, "NAV GS LATLONALT:3", "STRUCT", SIM_DATA_SLOW)                        \
+  FIELD(double, brakeLeftPosition, "BRAKE LEFT POSITION", "POSITION", SIM_DATA_FAST)                                 \
+  FIELD(double, brakeRightPosition, "BRAKE RIGHT POSITION", "POSITION", SIM_DATA_FAST)                               \
+  FIELD(double, flapsHandleIndex, "FLAPS HANDLE INDEX", "NUMBER", SIM_DATA_FAST)                                     \
+  FIELD(double, gearHandlePosition, "GEAR HANDLE POSITION", "POSITION", SIM_DATA_FAST)
 
 struct SimData {
-  double nz_g;
-  double Theta_deg;
-  double Phi_deg;
-  SIMCONNECT_DATA_XYZ bodyRotationVelocity;
-  SIMCONNECT_DATA_XYZ bodyRotationAcceleration;
-  double bx_m_s2;
-  double by_m_s2;
-  double bz_m_s2;
-  double Psi_magnetic_deg;
-  double Psi_true_deg;
-  double Psi_magnetic_track_deg;
-  double eta_pos;
-  double eta_trim_deg;
-  double xi_pos;
-  double zeta_pos;
-  double zeta_trim_pos;
-  double alpha_deg;
-  double beta_deg;
-  double beta_dot_deg_s;
-  double V_ias_kn;
-  double V_tas_kn;
-  double V_mach;
-  double V_gnd_kn;
-  double H_ft;
-  double H_ind_ft;
-  double H_radio_ft;
-  double H_dot_fpm;
-  double CG_percent_MAC;
-  double total_weight_kg;
-  double gear_animation_pos_0;
-  double gear_animation_pos_1;
-  double gear_animation_pos_2;
-  double spoilers_handle_position;
-  double spoilers_left_pos;
-  double spoilers_right_pos;
-  unsigned long long slew_on;
-  unsigned long long autopilot_master_on;
-  unsigned long long ap_fd_1_active;
-  unsigned long long ap_fd_2_active;
-  double ap_V_c_kn;
-  double ap_H_c_ft;
-  double simulationTime;
-  double simulation_rate;
-  double ice_structure_percent;
-  double linear_cl_alpha_per_deg;
-  double alpha_stall_deg;
-  double alpha_zero_lift_deg;
-  double ambient_density_kg_per_m3;
-  double ambient_pressure_mbar;
-  double ambient_temperature_celsius;
-  double ambient_wind_x_kn;
-  double ambient_wind_y_kn;
-  double ambient_wind_z_kn;
-  double ambient_wind_velocity_kn;
-  double ambient_wind_direction_deg;
-  double total_air_temperature_celsius;
-  double latitude_deg;
-  double longitude_deg;
-  double throttle_lever_1_pos;
-  double throttle_lever_2_pos;
-  double engine_1_thrust_lbf;
-  double engine_2_thrust_lbf;
-  unsigned long long nav_valid;
-  double nav_loc_deg;
-  double nav_gs_deg;
-  unsigned long long nav_dme_valid;
-  double nav_dme_nmi;
-  unsigned long long nav_loc_valid;
-  double nav_loc_error_deg;
-  unsigned long long nav_gs_valid;
-  double nav_gs_error_deg;
-  unsigned long long isAutoThrottleActive;
-  double engine_n1_1;
-  double engine_n1_2;
-  unsigned long long gpsIsFlightPlanActive;
-  double gpsWpCrossTrack;
-  double gpsWpTrackAngleError;
-  double gpsCourseToSteer;
-  double commanded_engine_N1_1_percent;
-  double commanded_engine_N1_2_percent;
-  double engine_N1_1_percent;
-  double engine_N1_2_percent;
-  double corrected_engine_N1_1_percent;
-  double corrected_engine_N1_2_percent;
-  unsigned long long engine_combustion_1;
-  unsigned long long engine_combustion_2;
-  unsigned long long is_mach_mode_active;
-  unsigned long long speed_slot_index;
-  unsigned long long wingAntiIce;
-  unsigned long long engineAntiIce_1;
-  unsigned long long engineAntiIce_2;
-  unsigned long long simOnGround;
-  double generalEngineElapsedTime_1;
-  double generalEngineElapsedTime_2;
-  double standardAtmTemperature;
-  double turbineEngineCorrectedFuelFlow_1;
-  double turbineEngineCorrectedFuelFlow_2;
-  double fuelTankCapacityAuxLeft;
-  double fuelTankCapacityAuxRight;
-  double fuelTankCapacityMainLeft;
-  double fuelTankCapacityMainRight;
-  double fuelTankCapacityCenter;
-  double fuelTankQuantityAuxLeft;
-  double fuelTankQuantityAuxRight;
-  double fuelTankQuantityMainLeft;
-  double fuelTankQuantityMainRight;
-  double fuelTankQuantityCenter;
-  double fuelTankQuantityTotal;
-  double fuelWeightPerGallon;
-  double kohlsmanSetting_0;
-  double kohlsmanSetting_1;
-  unsigned long long kohlsmanSettingStd_3;
-  double cameraState;
-  double altitude_m;
-  double nav_loc_magvar_deg;
-  SIMCONNECT_DATA_LATLONALT nav_loc_pos;
-  SIMCONNECT_DATA_LATLONALT nav_gs_pos;
-  double brakeLeftPosition;
-  double brakeRightPosition;
-  double flapsHandleIndex;
-  double gearHandlePosition;
+#define SIM_DATA_MEMBER(type, member, name, unit, group) type member;
+  SIM_DATA_FIELDS(SIM_DATA_MEMBER)
+#undef SIM_DATA_MEMBER
+};
+
+// SimConnect data type of a sim data member
+template <typename T>
+struct SimDataType;
+
+template <>
+struct SimDataType<double> {
+  static constexpr SIMCONNECT_DATATYPE value = SIMCONNECT_DATATYPE_FLOAT64;
 };
 
+template <>
+struct SimDataType<unsigned long long> {
+  static constexpr SIMCONNECT_DATATYPE value = SIMCONNECT_DATATYPE_INT64;
+};
+
+template <>
+struct SimDataType<SIMCONNECT_DATA_XYZ> {
+  static constexpr SIMCONNECT_DATATYPE value = SIMCONNECT_DATATYPE_XYZ;
+};
+
+template <>
+struct SimDataType<SIMCONNECT_DATA_LATLONALT> {
+  static constexpr SIMCONNECT_DATATYPE value = SIMCONNECT_DATATYPE_LATLONALT;
+};
+
+struct SimDataFieldDefinition {
+  SIMCONNECT_DATATYPE type;
+  const char* name;
+  const char* unit;
+  SimDataGroup group;
+  size_t offset;
+  size_t size;
+};
+
+inline constexpr SimDataFieldDefinition SIM_DATA_FIELD_DEFINITIONS[] = {
+#define SIM_DATA_FIELD_DEFINITION(type, member, name, unit, group) \
+  {SimDataType<type>::value, name, unit, group, offsetof(SimData, member), sizeof(type)},
+    SIM_DATA_FIELDS(SIM_DATA_FIELD_DEFINITION)
+#undef SIM_DATA_FIELD_DEFINITION
+};
+
+inline constexpr size_t SIM_DATA_FIELD_COUNT = sizeof(SIM_DATA_FIELD_DEFINITIONS) / sizeof(SIM_DATA_FIELD_DEFINITIONS[0]);
+
+// SimConnect delivers the fields packed in definition order -> the struct must not contain any padding
+constexpr bool isSimDataPacked() {
+  size_t offset = 0;
+  for (const auto& field : SIM_DATA_FIELD_DEFINITIONS) {
+    if (field.offset != offset) {
+      return false;
+    }
+    offset += field.size;
+  }
+  return offset == sizeof(SimData);
+}
+
+static_assert(isSimDataPacked(), "SimData layout does not match the sim data field registry");
+
 struct SimInput {
   double inputs[3];
 };
@@ -1,9 +1,12 @@
 #include "SimConnectInterface.h"
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <map>
 #include <vector>
 
+#include "Logger.h"
+
 using namespace std;
 
 // remove when aileron events can be processed via SimConnect
@@ -27,9 +30,13 @@ bool SimConnectInterface::connect(bool clientDataEnabled,
                                   bool disableXboxCompatibilityRudderPlusMinus,
                                   double minSimulationRate,
                                   double maxSimulationRate,
-                                  bool limitSimulationRateByPerformance) {
+                                  bool limitSimulationRateByPerformance,
+                                  bool simDataSubscriptionEnabled,
+                                  bool simDataSlowChangedOnly,
+                                  bool clientDataChangedOnly,
+                                  double clientDataHeartbeatPeriod) {
   // info message
-  cout << "WASM: Connecting..." << endl;
+  LOG_INFO("WASM: Connecting...");
 
   // connect
   HRESULT result = SimConnect_Open(&hSimConnect, "FlyByWire", nullptr, 0, 0, 0);
@@ -37,7 +44,7 @@ bool SimConnectInterface::connect(bool clientDataEnabled,
   if (S_OK == result) {
     // we are now connected
     isConnected = true;
-    cout << "WASM: Connected" << endl;
+    LOG_INFO("WASM: Connected");
     // store throttle axis handler
     this->throttleAxis = throttleAxis;
     // store spoilers handler
@@ -50,8 +57,16 @@ bool SimConnectInterface::connect(bool clientDataEnabled,
     this->minSimulationRate = minSimulationRate;
     this->maxSimulationRate = maxSimulationRate;
     this->limitSimulationRateByPerformance = limitSimulationRateByPerformance;
-    // store is client data is enabled
+    // store is client data is enabled and how it is written
     this->clientDataEnabled = clientDataEnabled;
+    this->clientDataChangedOnly = clientDataChangedOnly;
+    this->clientDataHeartbeatPeriod = clientDataHeartbeatPeriod;
+    for (auto& sent : sentClientData) {
+      sent.isValid = false;
+    }
+    // store how sim data is received
+    this->simDataSubscriptionEnabled = simDataSubscriptionEnabled;
+    this->simDataSlowChangedOnly = simDataSlowChangedOnly;
     // store key change value for each axis
     flightControlsKeyChangeAileron = keyChangeAileron;
     flightControlsKeyChangeElevator = keyChangeElevator;
@@ -62,6 +77,8 @@ bool SimConnectInterface::connect(bool clientDataEnabled,
     idFcuEventSetSPEED = make_unique<LocalVariable>("A320_Neo_FCU_SPEED_SET_DATA");
     idFcuEventSetHDG = make_unique<LocalVariable>("A320_Neo_FCU_HDG_SET_DATA");
     idFcuEventSetVS = make_unique<LocalVariable>("A320_Neo_FCU_VS_SET_DATA");
+    // prepare handlers of events
+    prepareEventHandlers();
     // add data to definition
     bool prepareResult = prepareSimDataSimConnectDataDefinitions();
     prepareResult &= prepareSimInputSimConnectDataDefinitions();
@@ -72,7 +89,15 @@ bool SimConnectInterface::connect(bool clientDataEnabled,
     // check result
     if (!prepareResult) {
       // failed to add data definition -> disconnect
-      cout << "WASM: Failed to prepare data definitions" << endl;
+      LOG_ERROR("WASM: Failed to prepare data definitions");
+      disconnect();
+      // failed to connect
+      return false;
+    }
+    // subscribe to sim data if enabled, otherwise it is requested every frame
+    if (simDataSubscriptionEnabled && !subscribeSimData()) {
+      // failed to subscribe -> disconnect
+      LOG_ERROR("WASM: Failed to subscribe to sim data");
       disconnect();
       // failed to connect
       return false;
@@ -95,15 +120,16 @@ void SimConnectInterface::disconnect() {
     // remove when aileron events can be processed via SimConnect
     unregister_key_event_handler(static_cast<GAUGE_KEY_EVENT_HANDLER>(processKeyEvent), NULL);
     // info message
-    cout << "WASM: Disconnecting..." << endl;
+    LOG_INFO("WASM: Disconnecting...");
     // close connection
     SimConnect_Close(hSimConnect);
     // set flag
     isConnected = false;
+    isSimDataSubscribed = false;
     // reset handle
     hSimConnect = 0;
     // info message
-    cout << "WASM: Disconnected" << endl;
+    LOG_INFO("WASM: Disconnected");
   }
 }
 
@@ -116,131 +142,57 @@ void SimConnectInterface::updateSimulationRateLimits(double minSimulationRate, d
   this->maxSimulationRate = maxSimulationRate;
 }
 
+void SimConnectInterface::prepareEventHandlers() {
+  // events are grouped by their position in the event enumeration
+  for (int i = 0; i < Events::NUMBER_OF_EVENTS; i++) {
+    EventHandler& handler = eventHandlers[i];
+    handler.axis = AXIS_NOT_COALESCED;
+    if (i <= Events::AXIS_ELEV_TRIM_SET) {
+      handler.process = &SimConnectInterface::processFlightControlsEvent;
+    } else if (i <= Events::AP_MACH_HOLD) {
+      handler.process = &SimConnectInterface::processAutopilotEvent;
+    } else if (i <= Events::THROTTLE_REVERSE_THRUST_HOLD) {
+      handler.process = &SimConnectInterface::processThrottlesEvent;
+    } else if (i >= Events::SPOILERS_ON && i <= Events::SPOILERS_ARM_SET) {
+      handler.process = &SimConnectInterface::processSpoilersEvent;
+    } else if (i >= Events::SIM_RATE_INCR) {
+      handler.process = &SimConnectInterface::processSimulationRateEvent;
+    } else {
+      handler.process = nullptr;
+    }
+  }
+
+  // absolute axis events are coalesced per axis
+  eventHandlers[Events::AXIS_ELEVATOR_SET].axis = COALESCED_AXIS_ELEVATOR;
+  eventHandlers[Events::ELEVATOR_SET].axis = COALESCED_AXIS_ELEVATOR;
+  eventHandlers[Events::AXIS_AILERONS_SET].axis = COALESCED_AXIS_AILERONS;
+  eventHandlers[Events::AILERON_SET].axis = COALESCED_AXIS_AILERONS;
+  eventHandlers[Events::AXIS_RUDDER_SET].axis = COALESCED_AXIS_RUDDER;
+  eventHandlers[Events::RUDDER_SET].axis = COALESCED_AXIS_RUDDER;
+  eventHandlers[Events::RUDDER_AXIS_PLUS].axis = COALESCED_AXIS_RUDDER;
+  eventHandlers[Events::RUDDER_AXIS_MINUS].axis = COALESCED_AXIS_RUDDER;
+  eventHandlers[Events::THROTTLE_SET].axis = COALESCED_AXIS_THROTTLES;
+  eventHandlers[Events::THROTTLE_AXIS_SET_EX1].axis = COALESCED_AXIS_THROTTLES;
+  eventHandlers[Events::THROTTLE1_SET].axis = COALESCED_AXIS_THROTTLE_1;
+  eventHandlers[Events::THROTTLE1_AXIS_SET_EX1].axis = COALESCED_AXIS_THROTTLE_1;
+  eventHandlers[Events::THROTTLE2_SET].axis = COALESCED_AXIS_THROTTLE_2;
+  eventHandlers[Events::THROTTLE2_AXIS_SET_EX1].axis = COALESCED_AXIS_THROTTLE_2;
+
+  // nothing is pending
+  for (auto& pendingAxisEvent : pendingAxisEvents) {
+    pendingAxisEvent.isPending = false;
+  }
+}
+
 bool SimConnectInterface::prepareSimDataSimConnectDataDefinitions() {
   bool result = true;
 
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "G FORCE", "GFORCE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE PITCH DEGREES", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE BANK DEGREES", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_XYZ, "STRUCT BODY ROTATION VELOCITY", "STRUCT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_XYZ, "STRUCT BODY ROTATION ACCELERATION", "STRUCT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ACCELERATION BODY Z", "METER PER SECOND SQUARED");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ACCELERATION BODY X", "METER PER SECOND SQUARED");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ACCELERATION BODY Y", "METER PER SECOND SQUARED");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE HEADING DEGREES MAGNETIC", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE HEADING DEGREES TRUE", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GPS GROUND MAGNETIC TRACK", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ELEVATOR POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ELEVATOR TRIM POSITION", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AILERON POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "RUDDER POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "RUDDER TRIM PCT", "PERCENT OVER 100");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "INCIDENCE ALPHA", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "INCIDENCE BETA", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "BETA DOT", "DEGREE PER SECOND");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AIRSPEED INDICATED", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AIRSPEED TRUE", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AIRSPEED MACH", "MACH");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GROUND VELOCITY", "KNOTS");
-  // workaround for altitude issues due to MSFS bug, needs to be changed to PRESSURE ALTITUDE again when solved
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "INDICATED ALTITUDE:3", "FEET");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "INDICATED ALTITUDE", "FEET");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE ALT ABOVE GROUND MINUS CG", "FEET");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "VELOCITY WORLD Y", "FEET PER MINUTE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "CG PERCENT", "PERCENT OVER 100");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TOTAL WEIGHT", "KILOGRAMS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GEAR ANIMATION POSITION:0", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GEAR ANIMATION POSITION:1", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GEAR ANIMATION POSITION:2", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "SPOILERS HANDLE POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "SPOILERS LEFT POSITION", "PERCENT OVER 100");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "SPOILERS RIGHT POSITION", "PERCENT OVER 100");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "IS SLEW ACTIVE", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT MASTER", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT FLIGHT DIRECTOR ACTIVE:1", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT FLIGHT DIRECTOR ACTIVE:2", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AUTOPILOT AIRSPEED HOLD VAR", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AUTOPILOT ALTITUDE LOCK VAR:3", "FEET");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "SIMULATION TIME", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "SIMULATION RATE", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "STRUCTURAL ICE PCT", "PERCENT OVER 100");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "LINEAR CL ALPHA", "PER DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "STALL ALPHA", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ZERO LIFT ALPHA", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT DENSITY", "KILOGRAM PER CUBIC METER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT PRESSURE", "MILLIBARS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT TEMPERATURE", "CELSIUS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND X", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND Y", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND Z", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND VELOCITY", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND DIRECTION", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TOTAL AIR TEMPERATURE", "CELSIUS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE LATITUDE", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE LONGITUDE", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG THROTTLE LEVER POSITION:1", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG THROTTLE LEVER POSITION:2", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG JET THRUST:1", "POUNDS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG JET THRUST:2", "POUNDS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "NAV HAS NAV:3", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV LOCALIZER:3", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV RAW GLIDE SLOPE:3", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "NAV HAS DME:3", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV DME:3", "NAUTICAL MILES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "NAV HAS LOCALIZER:3", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV RADIAL ERROR:3", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "NAV HAS GLIDE SLOPE:3", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV GLIDE SLOPE ERROR:3", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOTHROTTLE ACTIVE", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:1", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:2", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "GPS IS ACTIVE FLIGHT PLAN", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GPS WP CROSS TRK", "NAUTICAL MILES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GPS WP TRACK ANGLE ERROR", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GPS COURSE TO STEER", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG COMMANDED N1:1", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG COMMANDED N1:2", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG N1:1", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG N1:2", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:1", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:2", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "ENG COMBUSTION:1", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "ENG COMBUSTION:2", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT MANAGED SPEED IN MACH", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT SPEED SLOT INDEX", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "STRUCTURAL DEICE SWITCH", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "ENG ANTI ICE:1", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "ENG ANTI ICE:2", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "SIM ON GROUND", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG ELAPSED TIME:1", "SECONDS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG ELAPSED TIME:2", "SECONDS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "STANDARD ATM TEMPERATURE", "CELSIUS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED FF:1", "POUNDS PER HOUR");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED FF:2", "POUNDS PER HOUR");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT AUX CAPACITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT AUX CAPACITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT MAIN CAPACITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT MAIN CAPACITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK CENTER CAPACITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT AUX QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT AUX QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT MAIN QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT MAIN QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK CENTER QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TOTAL QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL WEIGHT PER GALLON", "POUNDS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "KOHLSMAN SETTING MB:0", "MBAR");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "KOHLSMAN SETTING MB:1", "MBAR");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "KOHLSMAN SETTING STD:3", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "CAMERA STATE", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE ALTITUDE", "METERS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV MAGVAR:3", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_LATLONALT, "NAV VOR LATLONALT:3", "STRUCT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_LATLONALT, "NAV GS LATLONALT:3", "STRUCT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "BRAKE LEFT POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "BRAKE RIGHT POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FLAPS HANDLE INDEX", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GEAR HANDLE POSITION", "POSITION");
+  simDataFieldsFast.clear();
+  simDataFieldsSlow.clear();
+
+  for (const auto& field : SIM_DATA_FIELD_DEFINITIONS) {
+    result &= addSimDataDefinition(field);
+  }
 
   return result;
 }
@@ -787,8 +739,6 @@ bool SimConnectInterface::prepareClientDataDefinitions() {
   result &= SimConnect_AddToClientDataDefinition(hSimConnect, ClientData::LOCAL_VARIABLES_AUTOTHRUST, SIMCONNECT_CLIENTDATAOFFSET_AUTO,
                                                  SIMCONNECT_CLIENTDATATYPE_FLOAT64);
 
-  // ------------------------------------------------------------------------------------------------------------------
-
   // return result
   return SUCCEEDED(result);
 }
@@ -819,8 +769,15 @@ bool SimConnectInterface::requestData() {
     return false;
   }
 
-  // request data
-  HRESULT result = SimConnect_RequestDataOnSimObject(hSimConnect, 0, 0, SIMCONNECT_OBJECT_ID_USER, SIMCONNECT_PERIOD_ONCE);
+  // data is sent every frame when subscribed
+  if (isSimDataSubscribed) {
+    return true;
+  }
+
+  // request data, the request id tells the age of the reply
+  SIMCONNECT_DATA_REQUEST_ID requestId = SIM_DATA_REQUEST_ONCE_FIRST + (simDataRequestCounter % SIM_DATA_REQUEST_ONCE_COUNT);
+  HRESULT result = SimConnect_RequestDataOnSimObject(hSimConnect, requestId, 0, SIMCONNECT_OBJECT_ID_USER, SIMCONNECT_PERIOD_ONCE);
+  simDataRequestCounter++;
 
   // check result of data request
   if (result != S_OK) {
@@ -838,6 +795,16 @@ bool SimConnectInterface::readData() {
     return false;
   }
 
+  // data becomes one frame older unless new data is received
+  simDataAge++;
+  simDataSlowAge++;
+
+  // reset event and client data counters
+  eventsInFrame = 0;
+  coalescedEventsInFrame = 0;
+  clientDataBytesSentInFrame = 0;
+  clientDataBytesSuppressedInFrame = 0;
+
   // get next dispatch message(s) and process them
   DWORD cbData;
   SIMCONNECT_RECV* pData;
@@ -845,7 +812,32 @@ bool SimConnectInterface::readData() {
     simConnectProcessDispatchMessage(pData, &cbData);
   }
 
+  // apply latest value of axis events received in this frame
+  applyPendingAxisEvents();
+
+  // success
+  return true;
+}
+
+bool SimConnectInterface::subscribeSimData() {
+  // fast moving data is sent every simulation frame
+  HRESULT result = SimConnect_RequestDataOnSimObject(hSimConnect, SIM_DATA_DEFINITION_FAST, SIM_DATA_DEFINITION_FAST,
+                                                     SIMCONNECT_OBJECT_ID_USER, SIMCONNECT_PERIOD_SIM_FRAME);
+  if (result != S_OK) {
+    return false;
+  }
+
+  // slow moving data is optionally only sent when changed and then only contains the changed fields
+  DWORD slowFlags = simDataSlowChangedOnly ? (SIMCONNECT_DATA_REQUEST_FLAG_CHANGED | SIMCONNECT_DATA_REQUEST_FLAG_TAGGED) : 0;
+  result = SimConnect_RequestDataOnSimObject(hSimConnect, SIM_DATA_DEFINITION_SLOW, SIM_DATA_DEFINITION_SLOW, SIMCONNECT_OBJECT_ID_USER,
+                                             SIMCONNECT_PERIOD_SIM_FRAME, slowFlags);
+  if (result != S_OK) {
+    return false;
+  }
+
   // success
+  isSimDataSubscribed = true;
+  LOG_INFO("WASM: Subscribed to sim data with %zu fast and %zu slow fields", simDataFieldsFast.size(), simDataFieldsSlow.size());
   return true;
 }
 
@@ -916,22 +908,50 @@ bool SimConnectInterface::setClientDataLocalVariablesAutothrust(ClientDataLocalV
   return sendClientData(ClientData::LOCAL_VARIABLES_AUTOTHRUST, sizeof(output), &output);
 }
 
-SimData SimConnectInterface::getSimData() {
+void SimConnectInterface::setClientDataPublishingEnabled(bool enabled) {
+  clientDataPublishingEnabled = enabled;
+}
+
+uint32_t SimConnectInterface::getNumberOfClientDataBytesSentInFrame() const {
+  return clientDataBytesSentInFrame;
+}
+
+uint32_t SimConnectInterface::getNumberOfClientDataBytesSuppressedInFrame() const {
+  return clientDataBytesSuppressedInFrame;
+}
+
+const SimData& SimConnectInterface::getSimData() const {
   return simData;
 }
 
-SimInput SimConnectInterface::getSimInput() {
+const SimInput& SimConnectInterface::getSimInput() const {
   return simInput;
 }
 
-SimInputAutopilot SimConnectInterface::getSimInputAutopilot() {
+const SimInputAutopilot& SimConnectInterface::getSimInputAutopilot() const {
   return simInputAutopilot;
 }
 
-SimInputThrottles SimConnectInterface::getSimInputThrottles() {
+const SimInputThrottles& SimConnectInterface::getSimInputThrottles() const {
   return simInputThrottles;
 }
 
+uint32_t SimConnectInterface::getSimDataAge() const {
+  return simDataAge;
+}
+
+uint32_t SimConnectInterface::getSimDataSlowAge() const {
+  return simDataSlowAge;
+}
+
+uint32_t SimConnectInterface::getNumberOfEventsInFrame() const {
+  return eventsInFrame;
+}
+
+uint32_t SimConnectInterface::getNumberOfCoalescedEventsInFrame() const {
+  return coalescedEventsInFrame;
+}
+
 void SimConnectInterface::resetSimInputAutopilot() {
   simInputAutopilot.AP_engage = 0;
   simInputAutopilot.AP_1_push = 0;
@@ -960,7 +980,7 @@ bool SimConnectInterface::setClientDataAutopilotLaws(ClientDataAutopilotLaws out
   return sendClientData(ClientData::AUTOPILOT_LAWS, sizeof(output), &output);
 }
 
-ClientDataAutopilotLaws SimConnectInterface::getClientDataAutopilotLaws() {
+const ClientDataAutopilotLaws& SimConnectInterface::getClientDataAutopilotLaws() const {
   return clientDataAutopilotLaws;
 }
 
@@ -969,11 +989,11 @@ bool SimConnectInterface::setClientDataAutopilotStateMachine(ClientDataAutopilot
   return sendClientData(ClientData::AUTOPILOT_STATE_MACHINE, sizeof(output), &output);
 }
 
-ClientDataAutopilotStateMachine SimConnectInterface::getClientDataAutopilotStateMachine() {
+const ClientDataAutopilotStateMachine& SimConnectInterface::getClientDataAutopilotStateMachine() const {
   return clientDataAutopilotStateMachine;
 }
 
-ClientDataAutothrust SimConnectInterface::getClientDataAutothrust() {
+const ClientDataAutothrust& SimConnectInterface::getClientDataAutothrust() const {
   return clientDataAutothrust;
 }
 
@@ -987,7 +1007,7 @@ bool SimConnectInterface::setClientDataFlyByWire(ClientDataFlyByWire output) {
   return sendClientData(ClientData::FLY_BY_WIRE, sizeof(output), &output);
 }
 
-ClientDataFlyByWire SimConnectInterface::getClientDataFlyByWire() {
+const ClientDataFlyByWire& SimConnectInterface::getClientDataFlyByWire() const {
   return clientDataFlyByWire;
 }
 
@@ -1013,22 +1033,14 @@ void SimConnectInterface::processKeyEvent(ID32 event, UINT32 evdata, PVOID userd
     case KEY_AILERON_LEFT: {
       simInput.inputs[AXIS_AILERONS_SET] = fmin(1.0, simInput.inputs[AXIS_AILERONS_SET] + flightControlsKeyChangeAileron);
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: AILERONS_LEFT: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_AILERONS_SET];
-        cout << endl;
+        LOG_INFO("WASM: AILERONS_LEFT: (no data) -> %g", simInput.inputs[AXIS_AILERONS_SET]);
       }
       break;
     }
     case KEY_AILERON_RIGHT: {
       simInput.inputs[AXIS_AILERONS_SET] = fmax(-1.0, simInput.inputs[AXIS_AILERONS_SET] - flightControlsKeyChangeAileron);
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: AILERONS_RIGHT: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_AILERONS_SET];
-        cout << endl;
+        LOG_INFO("WASM: AILERONS_RIGHT: (no data) -> %g", simInput.inputs[AXIS_AILERONS_SET]);
       }
       break;
     }
@@ -1042,12 +1054,12 @@ void SimConnectInterface::simConnectProcessDispatchMessage(SIMCONNECT_RECV* pDat
   switch (pData->dwID) {
     case SIMCONNECT_RECV_ID_OPEN:
       // connection established
-      cout << "WASM: SimConnect connection established" << endl;
+      LOG_INFO("WASM: SimConnect connection established");
       break;
 
     case SIMCONNECT_RECV_ID_QUIT:
       // connection lost
-      cout << "WASM: Received SimConnect connection quit message" << endl;
+      LOG_INFO("WASM: Received SimConnect connection quit message");
       disconnect();
       break;
 
@@ -1068,9 +1080,9 @@ void SimConnectInterface::simConnectProcessDispatchMessage(SIMCONNECT_RECV* pDat
 
     case SIMCONNECT_RECV_ID_EXCEPTION:
       // exception
-      cout << "WASM: Exception in SimConnect connection: ";
-      cout << getSimConnectExceptionString(static_cast<SIMCONNECT_EXCEPTION>(static_cast<SIMCONNECT_RECV_EXCEPTION*>(pData)->dwException));
-      cout << endl;
+      LOG_ERROR("WASM: Exception in SimConnect connection: %s",
+                getSimConnectExceptionString(static_cast<SIMCONNECT_EXCEPTION>(static_cast<SIMCONNECT_RECV_EXCEPTION*>(pData)->dwException))
+                    .c_str());
       break;
 
     default:
@@ -1079,16 +1091,62 @@ void SimConnectInterface::simConnectProcessDispatchMessage(SIMCONNECT_RECV* pDat
 }
 
 void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* event) {
+  // ignore unknown events
+  if (event->uEventID >= Events::NUMBER_OF_EVENTS) {
+    return;
+  }
+
+  // count events of this frame
+  eventsInFrame++;
+
+  // get handler of event
+  const EventHandler& handler = eventHandlers[event->uEventID];
+
+  // absolute axis events only keep their latest value, it is applied once at the end of reading data
+  if (handler.axis != AXIS_NOT_COALESCED) {
+    PendingAxisEvent& pendingAxisEvent = pendingAxisEvents[handler.axis];
+    if (pendingAxisEvent.isPending) {
+      coalescedEventsInFrame++;
+    }
+    pendingAxisEvent.isPending = true;
+    pendingAxisEvent.sequence = pendingAxisEventSequence++;
+    pendingAxisEvent.event = *event;
+    return;
+  }
+
+  // other events can depend on the state of an axis -> apply pending axis events first to keep the order
+  applyPendingAxisEvents();
+
+  // process event
+  if (handler.process != nullptr) {
+    (this->*handler.process)(event);
+  }
+}
+
+void SimConnectInterface::applyPendingAxisEvents() {
+  // apply in order of arrival, an event for both throttles can supersede a single throttle and vice versa
+  while (true) {
+    PendingAxisEvent* next = nullptr;
+    for (auto& pendingAxisEvent : pendingAxisEvents) {
+      if (pendingAxisEvent.isPending && (next == nullptr || pendingAxisEvent.sequence < next->sequence)) {
+        next = &pendingAxisEvent;
+      }
+    }
+    if (next == nullptr) {
+      return;
+    }
+    next->isPending = false;
+    (this->*eventHandlers[next->event.uEventID].process)(&next->event);
+  }
+}
+
+void SimConnectInterface::processFlightControlsEvent(const SIMCONNECT_RECV_EVENT* event) {
   // process depending on event id
   switch (event->uEventID) {
     case Events::AXIS_ELEVATOR_SET: {
       simInput.inputs[AXIS_ELEVATOR_SET] = static_cast<long>(event->dwData) / 16384.0;
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: AXIS_ELEVATOR_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_ELEVATOR_SET];
-        cout << endl;
+        LOG_INFO("WASM: AXIS_ELEVATOR_SET: %ld -> %g", static_cast<long>(event->dwData), simInput.inputs[AXIS_ELEVATOR_SET]);
       }
       break;
     }
@@ -1096,11 +1154,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::AXIS_AILERONS_SET: {
       simInput.inputs[AXIS_AILERONS_SET] = static_cast<long>(event->dwData) / 16384.0;
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: AXIS_AILERONS_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_AILERONS_SET];
-        cout << endl;
+        LOG_INFO("WASM: AXIS_AILERONS_SET: %ld -> %g", static_cast<long>(event->dwData), simInput.inputs[AXIS_AILERONS_SET]);
       }
       break;
     }
@@ -1108,11 +1162,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::AXIS_RUDDER_SET: {
       simInput.inputs[AXIS_RUDDER_SET] = static_cast<long>(event->dwData) / 16384.0;
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: AXIS_RUDDER_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_RUDDER_SET];
-        cout << endl;
+        LOG_INFO("WASM: AXIS_RUDDER_SET: %ld -> %g", static_cast<long>(event->dwData), simInput.inputs[AXIS_RUDDER_SET]);
       }
       break;
     }
@@ -1120,11 +1170,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::RUDDER_SET: {
       simInput.inputs[AXIS_RUDDER_SET] = static_cast<long>(event->dwData) / 16384.0;
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: RUDDER_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_RUDDER_SET];
-        cout << endl;
+        LOG_INFO("WASM: RUDDER_SET: %ld -> %g", static_cast<long>(event->dwData), simInput.inputs[AXIS_RUDDER_SET]);
       }
       break;
     }
@@ -1132,11 +1178,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::RUDDER_LEFT: {
       simInput.inputs[AXIS_RUDDER_SET] = fmin(1.0, simInput.inputs[AXIS_RUDDER_SET] + flightControlsKeyChangeRudder);
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: RUDDER_LEFT: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_RUDDER_SET];
-        cout << endl;
+        LOG_INFO("WASM: RUDDER_LEFT: (no data) -> %g", simInput.inputs[AXIS_RUDDER_SET]);
       }
       break;
     }
@@ -1144,11 +1186,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::RUDDER_CENTER: {
       simInput.inputs[AXIS_RUDDER_SET] = 0.0;
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: RUDDER_CENTER: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_RUDDER_SET];
-        cout << endl;
+        LOG_INFO("WASM: RUDDER_CENTER: (no data) -> %g", simInput.inputs[AXIS_RUDDER_SET]);
       }
       break;
     }
@@ -1156,11 +1194,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::RUDDER_RIGHT: {
       simInput.inputs[AXIS_RUDDER_SET] = fmax(-1.0, simInput.inputs[AXIS_RUDDER_SET] - flightControlsKeyChangeRudder);
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: RUDDER_RIGHT: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_RUDDER_SET];
-        cout << endl;
+        LOG_INFO("WASM: RUDDER_RIGHT: (no data) -> %g", simInput.inputs[AXIS_RUDDER_SET]);
       }
       break;
     }
@@ -1174,11 +1208,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
         simInput.inputs[AXIS_RUDDER_SET] = +1.0 * (static_cast<long>(event->dwData) / 16384.0);
       }
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: RUDDER_AXIS_MINUS: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_RUDDER_SET];
-        cout << endl;
+        LOG_INFO("WASM: RUDDER_AXIS_MINUS: %ld -> %g", static_cast<long>(event->dwData), simInput.inputs[AXIS_RUDDER_SET]);
       }
       break;
     }
@@ -1192,11 +1222,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
         simInput.inputs[AXIS_RUDDER_SET] = -1.0 * (static_cast<long>(event->dwData) / 16384.0);
       }
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: RUDDER_AXIS_PLUS: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_RUDDER_SET];
-        cout << endl;
+        LOG_INFO("WASM: RUDDER_AXIS_PLUS: %ld -> %g", static_cast<long>(event->dwData), simInput.inputs[AXIS_RUDDER_SET]);
       }
       break;
     }
@@ -1204,11 +1230,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::RUDDER_TRIM_LEFT: {
       rudderTrimHandler->onEventRudderTrimLeft(sampleTime);
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: RUDDER_TRIM_LEFT: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << rudderTrimHandler->getTargetPosition();
-        cout << endl;
+        LOG_INFO("WASM: RUDDER_TRIM_LEFT: (no data) -> %g", rudderTrimHandler->getTargetPosition());
       }
       break;
     }
@@ -1216,11 +1238,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::RUDDER_TRIM_RESET: {
       rudderTrimHandler->onEventRudderTrimReset();
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: RUDDER_TRIM_RESET: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << rudderTrimHandler->getTargetPosition();
-        cout << endl;
+        LOG_INFO("WASM: RUDDER_TRIM_RESET: (no data) -> %g", rudderTrimHandler->getTargetPosition());
       }
       break;
     }
@@ -1228,11 +1246,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::RUDDER_TRIM_RIGHT: {
       rudderTrimHandler->onEventRudderTrimRight(sampleTime);
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: RUDDER_TRIM_RIGHT: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << rudderTrimHandler->getTargetPosition();
-        cout << endl;
+        LOG_INFO("WASM: RUDDER_TRIM_RIGHT: (no data) -> %g", rudderTrimHandler->getTargetPosition());
       }
       break;
     }
@@ -1240,11 +1254,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::RUDDER_TRIM_SET: {
       rudderTrimHandler->onEventRudderTrimSet(static_cast<long>(event->dwData));
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: RUDDER_TRIM_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << rudderTrimHandler->getTargetPosition();
-        cout << endl;
+        LOG_INFO("WASM: RUDDER_TRIM_SET: %ld -> %g", static_cast<long>(event->dwData), rudderTrimHandler->getTargetPosition());
       }
       break;
     }
@@ -1252,11 +1262,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::RUDDER_TRIM_SET_EX1: {
       rudderTrimHandler->onEventRudderTrimSet(static_cast<long>(event->dwData));
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: RUDDER_TRIM_SET_EX1: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << rudderTrimHandler->getTargetPosition();
-        cout << endl;
+        LOG_INFO("WASM: RUDDER_TRIM_SET_EX1: %ld -> %g", static_cast<long>(event->dwData), rudderTrimHandler->getTargetPosition());
       }
       break;
     }
@@ -1264,11 +1270,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::AILERON_SET: {
       simInput.inputs[AXIS_AILERONS_SET] = static_cast<long>(event->dwData) / 16384.0;
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: AILERON_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_AILERONS_SET];
-        cout << endl;
+        LOG_INFO("WASM: AILERON_SET: %ld -> %g", static_cast<long>(event->dwData), simInput.inputs[AXIS_AILERONS_SET]);
       }
       break;
     }
@@ -1276,11 +1278,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::AILERONS_LEFT: {
       simInput.inputs[AXIS_AILERONS_SET] = fmin(1.0, simInput.inputs[AXIS_AILERONS_SET] + flightControlsKeyChangeAileron);
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: AILERONS_LEFT: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_AILERONS_SET];
-        cout << endl;
+        LOG_INFO("WASM: AILERONS_LEFT: (no data) -> %g", simInput.inputs[AXIS_AILERONS_SET]);
       }
       break;
     }
@@ -1288,11 +1286,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::AILERONS_RIGHT: {
       simInput.inputs[AXIS_AILERONS_SET] = fmax(-1.0, simInput.inputs[AXIS_AILERONS_SET] - flightControlsKeyChangeAileron);
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: AILERONS_RIGHT: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_AILERONS_SET];
-        cout << endl;
+        LOG_INFO("WASM: AILERONS_RIGHT: (no data) -> %g", simInput.inputs[AXIS_AILERONS_SET]);
       }
       break;
     }
@@ -1301,13 +1295,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       simInput.inputs[AXIS_RUDDER_SET] = 0.0;
       simInput.inputs[AXIS_AILERONS_SET] = 0.0;
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: CENTER_AILER_RUDDER: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_AILERONS_SET];
-        cout << " / ";
-        cout << simInput.inputs[AXIS_RUDDER_SET];
-        cout << endl;
+        LOG_INFO("WASM: CENTER_AILER_RUDDER: (no data) -> %g / %g", simInput.inputs[AXIS_AILERONS_SET], simInput.inputs[AXIS_RUDDER_SET]);
       }
       break;
     }
@@ -1315,11 +1303,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::ELEVATOR_SET: {
       simInput.inputs[AXIS_ELEVATOR_SET] = static_cast<long>(event->dwData) / 16384.0;
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: ELEVATOR_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_ELEVATOR_SET];
-        cout << endl;
+        LOG_INFO("WASM: ELEVATOR_SET: %ld -> %g", static_cast<long>(event->dwData), simInput.inputs[AXIS_ELEVATOR_SET]);
       }
       break;
     }
@@ -1327,11 +1311,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::ELEV_DOWN: {
       simInput.inputs[AXIS_ELEVATOR_SET] = fmin(1.0, simInput.inputs[AXIS_ELEVATOR_SET] + flightControlsKeyChangeElevator);
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: ELEV_DOWN: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_ELEVATOR_SET];
-        cout << endl;
+        LOG_INFO("WASM: ELEV_DOWN: (no data) -> %g", simInput.inputs[AXIS_ELEVATOR_SET]);
       }
       break;
     }
@@ -1339,11 +1319,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::ELEV_UP: {
       simInput.inputs[AXIS_ELEVATOR_SET] = fmax(-1.0, simInput.inputs[AXIS_ELEVATOR_SET] - flightControlsKeyChangeElevator);
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: ELEV_UP: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << simInput.inputs[AXIS_ELEVATOR_SET];
-        cout << endl;
+        LOG_INFO("WASM: ELEV_UP: (no data) -> %g", simInput.inputs[AXIS_ELEVATOR_SET]);
       }
       break;
     }
@@ -1351,11 +1327,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::ELEV_TRIM_DN: {
       elevatorTrimHandler->onEventElevatorTrimDown();
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: ELEV_TRIM_DN: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << elevatorTrimHandler->getPosition();
-        cout << endl;
+        LOG_INFO("WASM: ELEV_TRIM_DN: (no data) -> %g", elevatorTrimHandler->getPosition());
       }
       break;
     }
@@ -1363,11 +1335,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::ELEV_TRIM_UP: {
       elevatorTrimHandler->onEventElevatorTrimUp();
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: ELEV_TRIM_UP: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << elevatorTrimHandler->getPosition();
-        cout << endl;
+        LOG_INFO("WASM: ELEV_TRIM_UP: (no data) -> %g", elevatorTrimHandler->getPosition());
       }
       break;
     }
@@ -1375,11 +1343,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::ELEVATOR_TRIM_SET: {
       elevatorTrimHandler->onEventElevatorTrimSet(static_cast<long>(event->dwData));
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: ELEVATOR_TRIM_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << elevatorTrimHandler->getPosition();
-        cout << endl;
+        LOG_INFO("WASM: ELEVATOR_TRIM_SET: %ld -> %g", static_cast<long>(event->dwData), elevatorTrimHandler->getPosition());
       }
       break;
     }
@@ -1387,119 +1351,123 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::AXIS_ELEV_TRIM_SET: {
       elevatorTrimHandler->onEventElevatorTrimAxisSet(static_cast<long>(event->dwData));
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: AXIS_ELEV_TRIM_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << elevatorTrimHandler->getPosition();
-        cout << endl;
+        LOG_INFO("WASM: AXIS_ELEV_TRIM_SET: %ld -> %g", static_cast<long>(event->dwData), elevatorTrimHandler->getPosition());
       }
       break;
     }
 
+    default:
+      break;
+  }
+}
+
+void SimConnectInterface::processAutopilotEvent(const SIMCONNECT_RECV_EVENT* event) {
+  // process depending on event id
+  switch (event->uEventID) {
     case Events::AUTOPILOT_OFF: {
       simInputAutopilot.AP_disconnect = 1;
-      cout << "WASM: event triggered: AUTOPILOT_OFF" << endl;
+      LOG_INFO("WASM: event triggered: AUTOPILOT_OFF");
       break;
     }
 
     case Events::AUTOPILOT_ON: {
       simInputAutopilot.AP_engage = 1;
-      cout << "WASM: event triggered: AUTOPILOT_ON" << endl;
+      LOG_INFO("WASM: event triggered: AUTOPILOT_ON");
       break;
     }
 
     case Events::TOGGLE_FLIGHT_DIRECTOR: {
-      cout << "WASM: event triggered: TOGGLE_FLIGHT_DIRECTOR:" << static_cast<long>(event->dwData) << endl;
+      LOG_INFO("WASM: event triggered: TOGGLE_FLIGHT_DIRECTOR:%ld", static_cast<long>(event->dwData));
       break;
     }
 
     case Events::AP_MASTER: {
       simInputAutopilot.AP_1_push = 1;
-      cout << "WASM: event triggered: AP_MASTER" << endl;
+      LOG_INFO("WASM: event triggered: AP_MASTER");
       break;
     }
 
     case Events::AUTOPILOT_DISENGAGE_SET: {
       if (static_cast<long>(event->dwData) == 1) {
         simInputAutopilot.AP_disconnect = 1;
-        cout << "WASM: event triggered: AUTOPILOT_DISENGAGE_SET" << endl;
+        LOG_INFO("WASM: event triggered: AUTOPILOT_DISENGAGE_SET");
       }
       break;
     }
 
     case Events::AUTOPILOT_DISENGAGE_TOGGLE: {
       simInputAutopilot.AP_1_push = 1;
-      cout << "WASM: event triggered: AUTOPILOT_DISENGAGE_TOGGLE" << endl;
+      LOG_INFO("WASM: event triggered: AUTOPILOT_DISENGAGE_TOGGLE");
       break;
     }
 
     case Events::A32NX_FCU_AP_1_PUSH: {
       simInputAutopilot.AP_1_push = 1;
-      cout << "WASM: event triggered: A32NX_FCU_AP_1_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_AP_1_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_AP_2_PUSH: {
       simInputAutopilot.AP_2_push = 1;
-      cout << "WASM: event triggered: A32NX_FCU_AP_2_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_AP_2_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_AP_DISCONNECT_PUSH: {
       simInputAutopilot.AP_disconnect = 1;
-      cout << "WASM: event triggered: A32NX_FCU_AP_DISCONNECT_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_AP_DISCONNECT_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_ATHR_PUSH: {
       simInputThrottles.ATHR_push = 1;
-      cout << "WASM: event triggered: A32NX_FCU_ATHR_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_ATHR_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_ATHR_DISCONNECT_PUSH: {
       simInputThrottles.ATHR_disconnect = 1;
-      cout << "WASM: event triggered: A32NX_FCU_ATHR_DISCONNECT_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_ATHR_DISCONNECT_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_SPD_INC: {
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_INC)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_SPD_INC" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_SPD_INC");
       break;
     }
 
     case Events::A32NX_FCU_SPD_DEC: {
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_DEC)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_SPD_DEC" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_SPD_DEC");
       break;
     }
 
     case Events::A32NX_FCU_SPD_SET: {
       idFcuEventSetSPEED->set(static_cast<long>(event->dwData));
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_SET)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_SPD_SET: " << static_cast<long>(event->dwData) << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_SPD_SET: %ld", static_cast<long>(event->dwData));
       break;
     }
 
     case Events::A32NX_FCU_SPD_PUSH:
     case Events::AP_AIRSPEED_ON: {
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_PUSH)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_SPD_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_SPD_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_SPD_PULL:
     case Events::AP_AIRSPEED_OFF: {
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_PULL)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_SPD_PULL" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_SPD_PULL");
       break;
     }
 
     case Events::A32NX_FCU_SPD_MACH_TOGGLE_PUSH:
     case Events::AP_MACH_HOLD: {
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_TOGGLE_SPEED_MACH)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_SPD_MACH_TOGGLE_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_SPD_MACH_TOGGLE_PUSH");
       break;
     }
 
@@ -1507,7 +1475,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       execute_calculator_code(
           "(L:A32NX_TRK_FPA_MODE_ACTIVE, bool) 1 == if{ (>H:A320_Neo_FCU_HDG_INC_TRACK) } els{ (>H:A320_Neo_FCU_HDG_INC_HEADING) }",
           nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_HDG_INC" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_HDG_INC");
       break;
     }
 
@@ -1515,47 +1483,47 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       execute_calculator_code(
           "(L:A32NX_TRK_FPA_MODE_ACTIVE, bool) 1 == if{ (>H:A320_Neo_FCU_HDG_DEC_TRACK) } els{ (>H:A320_Neo_FCU_HDG_DEC_HEADING) }",
           nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_HDG_DEC" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_HDG_DEC");
       break;
     }
 
     case Events::A32NX_FCU_HDG_SET: {
       idFcuEventSetHDG->set(static_cast<long>(event->dwData));
       execute_calculator_code("(>H:A320_Neo_FCU_HDG_SET)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_HDG_SET: " << static_cast<long>(event->dwData) << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_HDG_SET: %ld", static_cast<long>(event->dwData));
       break;
     }
 
     case Events::A32NX_FCU_HDG_PUSH:
     case Events::AP_HDG_HOLD_ON: {
       execute_calculator_code("(>H:A320_Neo_FCU_HDG_PUSH)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_HDG_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_HDG_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_HDG_PULL:
     case Events::AP_HDG_HOLD_OFF: {
       execute_calculator_code("(>H:A320_Neo_FCU_HDG_PULL)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_HDG_PULL" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_HDG_PULL");
       break;
     }
 
     case Events::A32NX_FCU_TRK_FPA_TOGGLE_PUSH:
     case Events::AP_VS_HOLD: {
       execute_calculator_code("(L:A32NX_TRK_FPA_MODE_ACTIVE) ! (>L:A32NX_TRK_FPA_MODE_ACTIVE)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_TRK_FPA_TOGGLE_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_TRK_FPA_TOGGLE_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_TO_AP_HDG_PUSH: {
       simInputAutopilot.HDG_push = 1;
-      cout << "WASM: event triggered: A32NX_FCU_TO_AP_HDG_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_TO_AP_HDG_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_TO_AP_HDG_PULL: {
       simInputAutopilot.HDG_pull = 1;
-      cout << "WASM: event triggered: A32NX_FCU_TO_AP_HDG_PULL" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_TO_AP_HDG_PULL");
       break;
     }
 
@@ -1580,7 +1548,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
             "(>H:A320_Neo_CDU_AP_INC_ALT)",
             nullptr, nullptr, nullptr);
       }
-      cout << "WASM: event triggered: A32NX_FCU_ALT_INC" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_ALT_INC");
       break;
     }
 
@@ -1605,7 +1573,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
             "+ 100 max (>K:2:AP_ALT_VAR_SET_ENGLISH) (>H:AP_KNOB_Down) (>H:A320_Neo_CDU_AP_DEC_ALT)",
             nullptr, nullptr, nullptr);
       }
-      cout << "WASM: event triggered: A32NX_FCU_ALT_DEC" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_ALT_DEC");
       break;
     }
 
@@ -1615,7 +1583,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       stringStream << value;
       stringStream << " (>K:3:AP_ALT_VAR_SET_ENGLISH)";
       execute_calculator_code(stringStream.str().c_str(), nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_ALT_SET: " << value << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_ALT_SET: %ld", value);
       break;
     }
 
@@ -1626,7 +1594,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
           "if{ 1000 (>L:XMLVAR_Autopilot_Altitude_Increment) } "
           "els{ 100 (>L:XMLVAR_Autopilot_Altitude_Increment) }",
           nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_ALT_INCREMENT_TOGGLE" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_ALT_INCREMENT_TOGGLE");
       break;
     }
 
@@ -1637,7 +1605,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
         stringStream << value;
         stringStream << " (>L:XMLVAR_Autopilot_Altitude_Increment)";
         execute_calculator_code(stringStream.str().c_str(), nullptr, nullptr, nullptr);
-        cout << "WASM: event triggered: A32NX_FCU_ALT_INCREMENT_SET: " << value << endl;
+        LOG_INFO("WASM: event triggered: A32NX_FCU_ALT_INCREMENT_SET: %ld", value);
       }
       break;
     }
@@ -1646,7 +1614,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::AP_ALT_HOLD_ON: {
       simInputAutopilot.ALT_push = 1;
       execute_calculator_code("(>H:A320_Neo_CDU_MODE_MANAGED_ALTITUDE)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_ALT_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_ALT_PUSH");
       break;
     }
 
@@ -1654,7 +1622,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::AP_ALT_HOLD_OFF: {
       simInputAutopilot.ALT_pull = 1;
       execute_calculator_code("(>H:A320_Neo_CDU_MODE_SELECTED_ALTITUDE)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_ALT_PULL" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_ALT_PULL");
       break;
     }
 
@@ -1663,7 +1631,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
           "(L:A32NX_TRK_FPA_MODE_ACTIVE, bool) 1 == if{ (>H:A320_Neo_FCU_VS_INC_FPA) } els{ (>H:A320_Neo_FCU_VS_INC_VS) } "
           "(>H:A320_Neo_CDU_VS)",
           nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_VS_INC" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_VS_INC");
       break;
     }
 
@@ -1672,64 +1640,65 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
           "(L:A32NX_TRK_FPA_MODE_ACTIVE, bool) 1 == if{ (>H:A320_Neo_FCU_VS_DEC_FPA) } els{ (>H:A320_Neo_FCU_VS_DEC_VS) } "
           "(>H:A320_Neo_CDU_VS)",
           nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_VS_DEC" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_VS_DEC");
       break;
     }
 
     case Events::A32NX_FCU_VS_SET: {
       idFcuEventSetVS->set(static_cast<long>(event->dwData));
       execute_calculator_code("(>H:A320_Neo_FCU_VS_SET) (>H:A320_Neo_CDU_VS)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_VS_SET: " << static_cast<long>(event->dwData) << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_VS_SET: %ld", static_cast<long>(event->dwData));
       break;
     }
 
     case Events::A32NX_FCU_VS_PUSH:
     case Events::AP_VS_ON: {
       execute_calculator_code("(>H:A320_Neo_FCU_VS_PUSH) (>H:A320_Neo_CDU_VS)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_VS_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_VS_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_VS_PULL:
     case Events::AP_VS_OFF: {
       execute_calculator_code("(>H:A320_Neo_FCU_VS_PULL) (>H:A320_Neo_CDU_VS)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: A32NX_FCU_VS_PULL" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_VS_PULL");
       break;
     }
 
     case Events::A32NX_FCU_TO_AP_VS_PUSH: {
       simInputAutopilot.VS_push = 1;
-      cout << "WASM: event triggered: A32NX_FCU_TO_AP_VS_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_TO_AP_VS_PUSH");
       break;
     }
+
     case Events::A32NX_FCU_TO_AP_VS_PULL: {
       simInputAutopilot.VS_pull = 1;
-      cout << "WASM: event triggered: A32NX_FCU_TO_AP_VS_PULL" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_TO_AP_VS_PULL");
       break;
     }
 
     case Events::A32NX_FCU_LOC_PUSH: {
       simInputAutopilot.LOC_push = 1;
-      cout << "WASM: event triggered: A32NX_FCU_LOC_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_LOC_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_APPR_PUSH: {
       simInputAutopilot.APPR_push = 1;
-      cout << "WASM: event triggered: A32NX_FCU_APPR_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_APPR_PUSH");
       break;
     }
 
     case Events::A32NX_FCU_EXPED_PUSH:
     case Events::AP_ATT_HOLD: {
       simInputAutopilot.EXPED_push = 1;
-      cout << "WASM: event triggered: A32NX_FCU_EXPED_PUSH" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FCU_EXPED_PUSH");
       break;
     }
 
     case Events::A32NX_FMGC_DIR_TO_TRIGGER: {
       simInputAutopilot.DIR_TO_trigger = 1;
-      cout << "WASM: event triggered: A32NX_FMGC_DIR_TO_TRIGGER" << endl;
+      LOG_INFO("WASM: event triggered: A32NX_FMGC_DIR_TO_TRIGGER");
       break;
     }
 
@@ -1740,31 +1709,31 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       // } else {
       //   execute_calculator_code("(>H:A320_Neo_FCU_SPEED_PULL)", nullptr, nullptr, nullptr);
       // }
-      cout << "WASM: event triggered: SPEED_SLOT_INDEX_SET: " << static_cast<long>(event->dwData) << endl;
+      LOG_INFO("WASM: event triggered: SPEED_SLOT_INDEX_SET: %ld", static_cast<long>(event->dwData));
       break;
     }
 
     case Events::AP_SPD_VAR_INC: {
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_INC)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: AP_SPD_VAR_INC" << endl;
+      LOG_INFO("WASM: event triggered: AP_SPD_VAR_INC");
       break;
     }
 
     case Events::AP_SPD_VAR_DEC: {
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_DEC)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: AP_SPD_VAR_DEC" << endl;
+      LOG_INFO("WASM: event triggered: AP_SPD_VAR_DEC");
       break;
     }
 
     case Events::AP_MACH_VAR_INC: {
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_INC)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: AP_MACH_VAR_INC" << endl;
+      LOG_INFO("WASM: event triggered: AP_MACH_VAR_INC");
       break;
     }
 
     case Events::AP_MACH_VAR_DEC: {
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_DEC)", nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: AP_MACH_VAR_DEC" << endl;
+      LOG_INFO("WASM: event triggered: AP_MACH_VAR_DEC");
       break;
     }
 
@@ -1775,7 +1744,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       // } else {
       //   execute_calculator_code("(>H:A320_Neo_FCU_VS_PULL)", nullptr, nullptr, nullptr);
       // }
-      cout << "WASM: event triggered: HEADING_SLOT_INDEX_SET: " << static_cast<long>(event->dwData) << endl;
+      LOG_INFO("WASM: event triggered: HEADING_SLOT_INDEX_SET: %ld", static_cast<long>(event->dwData));
       break;
     }
 
@@ -1783,7 +1752,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       execute_calculator_code(
           "(L:A32NX_TRK_FPA_MODE_ACTIVE, bool) 1 == if{ (>H:A320_Neo_FCU_HDG_INC_TRACK) } els{ (>H:A320_Neo_FCU_HDG_INC_HEADING) }",
           nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: HEADING_BUG_INC" << endl;
+      LOG_INFO("WASM: event triggered: HEADING_BUG_INC");
       break;
     }
 
@@ -1791,7 +1760,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       execute_calculator_code(
           "(L:A32NX_TRK_FPA_MODE_ACTIVE, bool) 1 == if{ (>H:A320_Neo_FCU_HDG_DEC_TRACK) } els{ (>H:A320_Neo_FCU_HDG_DEC_HEADING) }",
           nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: HEADING_BUG_DEC" << endl;
+      LOG_INFO("WASM: event triggered: HEADING_BUG_DEC");
       break;
     }
 
@@ -1802,7 +1771,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       // } else {
       //   execute_calculator_code("(>H:A320_Neo_FCU_ALT_PULL) (>H:A320_Neo_CDU_MODE_SELECTED_ALTITUDE)", nullptr, nullptr, nullptr);
       // }
-      cout << "WASM: event triggered: ALTITUDE_SLOT_INDEX_SET: " << static_cast<long>(event->dwData) << endl;
+      LOG_INFO("WASM: event triggered: ALTITUDE_SLOT_INDEX_SET: %ld", static_cast<long>(event->dwData));
       break;
     }
 
@@ -1812,7 +1781,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
           "(L:XMLVAR_Autopilot_Altitude_Increment) % - 49000 min (>K:2:AP_ALT_VAR_SET_ENGLISH) (>H:AP_KNOB_Up) "
           "(>H:A320_Neo_CDU_AP_INC_ALT)",
           nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: AP_ALT_VAR_INC" << endl;
+      LOG_INFO("WASM: event triggered: AP_ALT_VAR_INC");
       break;
     }
 
@@ -1822,7 +1791,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
           "(A:AUTOPILOT ALTITUDE LOCK VAR:3, feet) (L:XMLVAR_Autopilot_Altitude_Increment) % - (L:XMLVAR_Autopilot_Altitude_Increment) % "
           "+ 100 max (>K:2:AP_ALT_VAR_SET_ENGLISH) (>H:AP_KNOB_Down) (>H:A320_Neo_CDU_AP_DEC_ALT)",
           nullptr, nullptr, nullptr);
-      cout << "WASM: event triggered: AP_ALT_VAR_DEC" << endl;
+      LOG_INFO("WASM: event triggered: AP_ALT_VAR_DEC");
       break;
     }
 
@@ -1833,7 +1802,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       // } else {
       //   execute_calculator_code("(>H:A320_Neo_FCU_VS_PULL)", nullptr, nullptr, nullptr);
       // }
-      cout << "WASM: event triggered: VS_SLOT_INDEX_SET: " << static_cast<long>(event->dwData) << endl;
+      LOG_INFO("WASM: event triggered: VS_SLOT_INDEX_SET: %ld", static_cast<long>(event->dwData));
       break;
     }
 
@@ -1841,7 +1810,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       execute_calculator_code(
           "(L:A32NX_TRK_FPA_MODE_ACTIVE, bool) 1 == if{ (>H:A320_Neo_FCU_VS_INC_FPA) } els{ (>H:A320_Neo_FCU_VS_INC_VS) }", nullptr,
           nullptr, nullptr);
-      cout << "WASM: event triggered: AP_VS_VAR_INC" << endl;
+      LOG_INFO("WASM: event triggered: AP_VS_VAR_INC");
       break;
     }
 
@@ -1849,70 +1818,78 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       execute_calculator_code(
           "(L:A32NX_TRK_FPA_MODE_ACTIVE, bool) 1 == if{ (>H:A320_Neo_FCU_VS_DEC_FPA) } els{ (>H:A320_Neo_FCU_VS_DEC_VS) }", nullptr,
           nullptr, nullptr);
-      cout << "WASM: event triggered: AP_VS_VAR_DEC" << endl;
+      LOG_INFO("WASM: event triggered: AP_VS_VAR_DEC");
       break;
     }
 
     case Events::AP_APR_HOLD: {
       simInputAutopilot.APPR_push = 1;
-      cout << "WASM: event triggered: AP_APR_HOLD" << endl;
+      LOG_INFO("WASM: event triggered: AP_APR_HOLD");
       break;
     }
 
     case Events::AP_LOC_HOLD: {
       simInputAutopilot.LOC_push = 1;
-      cout << "WASM: event triggered: AP_LOC_HOLD" << endl;
+      LOG_INFO("WASM: event triggered: AP_LOC_HOLD");
       break;
     }
 
+    default:
+      break;
+  }
+}
+
+void SimConnectInterface::processThrottlesEvent(const SIMCONNECT_RECV_EVENT* event) {
+  // process depending on event id
+  switch (event->uEventID) {
     case Events::AUTO_THROTTLE_ARM: {
       simInputThrottles.ATHR_push = 1;
-      cout << "WASM: event triggered: AUTO_THROTTLE_ARM" << endl;
+      LOG_INFO("WASM: event triggered: AUTO_THROTTLE_ARM");
       break;
     }
 
     case Events::AUTO_THROTTLE_DISCONNECT: {
       simInputThrottles.ATHR_disconnect = 1;
-      cout << "WASM: event triggered: AUTO_THROTTLE_DISCONNECT" << endl;
+      LOG_INFO("WASM: event triggered: AUTO_THROTTLE_DISCONNECT");
       break;
     }
 
     case Events::A32NX_ATHR_RESET_DISABLE: {
       simInputThrottles.ATHR_reset_disable = 1;
-      cout << "WASM: event triggered: ATHR_RESET_DISABLE" << endl;
+      LOG_INFO("WASM: event triggered: ATHR_RESET_DISABLE");
       break;
     }
 
     case Events::AUTO_THROTTLE_TO_GA: {
       throttleAxis[0]->onEventThrottleFull();
       throttleAxis[1]->onEventThrottleFull();
-      cout << "WASM: event triggered: AUTO_THROTTLE_TO_GA (treated like THROTTLE_FULL)" << endl;
+      LOG_INFO("WASM: event triggered: AUTO_THROTTLE_TO_GA (treated like THROTTLE_FULL)");
       break;
     }
 
     case Events::A32NX_THROTTLE_MAPPING_SET_DEFAULTS: {
-      cout << "WASM: event triggered: THROTTLE_MAPPING_SET_DEFAULTS" << endl;
+      LOG_INFO("WASM: event triggered: THROTTLE_MAPPING_SET_DEFAULTS");
       throttleAxis[0]->applyDefaults();
       throttleAxis[1]->applyDefaults();
       break;
     }
 
     case Events::A32NX_THROTTLE_MAPPING_LOAD_FROM_FILE: {
-      cout << "WASM: event triggered: THROTTLE_MAPPING_LOAD_FROM_FILE" << endl;
+      LOG_INFO("WASM: event triggered: THROTTLE_MAPPING_LOAD_FROM_FILE");
       throttleAxis[0]->loadFromFile();
       throttleAxis[1]->loadFromFile();
       break;
     }
 
     case Events::A32NX_THROTTLE_MAPPING_LOAD_FROM_LOCAL_VARIABLES: {
-      cout << "WASM: event triggered: THROTTLE_MAPPING_LOAD_FROM_LOCAL_VARIABLES" << endl;
+      LOG_INFO("WASM: event triggered: THROTTLE_MAPPING_LOAD_FROM_LOCAL_VARIABLES");
       throttleAxis[0]->loadFromLocalVariables();
       throttleAxis[1]->loadFromLocalVariables();
       break;
     }
 
     case Events::A32NX_THROTTLE_MAPPING_SAVE_TO_FILE: {
-      cout << "WASM: event triggered: THROTTLE_MAPPING_SAVE_TO_FILE" << endl;
+      LOG_INFO("WASM: event triggered: THROTTLE_MAPPING_SAVE_TO_FILE");
       throttleAxis[0]->saveToFile();
       throttleAxis[1]->saveToFile();
       break;
@@ -1922,7 +1899,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleSet(static_cast<long>(event->dwData));
       throttleAxis[1]->onEventThrottleSet(static_cast<long>(event->dwData));
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_SET: " << static_cast<long>(event->dwData) << endl;
+        LOG_INFO("WASM: THROTTLE_SET: %ld", static_cast<long>(event->dwData));
       }
       break;
     }
@@ -1930,7 +1907,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE1_SET: {
       throttleAxis[0]->onEventThrottleSet(static_cast<long>(event->dwData));
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE1_SET: " << static_cast<long>(event->dwData) << endl;
+        LOG_INFO("WASM: THROTTLE1_SET: %ld", static_cast<long>(event->dwData));
       }
       break;
     }
@@ -1938,7 +1915,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE2_SET: {
       throttleAxis[1]->onEventThrottleSet(static_cast<long>(event->dwData));
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE2_SET: " << static_cast<long>(event->dwData) << endl;
+        LOG_INFO("WASM: THROTTLE2_SET: %ld", static_cast<long>(event->dwData));
       }
       break;
     }
@@ -1947,7 +1924,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleSet(static_cast<long>(event->dwData));
       throttleAxis[1]->onEventThrottleSet(static_cast<long>(event->dwData));
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_AXIS_SET_EX1: " << static_cast<long>(event->dwData) << endl;
+        LOG_INFO("WASM: THROTTLE_AXIS_SET_EX1: %ld", static_cast<long>(event->dwData));
       }
       break;
     }
@@ -1955,7 +1932,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE1_AXIS_SET_EX1: {
       throttleAxis[0]->onEventThrottleSet(static_cast<long>(event->dwData));
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE1_AXIS_SET_EX1: " << static_cast<long>(event->dwData) << endl;
+        LOG_INFO("WASM: THROTTLE1_AXIS_SET_EX1: %ld", static_cast<long>(event->dwData));
       }
       break;
     }
@@ -1963,7 +1940,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE2_AXIS_SET_EX1: {
       throttleAxis[1]->onEventThrottleSet(static_cast<long>(event->dwData));
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE2_AXIS_SET_EX1: " << static_cast<long>(event->dwData) << endl;
+        LOG_INFO("WASM: THROTTLE2_AXIS_SET_EX1: %ld", static_cast<long>(event->dwData));
       }
       break;
     }
@@ -1972,7 +1949,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleFull();
       throttleAxis[1]->onEventThrottleFull();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_FULL" << endl;
+        LOG_INFO("WASM: THROTTLE_FULL");
       }
       break;
     }
@@ -1981,7 +1958,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleCut();
       throttleAxis[1]->onEventThrottleCut();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_CUT" << endl;
+        LOG_INFO("WASM: THROTTLE_CUT");
       }
       break;
     }
@@ -1990,7 +1967,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleIncrease();
       throttleAxis[1]->onEventThrottleIncrease();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_INCR" << endl;
+        LOG_INFO("WASM: THROTTLE_INCR");
       }
       break;
     }
@@ -1999,7 +1976,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleDecrease();
       throttleAxis[1]->onEventThrottleDecrease();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_DECR" << endl;
+        LOG_INFO("WASM: THROTTLE_DECR");
       }
       break;
     }
@@ -2008,7 +1985,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleIncreaseSmall();
       throttleAxis[1]->onEventThrottleIncreaseSmall();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_INCR_SMALL" << endl;
+        LOG_INFO("WASM: THROTTLE_INCR_SMALL");
       }
       break;
     }
@@ -2017,7 +1994,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleDecreaseSmall();
       throttleAxis[1]->onEventThrottleDecreaseSmall();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_DECR_SMALL" << endl;
+        LOG_INFO("WASM: THROTTLE_DECR_SMALL");
       }
       break;
     }
@@ -2026,7 +2003,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleSet_10();
       throttleAxis[1]->onEventThrottleSet_10();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_10" << endl;
+        LOG_INFO("WASM: THROTTLE_10");
       }
       break;
     }
@@ -2035,7 +2012,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleSet_20();
       throttleAxis[1]->onEventThrottleSet_20();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_20" << endl;
+        LOG_INFO("WASM: THROTTLE_20");
       }
       break;
     }
@@ -2044,7 +2021,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleSet_30();
       throttleAxis[1]->onEventThrottleSet_30();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_30" << endl;
+        LOG_INFO("WASM: THROTTLE_30");
       }
       break;
     }
@@ -2053,7 +2030,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleSet_40();
       throttleAxis[1]->onEventThrottleSet_40();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_40" << endl;
+        LOG_INFO("WASM: THROTTLE_40");
       }
       break;
     }
@@ -2062,7 +2039,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleSet_50();
       throttleAxis[1]->onEventThrottleSet_50();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_50" << endl;
+        LOG_INFO("WASM: THROTTLE_50");
       }
       break;
     }
@@ -2071,7 +2048,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleSet_50();
       throttleAxis[1]->onEventThrottleSet_60();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_60" << endl;
+        LOG_INFO("WASM: THROTTLE_60");
       }
       break;
     }
@@ -2080,7 +2057,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleSet_70();
       throttleAxis[1]->onEventThrottleSet_70();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_70" << endl;
+        LOG_INFO("WASM: THROTTLE_70");
       }
       break;
     }
@@ -2089,7 +2066,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleSet_80();
       throttleAxis[1]->onEventThrottleSet_80();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_80" << endl;
+        LOG_INFO("WASM: THROTTLE_80");
       }
       break;
     }
@@ -2098,7 +2075,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventThrottleSet_90();
       throttleAxis[1]->onEventThrottleSet_90();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_90" << endl;
+        LOG_INFO("WASM: THROTTLE_90");
       }
       break;
     }
@@ -2106,7 +2083,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE1_FULL: {
       throttleAxis[0]->onEventThrottleFull();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE1_FULL" << endl;
+        LOG_INFO("WASM: THROTTLE1_FULL");
       }
       break;
     }
@@ -2114,7 +2091,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE1_CUT: {
       throttleAxis[0]->onEventThrottleCut();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE1_CUT" << endl;
+        LOG_INFO("WASM: THROTTLE1_CUT");
       }
       break;
     }
@@ -2122,7 +2099,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE1_INCR: {
       throttleAxis[0]->onEventThrottleIncrease();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE1_INCR" << endl;
+        LOG_INFO("WASM: THROTTLE1_INCR");
       }
       break;
     }
@@ -2130,7 +2107,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE1_DECR: {
       throttleAxis[0]->onEventThrottleDecrease();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE1_DECR" << endl;
+        LOG_INFO("WASM: THROTTLE1_DECR");
       }
       break;
     }
@@ -2138,7 +2115,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE1_INCR_SMALL: {
       throttleAxis[0]->onEventThrottleIncreaseSmall();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE1_INCR_SMALL" << endl;
+        LOG_INFO("WASM: THROTTLE1_INCR_SMALL");
       }
       break;
     }
@@ -2146,7 +2123,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE1_DECR_SMALL: {
       throttleAxis[0]->onEventThrottleDecreaseSmall();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE1_DECR_SMALL" << endl;
+        LOG_INFO("WASM: THROTTLE1_DECR_SMALL");
       }
       break;
     }
@@ -2154,7 +2131,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE2_FULL: {
       throttleAxis[1]->onEventThrottleFull();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE2_FULL" << endl;
+        LOG_INFO("WASM: THROTTLE2_FULL");
       }
       break;
     }
@@ -2162,7 +2139,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE2_CUT: {
       throttleAxis[1]->onEventThrottleCut();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE2_CUT" << endl;
+        LOG_INFO("WASM: THROTTLE2_CUT");
       }
       break;
     }
@@ -2170,7 +2147,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE2_INCR: {
       throttleAxis[1]->onEventThrottleIncrease();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE2_INCR" << endl;
+        LOG_INFO("WASM: THROTTLE2_INCR");
       }
       break;
     }
@@ -2178,7 +2155,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE2_DECR: {
       throttleAxis[1]->onEventThrottleDecrease();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE2_DECR" << endl;
+        LOG_INFO("WASM: THROTTLE2_DECR");
       }
       break;
     }
@@ -2186,7 +2163,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE2_INCR_SMALL: {
       throttleAxis[1]->onEventThrottleIncreaseSmall();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE2_INCR_SMALL" << endl;
+        LOG_INFO("WASM: THROTTLE2_INCR_SMALL");
       }
       break;
     }
@@ -2194,7 +2171,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::THROTTLE2_DECR_SMALL: {
       throttleAxis[1]->onEventThrottleDecreaseSmall();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE2_DECR_SMALL" << endl;
+        LOG_INFO("WASM: THROTTLE2_DECR_SMALL");
       }
       break;
     }
@@ -2203,29 +2180,33 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       throttleAxis[0]->onEventReverseToggle();
       throttleAxis[1]->onEventReverseToggle();
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_REVERSE_THRUST_TOGGLE" << endl;
+        LOG_INFO("WASM: THROTTLE_REVERSE_THRUST_TOGGLE");
       }
       break;
     }
+
     case Events::THROTTLE_REVERSE_THRUST_HOLD: {
       throttleAxis[0]->onEventReverseHold(static_cast<bool>(event->dwData));
       throttleAxis[1]->onEventReverseHold(static_cast<bool>(event->dwData));
       if (loggingThrottlesEnabled) {
-        cout << "WASM: THROTTLE_REVERSE_THRUST_HOLD: " << static_cast<long>(event->dwData) << endl;
+        LOG_INFO("WASM: THROTTLE_REVERSE_THRUST_HOLD: %ld", static_cast<long>(event->dwData));
       }
       break;
     }
 
+    default:
+      break;
+  }
+}
+
+void SimConnectInterface::processSpoilersEvent(const SIMCONNECT_RECV_EVENT* event) {
+  // process depending on event id
+  switch (event->uEventID) {
     case Events::SPOILERS_ON: {
       spoilersHandler->onEventSpoilersOn();
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: SPOILERS_ON: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << spoilersHandler->getHandlePosition();
-        cout << " / ";
-        cout << spoilersHandler->getIsArmed();
-        cout << endl;
+        LOG_INFO("WASM: SPOILERS_ON: (no data) -> %g / %d", spoilersHandler->getHandlePosition(),
+                 static_cast<int>(spoilersHandler->getIsArmed()));
       }
       break;
     }
@@ -2233,13 +2214,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::SPOILERS_OFF: {
       spoilersHandler->onEventSpoilersOff();
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: SPOILERS_OFF: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << spoilersHandler->getHandlePosition();
-        cout << " / ";
-        cout << spoilersHandler->getIsArmed();
-        cout << endl;
+        LOG_INFO("WASM: SPOILERS_OFF: (no data) -> %g / %d", spoilersHandler->getHandlePosition(),
+                 static_cast<int>(spoilersHandler->getIsArmed()));
       }
       break;
     }
@@ -2247,13 +2223,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::SPOILERS_TOGGLE: {
       spoilersHandler->onEventSpoilersToggle();
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: SPOILERS_TOGGLE: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << spoilersHandler->getHandlePosition();
-        cout << " / ";
-        cout << spoilersHandler->getIsArmed();
-        cout << endl;
+        LOG_INFO("WASM: SPOILERS_TOGGLE: (no data) -> %g / %d", spoilersHandler->getHandlePosition(),
+                 static_cast<int>(spoilersHandler->getIsArmed()));
       }
       break;
     }
@@ -2261,13 +2232,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::SPOILERS_SET: {
       spoilersHandler->onEventSpoilersSet(static_cast<long>(event->dwData));
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: SPOILERS_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << spoilersHandler->getHandlePosition();
-        cout << " / ";
-        cout << spoilersHandler->getIsArmed();
-        cout << endl;
+        LOG_INFO("WASM: SPOILERS_SET: %ld -> %g / %d", static_cast<long>(event->dwData), spoilersHandler->getHandlePosition(),
+                 static_cast<int>(spoilersHandler->getIsArmed()));
       }
       break;
     }
@@ -2275,13 +2241,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::AXIS_SPOILER_SET: {
       spoilersHandler->onEventSpoilersAxisSet(static_cast<long>(event->dwData));
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: AXIS_SPOILER_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << spoilersHandler->getHandlePosition();
-        cout << " / ";
-        cout << spoilersHandler->getIsArmed();
-        cout << endl;
+        LOG_INFO("WASM: AXIS_SPOILER_SET: %ld -> %g / %d", static_cast<long>(event->dwData), spoilersHandler->getHandlePosition(),
+                 static_cast<int>(spoilersHandler->getIsArmed()));
       }
       break;
     }
@@ -2289,13 +2250,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::SPOILERS_ARM_ON: {
       spoilersHandler->onEventSpoilersArmOn();
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: SPOILERS_ARM_ON: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << spoilersHandler->getHandlePosition();
-        cout << " / ";
-        cout << spoilersHandler->getIsArmed();
-        cout << endl;
+        LOG_INFO("WASM: SPOILERS_ARM_ON: (no data) -> %g / %d", spoilersHandler->getHandlePosition(),
+                 static_cast<int>(spoilersHandler->getIsArmed()));
       }
       break;
     }
@@ -2303,13 +2259,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::SPOILERS_ARM_OFF: {
       spoilersHandler->onEventSpoilersArmOff();
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: SPOILERS_ARM_OFF: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << spoilersHandler->getHandlePosition();
-        cout << " / ";
-        cout << spoilersHandler->getIsArmed();
-        cout << endl;
+        LOG_INFO("WASM: SPOILERS_ARM_OFF: (no data) -> %g / %d", spoilersHandler->getHandlePosition(),
+                 static_cast<int>(spoilersHandler->getIsArmed()));
       }
       break;
     }
@@ -2317,13 +2268,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::SPOILERS_ARM_TOGGLE: {
       spoilersHandler->onEventSpoilersArmToggle();
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: SPOILERS_ARM_TOGGLE: ";
-        cout << "(no data)";
-        cout << " -> ";
-        cout << spoilersHandler->getHandlePosition();
-        cout << " / ";
-        cout << spoilersHandler->getIsArmed();
-        cout << endl;
+        LOG_INFO("WASM: SPOILERS_ARM_TOGGLE: (no data) -> %g / %d", spoilersHandler->getHandlePosition(),
+                 static_cast<int>(spoilersHandler->getIsArmed()));
       }
       break;
     }
@@ -2331,17 +2277,20 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::SPOILERS_ARM_SET: {
       spoilersHandler->onEventSpoilersArmSet(static_cast<long>(event->dwData) == 1);
       if (loggingFlightControlsEnabled) {
-        cout << "WASM: SPOILERS_ARM_SET: ";
-        cout << static_cast<long>(event->dwData);
-        cout << " -> ";
-        cout << spoilersHandler->getHandlePosition();
-        cout << " / ";
-        cout << spoilersHandler->getIsArmed();
-        cout << endl;
+        LOG_INFO("WASM: SPOILERS_ARM_SET: %ld -> %g / %d", static_cast<long>(event->dwData), spoilersHandler->getHandlePosition(),
+                 static_cast<int>(spoilersHandler->getIsArmed()));
       }
       break;
     }
 
+    default:
+      break;
+  }
+}
+
+void SimConnectInterface::processSimulationRateEvent(const SIMCONNECT_RECV_EVENT* event) {
+  // process depending on event id
+  switch (event->uEventID) {
     case Events::SIM_RATE_INCR: {
       // calculate frame rate that will be seen by FBW / AP
       double theoreticalFrameRate = (1 / sampleTime) / (simData.simulation_rate * 2);
@@ -2349,13 +2298,11 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
       if ((simData.simulation_rate < maxSimulationRate && theoreticalFrameRate >= 8) || simData.simulation_rate < 1 ||
           !limitSimulationRateByPerformance) {
         sendEvent(Events::SIM_RATE_INCR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
-        cout << "WASM: Simulation rate " << simData.simulation_rate;
-        cout << " -> " << simData.simulation_rate * 2;
-        cout << " (theoretical fps " << theoreticalFrameRate << ")" << endl;
+        LOG_INFO("WASM: Simulation rate %g -> %g (theoretical fps %g)", simData.simulation_rate, simData.simulation_rate * 2,
+                 theoreticalFrameRate);
       } else {
-        cout << "WASM: Simulation rate " << simData.simulation_rate;
-        cout << " -> " << simData.simulation_rate;
-        cout << " (limited by max sim rate or theoretical fps " << theoreticalFrameRate << ")" << endl;
+        LOG_INFO("WASM: Simulation rate %g -> %g (limited by max sim rate or theoretical fps %g)", simData.simulation_rate,
+                 simData.simulation_rate, theoreticalFrameRate);
       }
       break;
     }
@@ -2363,13 +2310,9 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::SIM_RATE_DECR: {
       if (simData.simulation_rate > minSimulationRate) {
         sendEvent(Events::SIM_RATE_DECR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
-        cout << "WASM: Simulation rate " << simData.simulation_rate;
-        cout << " -> " << simData.simulation_rate / 2;
-        cout << endl;
+        LOG_INFO("WASM: Simulation rate %g -> %g", simData.simulation_rate, simData.simulation_rate / 2);
       } else {
-        cout << "WASM: Simulation rate " << simData.simulation_rate;
-        cout << " -> " << simData.simulation_rate;
-        cout << " (limited by min sim rate)" << endl;
+        LOG_INFO("WASM: Simulation rate %g -> %g (limited by min sim rate)", simData.simulation_rate, simData.simulation_rate);
       }
       break;
     }
@@ -2377,7 +2320,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::SIM_RATE_SET: {
       long targetSimulationRate = min(maxSimulationRate, max(1, static_cast<long>(event->dwData)));
       sendEvent(Events::SIM_RATE_SET, targetSimulationRate, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
-      cout << "WASM: Simulation Rate set to " << targetSimulationRate << endl;
+      LOG_INFO("WASM: Simulation Rate set to %ld", targetSimulationRate);
       break;
     }
 
@@ -2389,15 +2332,31 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
 void SimConnectInterface::simConnectProcessSimObjectData(const SIMCONNECT_RECV_SIMOBJECT_DATA* data) {
   // process depending on request id
   switch (data->dwRequestID) {
-    case 0:
-      // store aircraft data
-      simData = *((SimData*)&data->dwData);
+    case SIM_DATA_DEFINITION_FAST:
+      // store fast moving aircraft data, it belongs to the current simulation frame
+      storeSimDataFields(simDataFieldsFast, data, false);
+      simDataAge = 0;
+      return;
+
+    case SIM_DATA_DEFINITION_SLOW:
+      // store slow moving aircraft data
+      storeSimDataFields(simDataFieldsSlow, data, simDataSlowChangedOnly);
+      simDataSlowAge = 0;
       return;
 
     default:
+      if (data->dwRequestID >= SIM_DATA_REQUEST_ONCE_FIRST &&
+          data->dwRequestID < SIM_DATA_REQUEST_ONCE_FIRST + SIM_DATA_REQUEST_ONCE_COUNT) {
+        // store aircraft data
+        simData = *((SimData*)&data->dwData);
+        // the reply may belong to the request of an earlier frame
+        uint32_t requestIndex = data->dwRequestID - SIM_DATA_REQUEST_ONCE_FIRST;
+        simDataAge = (simDataRequestCounter - 1 - requestIndex) % SIM_DATA_REQUEST_ONCE_COUNT;
+        simDataSlowAge = simDataAge;
+        return;
+      }
       // print unknown request id
-      cout << "WASM: Unknown request id in SimConnect connection: ";
-      cout << data->dwRequestID << endl;
+      LOG_ERROR("WASM: Unknown request id in SimConnect connection: %lu", static_cast<unsigned long>(data->dwRequestID));
       return;
   }
 }
@@ -2427,8 +2386,7 @@ void SimConnectInterface::simConnectProcessClientData(const SIMCONNECT_RECV_CLIE
 
     default:
       // print unknown request id
-      cout << "WASM: Unknown request id in SimConnect connection: ";
-      cout << data->dwRequestID << endl;
+      LOG_ERROR("WASM: Unknown request id in SimConnect connection: %lu", static_cast<unsigned long>(data->dwRequestID));
       return;
   }
 }
@@ -2441,7 +2399,25 @@ bool SimConnectInterface::sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD
 
   // check if client data is enabled
   if (!clientDataEnabled) {
-    cout << "WASM: Client data is disabled but tried to write it!";
+    LOG_WARNING("WASM: Client data is disabled but tried to write it!");
+    return true;
+  }
+
+  // time since last write of this area
+  SentClientData* sent = (id < NUMBER_OF_CLIENT_DATA && size <= MAXIMUM_CLIENT_DATA_SIZE) ? &sentClientData[id] : nullptr;
+  if (sent) {
+    sent->timeSinceLastSend += sampleTime;
+  }
+
+  // check if publishing is currently throttled
+  if (!clientDataPublishingEnabled) {
+    return true;
+  }
+
+  // skip unchanged data, it is written again after the heartbeat period so that clients can recover
+  if (clientDataChangedOnly && sent && sent->isValid && sent->timeSinceLastSend < clientDataHeartbeatPeriod &&
+      memcmp(sent->data, data, size) == 0) {
+    clientDataBytesSuppressedInFrame += size;
     return true;
   }
 
@@ -2454,6 +2430,14 @@ bool SimConnectInterface::sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD
     return false;
   }
 
+  // remember written data
+  if (sent) {
+    memcpy(sent->data, data, size);
+    sent->isValid = true;
+    sent->timeSinceLastSend = 0;
+  }
+  clientDataBytesSentInFrame += size;
+
   // success
   return true;
 }
@@ -2489,6 +2473,52 @@ bool SimConnectInterface::addDataDefinition(const HANDLE connectionHandle,
   return (result == S_OK);
 }
 
+bool SimConnectInterface::addSimDataDefinition(const SimDataFieldDefinition& field) {
+  // complete sim data for request mode
+  bool result = addDataDefinition(hSimConnect, 0, field.type, field.name, field.unit);
+
+  // fast or slow part for subscription mode, the datum id is the index into the field list
+  vector<SimDataField>& fields = (field.group == SIM_DATA_FAST) ? simDataFieldsFast : simDataFieldsSlow;
+  SIMCONNECT_DATA_DEFINITION_ID id = (field.group == SIM_DATA_FAST) ? SIM_DATA_DEFINITION_FAST : SIM_DATA_DEFINITION_SLOW;
+  HRESULT addResult = SimConnect_AddToDataDefinition(hSimConnect, id, field.name,
+                                                     SimConnectInterface::isSimConnectDataTypeStruct(field.type) ? nullptr : field.unit,
+                                                     field.type, 0, static_cast<DWORD>(fields.size()));
+
+  // remember location of field within sim data
+  fields.push_back({field.offset, field.size});
+
+  return result && (addResult == S_OK);
+}
+
+void SimConnectInterface::storeSimDataFields(const vector<SimDataField>& fields,
+                                             const SIMCONNECT_RECV_SIMOBJECT_DATA* data,
+                                             bool isTagged) {
+  char* target = reinterpret_cast<char*>(&simData);
+  const char* source = reinterpret_cast<const char*>(&data->dwData);
+
+  // untagged data contains all fields of the definition in order
+  if (!isTagged) {
+    for (const auto& field : fields) {
+      memcpy(target + field.offset, source, field.size);
+      source += field.size;
+    }
+    return;
+  }
+
+  // tagged data is a packed sequence of datum id and value for each changed field
+  for (DWORD i = 0; i < data->dwDefineCount; i++) {
+    DWORD datumId;
+    memcpy(&datumId, source, sizeof(DWORD));
+    source += sizeof(DWORD);
+    if (datumId >= fields.size()) {
+      LOG_ERROR("WASM: Unknown datum id in sim data: %lu", static_cast<unsigned long>(datumId));
+      return;
+    }
+    memcpy(target + fields[datumId].offset, source, fields[datumId].size);
+    source += fields[datumId].size;
+  }
+}
+
 bool SimConnectInterface::addInputDataDefinition(const HANDLE connectionHandle,
                                                  const SIMCONNECT_DATA_DEFINITION_ID groupId,
                                                  const SIMCONNECT_CLIENT_EVENT_ID eventId,
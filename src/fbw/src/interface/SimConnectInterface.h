@@ -2,6 +2,7 @@
 
 #include <MSFS/Legacy/gauges.h>
 #include <SimConnect.h>
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -175,6 +176,7 @@ class SimConnectInterface {
     SIM_RATE_INCR,
     SIM_RATE_DECR,
     SIM_RATE_SET,
+    NUMBER_OF_EVENTS
   };
 
   SimConnectInterface() = default;
@@ -195,7 +197,11 @@ class SimConnectInterface {
                bool disableXboxCompatibilityRudderPlusMinus,
                double minSimulationRate,
                double maxSimulationRate,
-               bool limitSimulationRateByPerformance);
+               bool limitSimulationRateByPerformance,
+               bool simDataSubscriptionEnabled,
+               bool simDataSlowChangedOnly,
+               bool clientDataChangedOnly,
+               double clientDataHeartbeatPeriod);
 
   void disconnect();
 
@@ -231,30 +237,46 @@ class SimConnectInterface {
 
   bool setClientDataLocalVariablesAutothrust(ClientDataLocalVariablesAutothrust output);
 
+  // when disabled, writing client data is skipped (used to throttle publishing under load)
+  void setClientDataPublishingEnabled(bool enabled);
+
+  // number of client data bytes written in this frame and how many were not written because they did not change
+  uint32_t getNumberOfClientDataBytesSentInFrame() const;
+  uint32_t getNumberOfClientDataBytesSuppressedInFrame() const;
+
   void resetSimInputAutopilot();
 
   void resetSimInputThrottles();
 
-  SimData getSimData();
+  const SimData& getSimData() const;
+
+  const SimInput& getSimInput() const;
+
+  const SimInputAutopilot& getSimInputAutopilot() const;
 
-  SimInput getSimInput();
+  const SimInputThrottles& getSimInputThrottles() const;
 
-  SimInputAutopilot getSimInputAutopilot();
+  // age of the sim data used in this frame in frames (0 = received for this frame)
+  uint32_t getSimDataAge() const;
+  // frames since the slow group of the sim data was last received
+  uint32_t getSimDataSlowAge() const;
 
-  SimInputThrottles getSimInputThrottles();
+  // events received in the last call of readData() and how many of them were superseded by a later axis event
+  uint32_t getNumberOfEventsInFrame() const;
+  uint32_t getNumberOfCoalescedEventsInFrame() const;
 
   bool setClientDataAutopilotStateMachine(ClientDataAutopilotStateMachine output);
-  ClientDataAutopilotStateMachine getClientDataAutopilotStateMachine();
+  const ClientDataAutopilotStateMachine& getClientDataAutopilotStateMachine() const;
 
   bool setClientDataAutopilotLaws(ClientDataAutopilotLaws output);
-  ClientDataAutopilotLaws getClientDataAutopilotLaws();
+  const ClientDataAutopilotLaws& getClientDataAutopilotLaws() const;
 
-  ClientDataAutothrust getClientDataAutothrust();
+  const ClientDataAutothrust& getClientDataAutothrust() const;
 
   bool setClientDataFlyByWireInput(ClientDataFlyByWireInput output);
 
   bool setClientDataFlyByWire(ClientDataFlyByWire output);
-  ClientDataFlyByWire getClientDataFlyByWire();
+  const ClientDataFlyByWire& getClientDataFlyByWire() const;
 
   void setLoggingFlightControlsEnabled(bool enabled);
   bool getLoggingFlightControlsEnabled();
@@ -276,8 +298,56 @@ class SimConnectInterface {
     FLY_BY_WIRE,
     LOCAL_VARIABLES,
     LOCAL_VARIABLES_AUTOTHRUST,
+    NUMBER_OF_CLIENT_DATA
+  };
+
+  enum CoalescedAxis {
+    AXIS_NOT_COALESCED = -1,
+    COALESCED_AXIS_ELEVATOR,
+    COALESCED_AXIS_AILERONS,
+    COALESCED_AXIS_RUDDER,
+    COALESCED_AXIS_THROTTLES,
+    COALESCED_AXIS_THROTTLE_1,
+    COALESCED_AXIS_THROTTLE_2,
+    NUMBER_OF_COALESCED_AXES
+  };
+
+  struct EventHandler {
+    void (SimConnectInterface::*process)(const SIMCONNECT_RECV_EVENT* event);
+    CoalescedAxis axis;
+  };
+
+  struct PendingAxisEvent {
+    bool isPending;
+    uint64_t sequence;
+    SIMCONNECT_RECV_EVENT event;
+  };
+
+  struct SimDataField {
+    size_t offset;
+    size_t size;
+  };
+
+  // size of the largest client data area
+  static constexpr size_t MAXIMUM_CLIENT_DATA_SIZE = std::max({sizeof(ClientDataAutopilotStateMachine), sizeof(ClientDataAutopilotLaws),
+                                                               sizeof(ClientDataAutothrust), sizeof(ClientDataFlyByWireInput),
+                                                               sizeof(ClientDataFlyByWire), sizeof(ClientDataLocalVariables),
+                                                               sizeof(ClientDataLocalVariablesAutothrust)});
+
+  // copy of the client data last written to an area
+  struct SentClientData {
+    bool isValid;
+    double timeSinceLastSend;
+    char data[MAXIMUM_CLIENT_DATA_SIZE];
   };
 
+  // definition and request ids of the sim data subscription (definition 0 holds the complete sim data)
+  static constexpr SIMCONNECT_DATA_DEFINITION_ID SIM_DATA_DEFINITION_FAST = 10;
+  static constexpr SIMCONNECT_DATA_DEFINITION_ID SIM_DATA_DEFINITION_SLOW = 11;
+  // request ids used in request mode rotate through this range so that late replies can be detected
+  static constexpr SIMCONNECT_DATA_REQUEST_ID SIM_DATA_REQUEST_ONCE_FIRST = 100;
+  static constexpr uint32_t SIM_DATA_REQUEST_ONCE_COUNT = 16;
+
   bool isConnected = false;
   HANDLE hSimConnect = 0;
 
@@ -287,6 +357,27 @@ class SimConnectInterface {
   double maxSimulationRate = 0;
   bool limitSimulationRateByPerformance = true;
   bool clientDataEnabled = false;
+  bool clientDataPublishingEnabled = true;
+  bool clientDataChangedOnly = true;
+  double clientDataHeartbeatPeriod = 1.0;
+  SentClientData sentClientData[NUMBER_OF_CLIENT_DATA] = {};
+  uint32_t clientDataBytesSentInFrame = 0;
+  uint32_t clientDataBytesSuppressedInFrame = 0;
+
+  bool simDataSubscriptionEnabled = false;
+  bool simDataSlowChangedOnly = true;
+  bool isSimDataSubscribed = false;
+  uint32_t simDataRequestCounter = 0;
+  uint32_t simDataAge = 0;
+  uint32_t simDataSlowAge = 0;
+  std::vector<SimDataField> simDataFieldsFast;
+  std::vector<SimDataField> simDataFieldsSlow;
+
+  EventHandler eventHandlers[NUMBER_OF_EVENTS] = {};
+  PendingAxisEvent pendingAxisEvents[NUMBER_OF_COALESCED_AXES] = {};
+  uint64_t pendingAxisEventSequence = 0;
+  uint32_t eventsInFrame = 0;
+  uint32_t coalescedEventsInFrame = 0;
 
   // change to non-static when aileron events can be processed via SimConnect
   static bool loggingFlightControlsEnabled;
@@ -319,8 +410,16 @@ class SimConnectInterface {
   std::unique_ptr<LocalVariable> idFcuEventSetHDG;
   std::unique_ptr<LocalVariable> idFcuEventSetVS;
 
+  void prepareEventHandlers();
+
   bool prepareSimDataSimConnectDataDefinitions();
 
+  bool addSimDataDefinition(const SimDataFieldDefinition& field);
+
+  bool subscribeSimData();
+
+  void storeSimDataFields(const std::vector<SimDataField>& fields, const SIMCONNECT_RECV_SIMOBJECT_DATA* data, bool isTagged);
+
   bool prepareSimInputSimConnectDataDefinitions();
 
   bool prepareSimOutputSimConnectDataDefinitions();
@@ -331,6 +430,18 @@ class SimConnectInterface {
 
   void simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* event);
 
+  void applyPendingAxisEvents();
+
+  void processFlightControlsEvent(const SIMCONNECT_RECV_EVENT* event);
+
+  void processAutopilotEvent(const SIMCONNECT_RECV_EVENT* event);
+
+  void processThrottlesEvent(const SIMCONNECT_RECV_EVENT* event);
+
+  void processSpoilersEvent(const SIMCONNECT_RECV_EVENT* event);
+
+  void processSimulationRateEvent(const SIMCONNECT_RECV_EVENT* event);
+
   void simConnectProcessSimObjectData(const SIMCONNECT_RECV_SIMOBJECT_DATA* data);
 
   void simConnectProcessClientData(const SIMCONNECT_RECV_CLIENT_DATA* data);
@@ -352,5 +463,6 @@ class SimConnectInterface {
 
   static bool isSimConnectDataTypeStruct(SIMCONNECT_DATATYPE dataType);
 
+
   static std::string getSimConnectExceptionString(SIMCONNECT_EXCEPTION exception);
 };
@@ -499,34 +499,22 @@ void AutopilotLawsModelClass::step()
       AutopilotLaws_U.in.data.bz_m_s2;
   }
 
+  GeodesyKernel::update(AutopilotLaws_U.in.data.aircraft_position.lat, AutopilotLaws_U.in.data.aircraft_position.lon,
+                        aircraftPoint);
+  GeodesyKernel::update(AutopilotLaws_U.in.data.nav_loc_position.lat, AutopilotLaws_U.in.data.nav_loc_position.lon,
+                        navLocPoint);
+  GeodesyKernel::update(AutopilotLaws_U.in.data.nav_gs_position.lat, AutopilotLaws_U.in.data.nav_gs_position.lon,
+                        navGsPoint);
+  distance_m = geodesyKernel.distance(aircraftPoint, navLocPoint);
+  a = AutopilotLaws_U.in.data.aircraft_position.alt - AutopilotLaws_U.in.data.nav_loc_position.alt;
   if (AutopilotLaws_U.in.data.nav_dme_valid != 0.0) {
     rtb_dme = AutopilotLaws_U.in.data.nav_dme_nmi;
   } else if (AutopilotLaws_U.in.data.nav_loc_valid) {
-    a = std::sin((AutopilotLaws_U.in.data.nav_loc_position.lat - AutopilotLaws_U.in.data.aircraft_position.lat) *
-                 0.017453292519943295 / 2.0);
-    distance_m = std::sin((AutopilotLaws_U.in.data.nav_loc_position.lon - AutopilotLaws_U.in.data.aircraft_position.lon)
-                          * 0.017453292519943295 / 2.0);
-    a = std::cos(0.017453292519943295 * AutopilotLaws_U.in.data.aircraft_position.lat) * std::cos(0.017453292519943295 *
-      AutopilotLaws_U.in.data.nav_loc_position.lat) * distance_m * distance_m + a * a;
-    rtb_dme = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
-    distance_m = AutopilotLaws_U.in.data.aircraft_position.alt - AutopilotLaws_U.in.data.nav_loc_position.alt;
-    rtb_dme = std::sqrt(rtb_dme * rtb_dme + distance_m * distance_m) / 1852.0;
+    rtb_dme = std::sqrt(distance_m * distance_m + a * a) / 1852.0;
   } else {
     rtb_dme = 0.0;
   }
 
-  rtb_error_d = 0.017453292519943295 * AutopilotLaws_U.in.data.aircraft_position.lat;
-  Phi2 = 0.017453292519943295 * AutopilotLaws_U.in.data.nav_loc_position.lat;
-  rtb_Saturation = 0.017453292519943295 * AutopilotLaws_U.in.data.aircraft_position.lon;
-  a = std::sin((AutopilotLaws_U.in.data.nav_loc_position.lat - AutopilotLaws_U.in.data.aircraft_position.lat) *
-               0.017453292519943295 / 2.0);
-  distance_m = std::sin((AutopilotLaws_U.in.data.nav_loc_position.lon - AutopilotLaws_U.in.data.aircraft_position.lon) *
-                        0.017453292519943295 / 2.0);
-  a = std::cos(rtb_error_d) * std::cos(Phi2) * distance_m * distance_m + a * a;
-  distance_m = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
-  a = AutopilotLaws_U.in.data.aircraft_position.alt - AutopilotLaws_U.in.data.nav_loc_position.alt;
-  R = std::cos(Phi2);
-  L = 0.017453292519943295 * AutopilotLaws_U.in.data.nav_loc_position.lon - rtb_Saturation;
   b_L = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(360.0) + 360.0) - (mod_mvZvttxs(mod_mvZvttxs
     (AutopilotLaws_U.in.data.nav_loc_magvar_deg) + 360.0) + 360.0)) + 360.0);
   b_R = mod_mvZvttxs(360.0 - b_L);
@@ -534,10 +522,8 @@ void AutopilotLawsModelClass::step()
     b_R = -b_L;
   }
 
-  rtb_Sum_if = std::cos(rtb_error_d);
-  rtb_error_d = std::sin(rtb_error_d);
-  R = mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(std::atan2(std::sin(L) * R, rtb_Sum_if * std::sin(Phi2) - rtb_error_d * R *
-    std::cos(L)) * 57.295779513082323 + 360.0)) + 360.0) + 360.0;
+  R = mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(geodesyKernel.bearing(aircraftPoint, navLocPoint) + 360.0)) + 360.0) +
+    360.0;
   Phi2 = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(AutopilotLaws_U.in.data.nav_loc_deg - b_R) +
     360.0)) + 360.0) - R) + 360.0);
   b_R = mod_mvZvttxs(360.0 - Phi2);
@@ -573,19 +559,10 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_DWork.nav_gs_deg_not_empty = true;
   }
 
-  Phi2 = 0.017453292519943295 * AutopilotLaws_U.in.data.nav_gs_position.lat;
-  a = std::sin((AutopilotLaws_U.in.data.nav_gs_position.lat - AutopilotLaws_U.in.data.aircraft_position.lat) *
-               0.017453292519943295 / 2.0);
-  distance_m = std::sin((AutopilotLaws_U.in.data.nav_gs_position.lon - AutopilotLaws_U.in.data.aircraft_position.lon) *
-                        0.017453292519943295 / 2.0);
-  R = std::cos(Phi2);
-  a = rtb_Sum_if * R * distance_m * distance_m + a * a;
-  distance_m = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
+  distance_m = geodesyKernel.distance(aircraftPoint, navGsPoint);
   a = AutopilotLaws_U.in.data.aircraft_position.alt - AutopilotLaws_U.in.data.nav_gs_position.alt;
   distance_m = std::sqrt(distance_m * distance_m + a * a);
-  rtb_Saturation = 0.017453292519943295 * AutopilotLaws_U.in.data.nav_gs_position.lon - rtb_Saturation;
-  rtb_Saturation = std::atan2(std::sin(rtb_Saturation) * R, rtb_Sum_if * std::sin(Phi2) - rtb_error_d * R * std::cos
-    (rtb_Saturation)) * 57.295779513082323;
+  rtb_Saturation = geodesyKernel.bearing(aircraftPoint, navGsPoint);
   if (rtb_Saturation + 360.0 == 0.0) {
     rtb_error_d = 0.0;
   } else {
@@ -664,7 +641,7 @@ void AutopilotLawsModelClass::step()
          (AutopilotLaws_U.in.data.nav_gs_position.lon != 0.0) || (AutopilotLaws_U.in.data.nav_gs_position.alt != 0.0)))
     {
       rtb_valid_d = true;
-      rtb_error_d = std::asin(a / distance_m) * 57.295779513082323 - AutopilotLaws_DWork.nav_gs_deg;
+      rtb_error_d = geodesyKernel.elevation(a, distance_m) - AutopilotLaws_DWork.nav_gs_deg;
     } else {
       guard1 = true;
     }
@@ -2387,7 +2364,12 @@ AutopilotLawsModelClass::AutopilotLawsModelClass():
   AutopilotLaws_U(),
   AutopilotLaws_Y(),
   AutopilotLaws_B(),
-  AutopilotLaws_DWork()
+  AutopilotLaws_DWork(),
+  AutopilotLaws_P(AutopilotLaws_rtP),
+  geodesyKernel(),
+  aircraftPoint(),
+  navLocPoint(),
+  navGsPoint()
 {
 }
 
@@ -3,6 +3,7 @@
 #include <cmath>
 #include "rtwtypes.h"
 #include "AutopilotLaws_types.h"
+#include "../GeodesyKernel.h"
 
 class AutopilotLawsModelClass
 {
@@ -868,6 +869,22 @@ class AutopilotLawsModelClass
     return AutopilotLaws_Y;
   }
 
+  const Parameters_AutopilotLaws_T &getParameters() const
+  {
+    return AutopilotLaws_P;
+  }
+
+  void setParameters(const Parameters_AutopilotLaws_T *pParameters_AutopilotLaws_T)
+  {
+    AutopilotLaws_P = *pParameters_AutopilotLaws_T;
+  }
+
+  // the radio navigation geometry uses the approximate geodesy kernels (bounded error instead of bit-identical outputs)
+  void setGeodesyApproximation(boolean_T enabled)
+  {
+    geodesyKernel.setApproximation(enabled);
+  }
+
   void initialize();
   void step();
   static void terminate();
@@ -878,7 +895,12 @@ class AutopilotLawsModelClass
   ExternalOutputs_AutopilotLaws_T AutopilotLaws_Y;
   BlockIO_AutopilotLaws_T AutopilotLaws_B;
   D_Work_AutopilotLaws_T AutopilotLaws_DWork;
-  static Parameters_AutopilotLaws_T AutopilotLaws_P;
+  Parameters_AutopilotLaws_T AutopilotLaws_P;
+  static const Parameters_AutopilotLaws_T AutopilotLaws_rtP;
+  GeodesyKernel geodesyKernel;
+  GeodesyPoint aircraftPoint;
+  GeodesyPoint navLocPoint;
+  GeodesyPoint navGsPoint;
   static void AutopilotLaws_MATLABFunction(real_T rtu_tau, real_T rtu_zeta, real_T *rty_k2, real_T *rty_k1);
   static void AutopilotLaws_LagFilter(real_T rtu_U, real_T rtu_C1, real_T rtu_dt, real_T *rty_Y,
     rtDW_LagFilter_AutopilotLaws_T *localDW);
@@ -2590,142 +2590,11 @@ void AutopilotStateMachineModelClass::AutopilotStateMachine_SRS_GA_during(void)
   AutopilotStateMachine_DWork.wereAllEnginesOperative_h = allEnginesOperative;
 }
 
-void AutopilotStateMachineModelClass::step()
+void AutopilotStateMachineModelClass::AutopilotStateMachine_NavDistance(void)
 {
-  static const real_T c[24]{ -3.7631613045100394E-12, -3.7631613045100418E-12, 6.2076488130688133E-12,
-    2.3375903616618146E-12, -2.9675180723323623E-12, -2.9675180723323619E-12, 2.2735910872868498E-8,
-    1.1446426959338374E-8, -1.4891939010927404E-8, -2.4704337359767112E-9, 1.1555108433994175E-8, -6.25E-9,
-    -1.897274956835846E-5, 1.520958826384842E-5, 7.1712086474912069E-6, -4.4094939746938354E-6, 1.3759855421341094E-5,
-    2.4370072289329445E-5, 0.05, 0.05, 0.1, 0.1, 0.1, 0.15 };
-
-  static const int16_T b[7]{ 0, 1000, 3333, 4000, 6000, 8000, 10000 };
-
-  uint64m_T tmp;
-  uint64m_T tmp_0;
-  uint64m_T tmp_1;
-  uint64m_T tmp_2;
-  uint64m_T tmp_3;
-  uint64m_T tmp_4;
-  uint64m_T tmp_5;
-  uint64m_T tmp_6;
-  uint64m_T tmp_7;
-  uint64m_T tmp_8;
-  real_T result_tmp[9];
-  real_T result[3];
-  real_T result_0[3];
   real_T L;
-  real_T Phi2;
-  real_T R;
   real_T a;
-  real_T a_tmp;
-  real_T a_tmp_0;
-  real_T b_L;
-  real_T b_R;
-  real_T rtb_Divide_o;
-  real_T rtb_GainTheta;
-  real_T rtb_GainTheta1;
-  real_T rtb_Saturation1;
   real_T rtb_dme;
-  int32_T high_i;
-  int32_T low_i;
-  int32_T low_ip1;
-  int32_T mid_i;
-  int32_T rtb_on_ground;
-  boolean_T conditionSoftAlt;
-  boolean_T engageCondition;
-  boolean_T guard1{ false };
-
-  boolean_T isGoAroundModeActive;
-  boolean_T rtb_AND;
-  boolean_T rtb_AND_j;
-  boolean_T rtb_BusAssignment1_data_altimeter_setting_changed;
-  boolean_T rtb_BusAssignment1_input_LOC_push;
-  boolean_T rtb_BusConversion_InsertedFor_BusAssignment_at_inport_2_BusCreator1_APPR_push;
-  boolean_T rtb_FixPtRelationalOperator;
-  boolean_T rtb_Y_j;
-  boolean_T rtb_cFLARE;
-  boolean_T rtb_cGA;
-  boolean_T rtb_cLAND;
-  boolean_T sCLB_tmp;
-  boolean_T sCLB_tmp_0;
-  boolean_T speedTargetChanged;
-  boolean_T state_e_tmp;
-  boolean_T state_e_tmp_0;
-  boolean_T state_i_tmp;
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_a = (static_cast<int32_T>
-    (AutopilotStateMachine_U.in.input.AP_ENGAGE_push) > static_cast<int32_T>
-    (AutopilotStateMachine_DWork.DelayInput1_DSTATE_a));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_p = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.AP_1_push) >
-    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_p));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_bo = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.AP_2_push) >
-    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_bo));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_d = (static_cast<int32_T>
-    (AutopilotStateMachine_U.in.input.AP_DISCONNECT_push) > static_cast<int32_T>
-    (AutopilotStateMachine_DWork.DelayInput1_DSTATE_d));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_e = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.HDG_push) >
-    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_e));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_g = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.HDG_pull) >
-    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_g));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_f = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.ALT_push) >
-    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_f));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_ib = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.ALT_pull) >
-    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_ib));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_bd = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.VS_push) >
-    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_bd));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_ah = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.VS_pull) >
-    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_ah));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_fn = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.LOC_push) >
-    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_fn));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_h = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.APPR_push) >
-    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_h));
-  AutopilotStateMachine_DWork.DelayInput1_DSTATE_o = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.EXPED_push) >
-    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_o));
-  rtb_BusConversion_InsertedFor_BusAssignment_at_inport_2_BusCreator1_APPR_push =
-    AutopilotStateMachine_DWork.DelayInput1_DSTATE_h;
-  AutopilotStateMachine_B.BusAssignment_g.input.EXPED_push = AutopilotStateMachine_DWork.DelayInput1_DSTATE_o;
-  rtb_GainTheta = AutopilotStateMachine_P.GainTheta_Gain * AutopilotStateMachine_U.in.data.Theta_deg;
-  rtb_GainTheta1 = AutopilotStateMachine_P.GainTheta1_Gain * AutopilotStateMachine_U.in.data.Phi_deg;
-  rtb_dme = 0.017453292519943295 * rtb_GainTheta;
-  rtb_Saturation1 = 0.017453292519943295 * rtb_GainTheta1;
-  rtb_Divide_o = std::tan(rtb_dme);
-  R = std::sin(rtb_Saturation1);
-  a_tmp = std::cos(rtb_Saturation1);
-  result_tmp[0] = 1.0;
-  result_tmp[3] = R * rtb_Divide_o;
-  result_tmp[6] = a_tmp * rtb_Divide_o;
-  result_tmp[1] = 0.0;
-  result_tmp[4] = a_tmp;
-  result_tmp[7] = -R;
-  result_tmp[2] = 0.0;
-  rtb_Saturation1 = std::cos(rtb_dme);
-  rtb_Divide_o = 1.0 / rtb_Saturation1;
-  result_tmp[5] = rtb_Divide_o * R;
-  result_tmp[8] = rtb_Divide_o * a_tmp;
-  Phi2 = AutopilotStateMachine_P.Gain_Gain_k * AutopilotStateMachine_U.in.data.p_rad_s *
-    AutopilotStateMachine_P.Gainpk_Gain;
-  a = AutopilotStateMachine_P.Gain_Gain * AutopilotStateMachine_U.in.data.q_rad_s * AutopilotStateMachine_P.Gainqk_Gain;
-  rtb_Divide_o = AutopilotStateMachine_P.Gain_Gain_a * AutopilotStateMachine_U.in.data.r_rad_s;
-  for (rtb_on_ground = 0; rtb_on_ground < 3; rtb_on_ground++) {
-    result[rtb_on_ground] = (result_tmp[rtb_on_ground + 3] * a + result_tmp[rtb_on_ground] * Phi2) +
-      result_tmp[rtb_on_ground + 6] * rtb_Divide_o;
-  }
-
-  Phi2 = std::sin(rtb_dme);
-  result_tmp[0] = rtb_Saturation1;
-  result_tmp[3] = 0.0;
-  result_tmp[6] = -Phi2;
-  result_tmp[1] = R * Phi2;
-  result_tmp[4] = a_tmp;
-  result_tmp[7] = rtb_Saturation1 * R;
-  result_tmp[2] = a_tmp * Phi2;
-  result_tmp[5] = 0.0 - R;
-  result_tmp[8] = a_tmp * rtb_Saturation1;
-  for (rtb_on_ground = 0; rtb_on_ground < 3; rtb_on_ground++) {
-    result_0[rtb_on_ground] = (result_tmp[rtb_on_ground + 3] * AutopilotStateMachine_U.in.data.by_m_s2 +
-      result_tmp[rtb_on_ground] * AutopilotStateMachine_U.in.data.bx_m_s2) + result_tmp[rtb_on_ground + 6] *
-      AutopilotStateMachine_U.in.data.bz_m_s2;
-  }
-
   if (AutopilotStateMachine_U.in.data.nav_dme_valid != 0.0) {
     AutopilotStateMachine_B.BusAssignment_g.data.nav_dme_nmi = AutopilotStateMachine_U.in.data.nav_dme_nmi;
   } else if (AutopilotStateMachine_U.in.data.nav_loc_valid) {
@@ -2741,7 +2610,22 @@ void AutopilotStateMachineModelClass::step()
   } else {
     AutopilotStateMachine_B.BusAssignment_g.data.nav_dme_nmi = 0.0;
   }
+}
 
+void AutopilotStateMachineModelClass::AutopilotStateMachine_NavDeviation(void)
+{
+  real_T L;
+  real_T Phi2;
+  real_T R;
+  real_T a;
+  real_T a_tmp;
+  real_T a_tmp_0;
+  real_T b_L;
+  real_T b_R;
+  real_T rtb_Divide_o;
+  real_T rtb_Saturation1;
+  real_T rtb_dme;
+  boolean_T guard1{ false };
   rtb_dme = 0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lat;
   Phi2 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lat;
   rtb_Saturation1 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lon;
@@ -2908,6 +2792,187 @@ void AutopilotStateMachineModelClass::step()
     AutopilotStateMachine_B.BusAssignment_g.data.nav_e_gs_valid = false;
     AutopilotStateMachine_B.BusAssignment_g.data.nav_e_gs_error_deg = 0.0;
   }
+}
+
+boolean_T AutopilotStateMachineModelClass::AutopilotStateMachine_NavStationPositionAvailable(void) const
+{
+  return (AutopilotStateMachine_U.in.data.nav_loc_position.lat != 0.0) ||
+    (AutopilotStateMachine_U.in.data.nav_loc_position.lon != 0.0) ||
+    (AutopilotStateMachine_U.in.data.nav_loc_position.alt != 0.0) ||
+    (AutopilotStateMachine_U.in.data.nav_gs_position.lat != 0.0) ||
+    (AutopilotStateMachine_U.in.data.nav_gs_position.lon != 0.0) ||
+    (AutopilotStateMachine_U.in.data.nav_gs_position.alt != 0.0);
+}
+
+void AutopilotStateMachineModelClass::AutopilotStateMachine_NavDeviationWithoutStation(void)
+{
+  if (AutopilotStateMachine_U.in.data.nav_gs_valid || (!AutopilotStateMachine_DWork.nav_gs_deg_not_empty)) {
+    AutopilotStateMachine_DWork.nav_gs_deg = AutopilotStateMachine_U.in.data.nav_gs_deg;
+    AutopilotStateMachine_DWork.nav_gs_deg_not_empty = true;
+  }
+
+  AutopilotStateMachine_B.BusAssignment_g.data.nav_e_loc_valid = false;
+  AutopilotStateMachine_B.BusAssignment_g.data.nav_e_loc_error_deg = 0.0;
+  AutopilotStateMachine_B.BusAssignment_g.data.nav_e_gs_valid = false;
+  AutopilotStateMachine_B.BusAssignment_g.data.nav_e_gs_error_deg = 0.0;
+}
+
+boolean_T AutopilotStateMachineModelClass::AutopilotStateMachine_NavDeviationInputChanged(void)
+{
+  const ap_raw_data &data{ AutopilotStateMachine_U.in.data };
+  const NavDeviationInput input{ data.aircraft_position, data.nav_loc_position, data.nav_gs_position,
+    data.nav_loc_magvar_deg, data.nav_loc_deg, data.nav_gs_deg, data.nav_dme_valid, data.nav_dme_nmi,
+    static_cast<real_T>(data.nav_loc_valid), static_cast<real_T>(data.nav_gs_valid) };
+  const boolean_T changed{ (!navDeviationEvaluated) || (std::memcmp(&input, &navDeviationInput, sizeof(input)) != 0) };
+  navDeviationInput = input;
+  navDeviationEvaluated = true;
+  return changed;
+}
+
+void AutopilotStateMachineModelClass::step()
+{
+  static const real_T c[24]{ -3.7631613045100394E-12, -3.7631613045100418E-12, 6.2076488130688133E-12,
+    2.3375903616618146E-12, -2.9675180723323623E-12, -2.9675180723323619E-12, 2.2735910872868498E-8,
+    1.1446426959338374E-8, -1.4891939010927404E-8, -2.4704337359767112E-9, 1.1555108433994175E-8, -6.25E-9,
+    -1.897274956835846E-5, 1.520958826384842E-5, 7.1712086474912069E-6, -4.4094939746938354E-6, 1.3759855421341094E-5,
+    2.4370072289329445E-5, 0.05, 0.05, 0.1, 0.1, 0.1, 0.15 };
+
+  static const int16_T b[7]{ 0, 1000, 3333, 4000, 6000, 8000, 10000 };
+
+  uint64m_T tmp;
+  uint64m_T tmp_0;
+  uint64m_T tmp_1;
+  uint64m_T tmp_2;
+  uint64m_T tmp_3;
+  uint64m_T tmp_4;
+  uint64m_T tmp_5;
+  uint64m_T tmp_6;
+  uint64m_T tmp_7;
+  uint64m_T tmp_8;
+  real_T result_tmp[9];
+  real_T result[3];
+  real_T result_0[3];
+  real_T L;
+  real_T Phi2;
+  real_T R;
+  real_T a;
+  real_T a_tmp;
+  real_T a_tmp_0;
+  real_T b_L;
+  real_T b_R;
+  real_T rtb_Divide_o;
+  real_T rtb_GainTheta;
+  real_T rtb_GainTheta1;
+  real_T rtb_Saturation1;
+  real_T rtb_dme;
+  int32_T high_i;
+  int32_T low_i;
+  int32_T low_ip1;
+  int32_T mid_i;
+  int32_T rtb_on_ground;
+  boolean_T conditionSoftAlt;
+  boolean_T engageCondition;
+  boolean_T guard1{ false };
+
+  boolean_T isGoAroundModeActive;
+  boolean_T rtb_AND;
+  boolean_T rtb_AND_j;
+  boolean_T rtb_BusAssignment1_data_altimeter_setting_changed;
+  boolean_T rtb_BusAssignment1_input_LOC_push;
+  boolean_T rtb_BusConversion_InsertedFor_BusAssignment_at_inport_2_BusCreator1_APPR_push;
+  boolean_T rtb_FixPtRelationalOperator;
+  boolean_T rtb_Y_j;
+  boolean_T rtb_cFLARE;
+  boolean_T rtb_cGA;
+  boolean_T rtb_cLAND;
+  boolean_T sCLB_tmp;
+  boolean_T sCLB_tmp_0;
+  boolean_T speedTargetChanged;
+  boolean_T state_e_tmp;
+  boolean_T state_e_tmp_0;
+  boolean_T state_i_tmp;
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_a = (static_cast<int32_T>
+    (AutopilotStateMachine_U.in.input.AP_ENGAGE_push) > static_cast<int32_T>
+    (AutopilotStateMachine_DWork.DelayInput1_DSTATE_a));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_p = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.AP_1_push) >
+    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_p));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_bo = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.AP_2_push) >
+    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_bo));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_d = (static_cast<int32_T>
+    (AutopilotStateMachine_U.in.input.AP_DISCONNECT_push) > static_cast<int32_T>
+    (AutopilotStateMachine_DWork.DelayInput1_DSTATE_d));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_e = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.HDG_push) >
+    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_e));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_g = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.HDG_pull) >
+    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_g));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_f = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.ALT_push) >
+    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_f));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_ib = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.ALT_pull) >
+    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_ib));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_bd = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.VS_push) >
+    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_bd));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_ah = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.VS_pull) >
+    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_ah));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_fn = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.LOC_push) >
+    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_fn));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_h = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.APPR_push) >
+    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_h));
+  AutopilotStateMachine_DWork.DelayInput1_DSTATE_o = (static_cast<int32_T>(AutopilotStateMachine_U.in.input.EXPED_push) >
+    static_cast<int32_T>(AutopilotStateMachine_DWork.DelayInput1_DSTATE_o));
+  rtb_BusConversion_InsertedFor_BusAssignment_at_inport_2_BusCreator1_APPR_push =
+    AutopilotStateMachine_DWork.DelayInput1_DSTATE_h;
+  AutopilotStateMachine_B.BusAssignment_g.input.EXPED_push = AutopilotStateMachine_DWork.DelayInput1_DSTATE_o;
+  rtb_GainTheta = AutopilotStateMachine_P.GainTheta_Gain * AutopilotStateMachine_U.in.data.Theta_deg;
+  rtb_GainTheta1 = AutopilotStateMachine_P.GainTheta1_Gain * AutopilotStateMachine_U.in.data.Phi_deg;
+  rtb_dme = 0.017453292519943295 * rtb_GainTheta;
+  rtb_Saturation1 = 0.017453292519943295 * rtb_GainTheta1;
+  rtb_Divide_o = std::tan(rtb_dme);
+  R = std::sin(rtb_Saturation1);
+  a_tmp = std::cos(rtb_Saturation1);
+  result_tmp[0] = 1.0;
+  result_tmp[3] = R * rtb_Divide_o;
+  result_tmp[6] = a_tmp * rtb_Divide_o;
+  result_tmp[1] = 0.0;
+  result_tmp[4] = a_tmp;
+  result_tmp[7] = -R;
+  result_tmp[2] = 0.0;
+  rtb_Saturation1 = std::cos(rtb_dme);
+  rtb_Divide_o = 1.0 / rtb_Saturation1;
+  result_tmp[5] = rtb_Divide_o * R;
+  result_tmp[8] = rtb_Divide_o * a_tmp;
+  Phi2 = AutopilotStateMachine_P.Gain_Gain_k * AutopilotStateMachine_U.in.data.p_rad_s *
+    AutopilotStateMachine_P.Gainpk_Gain;
+  a = AutopilotStateMachine_P.Gain_Gain * AutopilotStateMachine_U.in.data.q_rad_s * AutopilotStateMachine_P.Gainqk_Gain;
+  rtb_Divide_o = AutopilotStateMachine_P.Gain_Gain_a * AutopilotStateMachine_U.in.data.r_rad_s;
+  for (rtb_on_ground = 0; rtb_on_ground < 3; rtb_on_ground++) {
+    result[rtb_on_ground] = (result_tmp[rtb_on_ground + 3] * a + result_tmp[rtb_on_ground] * Phi2) +
+      result_tmp[rtb_on_ground + 6] * rtb_Divide_o;
+  }
+
+  Phi2 = std::sin(rtb_dme);
+  result_tmp[0] = rtb_Saturation1;
+  result_tmp[3] = 0.0;
+  result_tmp[6] = -Phi2;
+  result_tmp[1] = R * Phi2;
+  result_tmp[4] = a_tmp;
+  result_tmp[7] = rtb_Saturation1 * R;
+  result_tmp[2] = a_tmp * Phi2;
+  result_tmp[5] = 0.0 - R;
+  result_tmp[8] = a_tmp * rtb_Saturation1;
+  for (rtb_on_ground = 0; rtb_on_ground < 3; rtb_on_ground++) {
+    result_0[rtb_on_ground] = (result_tmp[rtb_on_ground + 3] * AutopilotStateMachine_U.in.data.by_m_s2 +
+      result_tmp[rtb_on_ground] * AutopilotStateMachine_U.in.data.bx_m_s2) + result_tmp[rtb_on_ground + 6] *
+      AutopilotStateMachine_U.in.data.bz_m_s2;
+  }
+
+  if ((!incrementalEvaluation) || AutopilotStateMachine_NavDeviationInputChanged()) {
+    AutopilotStateMachine_NavDistance();
+    if (incrementalEvaluation && (!AutopilotStateMachine_NavStationPositionAvailable())) {
+      AutopilotStateMachine_NavDeviationWithoutStation();
+    } else {
+      AutopilotStateMachine_NavDeviation();
+    }
+  }
 
   rtb_dme = AutopilotStateMachine_P.Gain_Gain_af * AutopilotStateMachine_U.in.data.gear_strut_compression_1 -
     AutopilotStateMachine_P.Constant1_Value;
@@ -4685,6 +4750,7 @@ void AutopilotStateMachineModelClass::step()
 
 void AutopilotStateMachineModelClass::initialize()
 {
+  navDeviationEvaluated = false;
   AutopilotStateMachine_DWork.DelayInput1_DSTATE_a = AutopilotStateMachine_P.DetectIncrease12_vinit;
   AutopilotStateMachine_DWork.DelayInput1_DSTATE_p = AutopilotStateMachine_P.DetectIncrease_vinit;
   AutopilotStateMachine_DWork.DelayInput1_DSTATE_bo = AutopilotStateMachine_P.DetectIncrease1_vinit;
@@ -4756,7 +4822,11 @@ AutopilotStateMachineModelClass::AutopilotStateMachineModelClass():
   AutopilotStateMachine_U(),
   AutopilotStateMachine_Y(),
   AutopilotStateMachine_B(),
-  AutopilotStateMachine_DWork()
+  AutopilotStateMachine_DWork(),
+  AutopilotStateMachine_P(AutopilotStateMachine_rtP),
+  incrementalEvaluation(false),
+  navDeviationEvaluated(false),
+  navDeviationInput()
 {
 }
 
@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_AutopilotStateMachine_h_
 #define RTW_HEADER_AutopilotStateMachine_h_
 #include <cmath>
+#include <cstring>
 #include "rtwtypes.h"
 #include "AutopilotStateMachine_types.h"
 
@@ -281,17 +282,51 @@ class AutopilotStateMachineModelClass
     return AutopilotStateMachine_Y;
   }
 
+  const Parameters_AutopilotStateMachine_T &getParameters() const
+  {
+    return AutopilotStateMachine_P;
+  }
+
+  void setParameters(const Parameters_AutopilotStateMachine_T *pParameters_AutopilotStateMachine_T)
+  {
+    AutopilotStateMachine_P = *pParameters_AutopilotStateMachine_T;
+  }
+
+  // the radio navigation deviations are only evaluated when their inputs changed, the outputs are identical
+  void setIncrementalEvaluation(boolean_T enabled)
+  {
+    incrementalEvaluation = enabled;
+    navDeviationEvaluated = false;
+  }
+
   void initialize();
   void step();
   static void terminate();
   AutopilotStateMachineModelClass();
   ~AutopilotStateMachineModelClass();
  private:
+  struct NavDeviationInput {
+    ap_lat_lon_alt aircraft_position;
+    ap_lat_lon_alt nav_loc_position;
+    ap_lat_lon_alt nav_gs_position;
+    real_T nav_loc_magvar_deg;
+    real_T nav_loc_deg;
+    real_T nav_gs_deg;
+    real_T nav_dme_valid;
+    real_T nav_dme_nmi;
+    real_T nav_loc_valid;
+    real_T nav_gs_valid;
+  };
+
   ExternalInputs_AutopilotStateMachine_T AutopilotStateMachine_U;
   ExternalOutputs_AutopilotStateMachine_T AutopilotStateMachine_Y;
   BlockIO_AutopilotStateMachine_T AutopilotStateMachine_B;
   D_Work_AutopilotStateMachine_T AutopilotStateMachine_DWork;
-  static Parameters_AutopilotStateMachine_T AutopilotStateMachine_P;
+  Parameters_AutopilotStateMachine_T AutopilotStateMachine_P;
+  static const Parameters_AutopilotStateMachine_T AutopilotStateMachine_rtP;
+  boolean_T incrementalEvaluation;
+  boolean_T navDeviationEvaluated;
+  NavDeviationInput navDeviationInput;
   static void AutopilotStateMachine_LagFilter(real_T rtu_U, real_T rtu_C1, real_T rtu_dt, real_T *rty_Y,
     rtDW_LagFilter_AutopilotStateMachine_T *localDW);
   static void AutopilotStateMachine_WashoutFilter(real_T rtu_U, real_T rtu_C1, real_T rtu_dt, real_T *rty_Y,
@@ -384,6 +419,11 @@ class AutopilotStateMachineModelClass
   void AutopilotStateMachine_exit_internal_ON(void);
   void AutopilotStateMachine_ON_l(void);
   void AutopilotStateMachine_SRS_GA_during(void);
+  void AutopilotStateMachine_NavDistance(void);
+  void AutopilotStateMachine_NavDeviation(void);
+  boolean_T AutopilotStateMachine_NavStationPositionAvailable(void) const;
+  void AutopilotStateMachine_NavDeviationWithoutStation(void);
+  boolean_T AutopilotStateMachine_NavDeviationInputChanged(void);
 };
 
 #endif
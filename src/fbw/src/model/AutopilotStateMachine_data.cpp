@@ -1,8 +1,8 @@
 #include "AutopilotStateMachine.h"
 #include "AutopilotStateMachine_private.h"
 
-AutopilotStateMachineModelClass::Parameters_AutopilotStateMachine_T AutopilotStateMachineModelClass::
-  AutopilotStateMachine_P{
+const AutopilotStateMachineModelClass::Parameters_AutopilotStateMachine_T AutopilotStateMachineModelClass::
+  AutopilotStateMachine_rtP{
 
   {
     {
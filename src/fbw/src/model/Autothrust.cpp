@@ -974,7 +974,8 @@ void AutothrustModelClass::terminate()
 AutothrustModelClass::AutothrustModelClass():
   Autothrust_U(),
   Autothrust_Y(),
-  Autothrust_DWork()
+  Autothrust_DWork(),
+  Autothrust_P(Autothrust_rtP)
 {
 }
 
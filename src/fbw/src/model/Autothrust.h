@@ -237,6 +237,16 @@ class AutothrustModelClass
     return Autothrust_Y;
   }
 
+  const Parameters_Autothrust_T &getParameters() const
+  {
+    return Autothrust_P;
+  }
+
+  void setParameters(const Parameters_Autothrust_T *pParameters_Autothrust_T)
+  {
+    Autothrust_P = *pParameters_Autothrust_T;
+  }
+
   void initialize();
   void step();
   static void terminate();
@@ -246,7 +256,8 @@ class AutothrustModelClass
   ExternalInputs_Autothrust_T Autothrust_U;
   ExternalOutputs_Autothrust_T Autothrust_Y;
   D_Work_Autothrust_T Autothrust_DWork;
-  static Parameters_Autothrust_T Autothrust_P;
+  Parameters_Autothrust_T Autothrust_P;
+  static const Parameters_Autothrust_T Autothrust_rtP;
   static void Autothrust_TimeSinceCondition(real_T rtu_time, boolean_T rtu_condition, real_T *rty_y,
     rtDW_TimeSinceCondition_Autothrust_T *localDW);
   static void Autothrust_LeadLagFilter(real_T rtu_U, real_T rtu_C1, real_T rtu_C2, real_T rtu_C3, real_T rtu_C4, real_T
@@ -1,7 +1,7 @@
 #include "Autothrust.h"
 #include "Autothrust_private.h"
 
-AutothrustModelClass::Parameters_Autothrust_T AutothrustModelClass::Autothrust_P{
+const AutothrustModelClass::Parameters_Autothrust_T AutothrustModelClass::Autothrust_rtP{
 
   {
     {
@@ -1807,7 +1807,8 @@ FlyByWireModelClass::FlyByWireModelClass():
   FlyByWire_U(),
   FlyByWire_Y(),
   FlyByWire_B(),
-  FlyByWire_DWork()
+  FlyByWire_DWork(),
+  FlyByWire_P(FlyByWire_rtP)
 {
 }
 
@@ -578,6 +578,16 @@ class FlyByWireModelClass
     return FlyByWire_Y;
   }
 
+  const Parameters_FlyByWire_T &getParameters() const
+  {
+    return FlyByWire_P;
+  }
+
+  void setParameters(const Parameters_FlyByWire_T *pParameters_FlyByWire_T)
+  {
+    FlyByWire_P = *pParameters_FlyByWire_T;
+  }
+
   void initialize();
   void step();
   static void terminate();
@@ -588,7 +598,8 @@ class FlyByWireModelClass
   ExternalOutputs_FlyByWire_T FlyByWire_Y;
   BlockIO_FlyByWire_T FlyByWire_B;
   D_Work_FlyByWire_T FlyByWire_DWork;
-  static Parameters_FlyByWire_T FlyByWire_P;
+  Parameters_FlyByWire_T FlyByWire_P;
+  static const Parameters_FlyByWire_T FlyByWire_rtP;
   static void FlyByWire_GetIASforMach4(real_T rtu_m, real_T rtu_m_t, real_T rtu_v, real_T *rty_v_t);
   static void FlyByWire_LagFilter(real_T rtu_U, real_T rtu_C1, real_T rtu_dt, real_T *rty_Y, rtDW_LagFilter_FlyByWire_T *
     localDW);
@@ -1,7 +1,7 @@
 #include "FlyByWire.h"
 #include "FlyByWire_private.h"
 
-FlyByWireModelClass::Parameters_FlyByWire_T FlyByWireModelClass::FlyByWire_P{
+const FlyByWireModelClass::Parameters_FlyByWire_T FlyByWireModelClass::FlyByWire_rtP{
 
   {
     {
@@ -236,7 +236,8 @@ void ThrustLimitsModelClass::terminate()
 ThrustLimitsModelClass::ThrustLimitsModelClass():
   ThrustLimits_U(),
   ThrustLimits_Y(),
-  ThrustLimits_DWork()
+  ThrustLimits_DWork(),
+  ThrustLimits_P(ThrustLimits_rtP)
 {
 }
 
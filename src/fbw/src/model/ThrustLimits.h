@@ -202,6 +202,16 @@ class ThrustLimitsModelClass
     return ThrustLimits_Y;
   }
 
+  const Parameters_ThrustLimits_T &getParameters() const
+  {
+    return ThrustLimits_P;
+  }
+
+  void setParameters(const Parameters_ThrustLimits_T *pParameters_ThrustLimits_T)
+  {
+    ThrustLimits_P = *pParameters_ThrustLimits_T;
+  }
+
   static void initialize();
   void step();
   static void terminate();
@@ -211,7 +221,8 @@ class ThrustLimitsModelClass
   ExternalInputs_ThrustLimits_T ThrustLimits_U;
   ExternalOutputs_ThrustLimits_T ThrustLimits_Y;
   D_Work_ThrustLimits_T ThrustLimits_DWork;
-  static Parameters_ThrustLimits_T ThrustLimits_P;
+  Parameters_ThrustLimits_T ThrustLimits_P;
+  static const Parameters_ThrustLimits_T ThrustLimits_rtP;
   static void ThrustLimits_RateLimiterwithThreshold(real_T rtu_U, real_T rtu_up, real_T rtu_lo, real_T rtu_Ts, real_T
     rtu_init, real_T rtu_threshold, real_T *rty_Y, rtDW_RateLimiterwithThreshold_ThrustLimits_T *localDW);
 };
@@ -1,7 +1,7 @@
 #include "ThrustLimits.h"
 #include "ThrustLimits_private.h"
 
-ThrustLimitsModelClass::Parameters_ThrustLimits_T ThrustLimitsModelClass::ThrustLimits_P{
+const ThrustLimitsModelClass::Parameters_ThrustLimits_T ThrustLimitsModelClass::ThrustLimits_rtP{
   {
     0.0,
     0.0,
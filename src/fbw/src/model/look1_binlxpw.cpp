@@ -1,3 +1,4 @@
+#define LOOKUP_KERNEL_DEFINITION
 #include "rtwtypes.h"
 #include "look1_binlxpw.h"
 
@@ -4,5 +4,10 @@
 
 extern real_T look1_binlxpw(real_T u0, const real_T bp0[], const real_T table[], uint32_T maxIndex);
 
+#if defined(LOOKUP_CACHED_INDEX) && !defined(LOOKUP_KERNEL_DEFINITION)
+#include "../CachedIndexLookup.h"
+#define look1_binlxpw(u0, bp0, table, maxIndex) LOOK1_BINLXPW_CACHED(u0, bp0, table, maxIndex)
+#endif
+
 #endif
 
@@ -5,5 +5,10 @@
 extern real_T look2_binlxpw(real_T u0, real_T u1, const real_T bp0[], const real_T bp1[], const real_T table[], const
   uint32_T maxIndex[], uint32_T stride);
 
+#if defined(LOOKUP_CACHED_INDEX) && !defined(LOOKUP_KERNEL_DEFINITION)
+#include "../CachedIndexLookup.h"
+#define look2_binlxpw(u0, u1, bp0, bp1, table, maxIndex, stride) LOOK2_BINLXPW_CACHED(u0, u1, bp0, bp1, table, maxIndex, stride)
+#endif
+
 #endif
 
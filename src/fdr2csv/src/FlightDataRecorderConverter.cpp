@@ -558,6 +558,17 @@ void FlightDataRecorderConverter::writeHeader(ofstream& out, const string& delim
   out << "data.throttle_lever_2_pos" << delimiter;
   out << "data.corrected_engine_N1_1_percent" << delimiter;
   out << "data.corrected_engine_N1_2_percent" << delimiter;
+  out << "data.sim_data_age" << delimiter;
+  out << "data.sim_data_slow_age" << delimiter;
+  out << "perf.read_data_us" << delimiter;
+  out << "perf.autopilot_state_machine_us" << delimiter;
+  out << "perf.autopilot_laws_us" << delimiter;
+  out << "perf.fly_by_wire_us" << delimiter;
+  out << "perf.thrust_limits_us" << delimiter;
+  out << "perf.autothrust_us" << delimiter;
+  out << "perf.spoilers_us" << delimiter;
+  out << "perf.flight_data_recorder_us" << delimiter;
+  out << "perf.frame_us" << delimiter;
   out << endl;
 }
 
@@ -568,7 +579,8 @@ void FlightDataRecorderConverter::writeStruct(ofstream& out,
                                               const athr_out& athr,
                                               const fbw_output& fbw,
                                               const EngineData& engine,
-                                              const AdditionalData& data) {
+                                              const AdditionalData& data,
+                                              const PerformanceData& perf) {
   out << ap_sm.time.dt << delimiter;
   out << ap_sm.time.simulation_time << delimiter;
   out << ap_sm.data.aircraft_position.lat << delimiter;
@@ -1124,5 +1136,16 @@ void FlightDataRecorderConverter::writeStruct(ofstream& out,
   out << data.throttle_lever_2_pos << delimiter;
   out << data.corrected_engine_N1_1_percent << delimiter;
   out << data.corrected_engine_N1_2_percent << delimiter;
+  out << data.sim_data_age << delimiter;
+  out << data.sim_data_slow_age << delimiter;
+  out << perf.read_data_us << delimiter;
+  out << perf.autopilot_state_machine_us << delimiter;
+  out << perf.autopilot_laws_us << delimiter;
+  out << perf.fly_by_wire_us << delimiter;
+  out << perf.thrust_limits_us << delimiter;
+  out << perf.autothrust_us << delimiter;
+  out << perf.spoilers_us << delimiter;
+  out << perf.flight_data_recorder_us << delimiter;
+  out << perf.frame_us << delimiter;
   out << endl;
 }
@@ -8,6 +8,7 @@
 #include "Autothrust_types.h"
 #include "EngineData.h"
 #include "FlyByWire_types.h"
+#include "PerformanceData.h"
 
 class FlightDataRecorderConverter {
  public:
@@ -22,5 +23,6 @@ class FlightDataRecorderConverter {
                           const athr_out& athr,
                           const fbw_output& fbw,
                           const EngineData& engine,
-                          const AdditionalData& data);
+                          const AdditionalData& data,
+                          const PerformanceData& perf);
 };
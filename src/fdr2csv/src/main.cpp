@@ -10,12 +10,13 @@
 #include "FlightDataRecorder.h"
 #include "FlightDataRecorderConverter.h"
 #include "FlyByWire_types.h"
+#include "PerformanceData.h"
 #include "zfstream.h"
 
 using namespace std;
 
 // IMPORTANT: this constant needs to increased with every interface change
-const uint64_t INTERFACE_VERSION = 17;
+const uint64_t INTERFACE_VERSION = 19;
 
 int main(int argc, char* argv[]) {
   // variables for command line parameters
@@ -130,6 +131,7 @@ int main(int argc, char* argv[]) {
   fbw_output data_fbw = {};
   EngineData data_engine = {};
   AdditionalData data_additional = {};
+  PerformanceData data_performance = {};
 
   // read one struct from the file
   while (!in->eof()) {
@@ -140,8 +142,10 @@ int main(int argc, char* argv[]) {
     in->read(reinterpret_cast<char*>(&data_fbw), sizeof(fbw_output));
     in->read(reinterpret_cast<char*>(&data_engine), sizeof(EngineData));
     in->read(reinterpret_cast<char*>(&data_additional), sizeof(AdditionalData));
+    in->read(reinterpret_cast<char*>(&data_performance), sizeof(PerformanceData));
     // write struct to csv file
-    FlightDataRecorderConverter::writeStruct(out, delimiter, data_ap_sm, data_ap_laws, data_athr, data_fbw, data_engine, data_additional);
+    FlightDataRecorderConverter::writeStruct(out, delimiter, data_ap_sm, data_ap_laws, data_athr, data_fbw, data_engine, data_additional,
+                                             data_performance);
     // print progress
     if (++counter % 500 == 0) {
       cout << "Processed " << counter << " entries...";
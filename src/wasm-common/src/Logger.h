@@ -0,0 +1,212 @@
+#pragma once
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// log levels, messages above LOGGER_LEVEL are removed at compile time (e.g. -DLOGGER_LEVEL=LOGGER_LEVEL_WARNING)
+#define LOGGER_LEVEL_NONE 0
+#define LOGGER_LEVEL_ERROR 1
+#define LOGGER_LEVEL_WARNING 2
+#define LOGGER_LEVEL_INFO 3
+#define LOGGER_LEVEL_DEBUG 4
+
+#ifndef LOGGER_LEVEL
+#define LOGGER_LEVEL LOGGER_LEVEL_INFO
+#endif
+
+#if LOGGER_LEVEL >= LOGGER_LEVEL_ERROR
+#define LOG_ERROR(...) Logger::log(LOGGER_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) ((void)0)
+#endif
+
+#if LOGGER_LEVEL >= LOGGER_LEVEL_WARNING
+#define LOG_WARNING(...) Logger::log(LOGGER_LEVEL_WARNING, __VA_ARGS__)
+#else
+#define LOG_WARNING(...) ((void)0)
+#endif
+
+#if LOGGER_LEVEL >= LOGGER_LEVEL_INFO
+#define LOG_INFO(...) Logger::log(LOGGER_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) ((void)0)
+#endif
+
+#if LOGGER_LEVEL >= LOGGER_LEVEL_DEBUG
+#define LOG_DEBUG(...) Logger::log(LOGGER_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
+
+// Buffered logger for the WASM modules. Messages are formatted printf-style into a preallocated ring buffer and written
+// to stdout in one batch when flush() is called at the end of a frame. Repeated identical messages are collapsed (also
+// across frames) within REPEAT_WINDOW_SECONDS of their last output, the repetitions are reported when the message changes,
+// after MAXIMUM_REPEAT_COUNT repetitions or by the first flush after the window. The number of messages per flush is
+// limited, excess messages are dropped and reported on flush. The level can additionally be limited at runtime (e.g. when
+// shedding load), suppressed messages are reported once the limit is lifted.
+class Logger {
+ public:
+  static constexpr size_t BUFFER_SIZE = 16384;
+  static constexpr size_t MAXIMUM_MESSAGE_LENGTH = 256;
+  static constexpr uint32_t MAXIMUM_MESSAGES_PER_FLUSH = 64;
+  static constexpr uint32_t MAXIMUM_REPEAT_COUNT = 1000;
+  static constexpr double REPEAT_WINDOW_SECONDS = 10.0;
+
+  __attribute__((format(printf, 2, 3))) static void log(int level, const char* format, ...) {
+    State& state = getState();
+
+    // suppress message above runtime level
+    if (level > state.maximumLevel) {
+      state.suppressedMessages++;
+      return;
+    }
+
+    // format message (a new line is added)
+    char message[MAXIMUM_MESSAGE_LENGTH];
+    va_list arguments;
+    va_start(arguments, format);
+    int length = vsnprintf(message, MAXIMUM_MESSAGE_LENGTH - 1, format, arguments);
+    va_end(arguments);
+    if (length < 0) {
+      return;
+    }
+    length = length < static_cast<int>(MAXIMUM_MESSAGE_LENGTH - 2) ? length : static_cast<int>(MAXIMUM_MESSAGE_LENGTH - 2);
+    message[length++] = '\n';
+    message[length] = '\0';
+
+    // collapse repeated message within the repeat window
+    Clock::time_point now = Clock::now();
+    if (length == state.lastMessageLength && memcmp(message, state.lastMessage, length) == 0 && !isRepeatWindowOver(state, now)) {
+      if (++state.repeatCount >= MAXIMUM_REPEAT_COUNT) {
+        writeRepeatCount(state);
+      }
+      return;
+    }
+    writeRepeatCount(state);
+
+    // store as last message
+    memcpy(state.lastMessage, message, length);
+    state.lastMessageLength = length;
+    state.lastMessageTime = now;
+
+    // enforce message limit
+    if (state.messagesSinceFlush >= MAXIMUM_MESSAGES_PER_FLUSH) {
+      state.droppedMessages++;
+      return;
+    }
+    state.messagesSinceFlush++;
+
+    write(state, message, length);
+  }
+
+  // limits the level of messages at runtime, it cannot exceed the compile time level
+  static void setMaximumLevel(int level) { getState().maximumLevel = level; }
+
+  static void flush() {
+    State& state = getState();
+
+    // report the repetitions once the repeat window is over, the next occurrence of the message is written again
+    if (state.repeatCount > 0 && isRepeatWindowOver(state, Clock::now())) {
+      writeRepeatCount(state);
+      state.lastMessageLength = 0;
+    }
+
+    if (state.suppressedMessages > 0 && state.maximumLevel >= LOGGER_LEVEL) {
+      char message[MAXIMUM_MESSAGE_LENGTH];
+      int length = snprintf(message, MAXIMUM_MESSAGE_LENGTH, "LOGGER: %u messages suppressed\n", state.suppressedMessages);
+      forceWrite(state, message, length);
+      state.suppressedMessages = 0;
+    }
+
+    if (state.droppedMessages > 0) {
+      char message[MAXIMUM_MESSAGE_LENGTH];
+      int length = snprintf(message, MAXIMUM_MESSAGE_LENGTH, "LOGGER: %u messages dropped\n", state.droppedMessages);
+      forceWrite(state, message, length);
+      state.droppedMessages = 0;
+    }
+
+    // nothing to do
+    if (state.used == 0) {
+      state.messagesSinceFlush = 0;
+      return;
+    }
+
+    // write content of ring buffer in at most two blocks
+    size_t tail = (state.head + BUFFER_SIZE - state.used) % BUFFER_SIZE;
+    size_t firstBlock = (tail + state.used <= BUFFER_SIZE) ? state.used : BUFFER_SIZE - tail;
+    fwrite(state.buffer + tail, 1, firstBlock, stdout);
+    if (firstBlock < state.used) {
+      fwrite(state.buffer, 1, state.used - firstBlock, stdout);
+    }
+    fflush(stdout);
+
+    // reset
+    state.used = 0;
+    state.messagesSinceFlush = 0;
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct State {
+    char buffer[BUFFER_SIZE] = {};
+    size_t head = 0;
+    size_t used = 0;
+
+    char lastMessage[MAXIMUM_MESSAGE_LENGTH] = {};
+    int lastMessageLength = 0;
+    Clock::time_point lastMessageTime = {};
+    uint32_t repeatCount = 0;
+
+    uint32_t messagesSinceFlush = 0;
+    uint32_t droppedMessages = 0;
+
+    int maximumLevel = LOGGER_LEVEL;
+    uint32_t suppressedMessages = 0;
+  };
+
+  // the state is a function-local static, the header is shared by the modules and does not rely on inline variables
+  static State& getState() {
+    static State state;
+    return state;
+  }
+
+  static bool isRepeatWindowOver(const State& state, Clock::time_point now) {
+    return std::chrono::duration<double>(now - state.lastMessageTime).count() >= REPEAT_WINDOW_SECONDS;
+  }
+
+  static void writeRepeatCount(State& state) {
+    if (state.repeatCount == 0) {
+      return;
+    }
+    char message[MAXIMUM_MESSAGE_LENGTH];
+    int length = snprintf(message, MAXIMUM_MESSAGE_LENGTH, "LOGGER: last message repeated %u times\n", state.repeatCount);
+    forceWrite(state, message, length);
+    state.repeatCount = 0;
+  }
+
+  // write even when the message limit is reached (used for summaries)
+  static void forceWrite(State& state, const char* message, int length) {
+    if (length > 0) {
+      write(state, message, static_cast<size_t>(length) < MAXIMUM_MESSAGE_LENGTH ? length : MAXIMUM_MESSAGE_LENGTH - 1);
+    }
+  }
+
+  static void write(State& state, const char* message, size_t length) {
+    // drop message if buffer is full
+    if (state.used + length > BUFFER_SIZE) {
+      state.droppedMessages++;
+      return;
+    }
+
+    // copy into ring buffer, wrap around at the end
+    size_t firstBlock = (state.head + length <= BUFFER_SIZE) ? length : BUFFER_SIZE - state.head;
+    memcpy(state.buffer + state.head, message, firstBlock);
+    memcpy(state.buffer, message + firstBlock, length - firstBlock);
+    state.head = (state.head + length) % BUFFER_SIZE;
+    state.used += length;
+  }
+};